@@ -10,6 +10,27 @@
 
 #include "arm.h"
 
+#include <stddef.h>
+
+//
+// Dynarec is x86-64 Linux only (where mprotect is always there, whether or
+// not the build says HAVE_MPROTECT); everything else runs the block
+// interpreter
+//
+#if defined(__x86_64__) && defined(__linux__) && !defined(EMSCRIPTEN)
+#define ENABLE_DYNAREC
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+//
+// Emscripten builds can instead translate hot blocks to WebAssembly at run
+// time (emscripten/armwasm.js); opt in with ARM_WASM_DYNAREC
+//
+#if defined(EMSCRIPTEN) && defined(ARM_WASM_DYNAREC)
+#define ENABLE_WASMREC
+#endif
+
 //int armcount = 0;
 
 //extern void subtimeon(void);
@@ -32,55 +53,13 @@ static EMU_INLINE void armsubtimeon(void) { armsubtimestart = myrdtsc(); }
 static EMU_INLINE void armsubtimeoff(void) { armsubtime += myrdtsc() - armsubtimestart; }
 */
 /////////////////////////////////////////////////////////////////////////////
-//
-// Static information
-//
-
-// rows: instruction condition field
-// columns: values of nzcv
-static uint8 condtable[256];
-
-//
-// initialize condtable
-//
-static void condtable_init(void) {
-  uint8 nzcv, cond;
-  uint8 *table = condtable;
-  for(nzcv = 0; nzcv < 16; nzcv++) {
-    for(cond = 0; cond < 16; cond++) {
-      uint8 n = (nzcv >> 3) & 1;
-      uint8 z = (nzcv >> 2) & 1;
-      uint8 c = (nzcv >> 1) & 1;
-      uint8 v = (nzcv >> 0) & 1;
-      uint8 truth = 0;
-      switch(cond & 0xE) {
-      case 0x0: /* EQ */ truth = z; break;
-      case 0x2: /* CS */ truth = c; break;
-      case 0x4: /* MI */ truth = n; break;
-      case 0x6: /* VS */ truth = v; break;
-      case 0x8: /* HI */ truth = ((!z) && c); break;
-      case 0xA: /* GE */ truth = (n == v); break;
-      case 0xC: /* GT */ truth = ((!z) && (n == v)); break;
-      case 0xE: /* AL */ truth = 1; break;
-      }
-      if(cond & 1) { truth = !truth; }
-      *table++ = truth ? 1 : 0;
-    }
-  }
-}
-
 //
 // Static init
 //
+// Nothing to build: the condition table is generated along with the
+// specialized handlers, see armops.h
+//
 sint32 EMU_CALL arm_init(void) {
-//int i;
-  condtable_init();
-
-//for(i=0;i<256;i++){
-//printf("%d",condtable[i]);
-//if((i&15)==15)printf("\n");
-//}
-
   return 0;
 }
 
@@ -119,6 +98,74 @@ sint32 EMU_CALL arm_init(void) {
 #define EXCEPTION_IRQ      (6)
 #define EXCEPTION_FIQ      (7)
 
+struct ARM_STATE;
+
+typedef void (EMU_CALL *inscallback)(struct ARM_STATE *state, uint32 insword);
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Predecoded block cache
+//
+// Runs of instructions fetched from pointer-mapped memory are decoded once
+// into a block: handler resolved (specialized by operand form where
+// possible), condition field split off.
+// Blocks never cross a code page, and each code page carries a generation
+// count that is bumped by every pointer-mapped store into it; a block whose
+// generation no longer matches its page is stale and gets rebuilt.
+// Pages are hashed by their offset within the mapped region, so mirrors and
+// aliases only ever cause extra invalidation, never a missed one.
+//
+#define ARM_BLOCK_COUNT    (256)
+#define ARM_BLOCK_MAXINS   (16)
+#define ARM_CODEPAGE_SHIFT (ARM_WRITEGEN_SHIFT)
+#define ARM_CODEPAGE_COUNT (ARM_WRITEGEN_COUNT)
+
+#define ARM_COND_AL        (0xE)
+
+#define ARM_IDLE_PCS_MAX   (8)
+
+//
+// Memory dispatch page table
+//
+// One byte per 64KB page over the 32-bit space, holding the index of the map
+// entry that serves the whole page, or ARM_PAGE_MIXED if more than one entry
+// has a say in it (those pages fall back to walking the map).
+// Map indices are used instead of pointers to keep the table location
+// invariant.
+//
+#define ARM_PAGE_SHIFT     (16)
+#define ARM_PAGE_COUNT     (0x10000)
+#define ARM_PAGE_MIXED     (0xFF)
+
+struct ARM_DECODED {
+  inscallback handler;
+  uint32 insword;
+  uint32 cond;
+};
+
+struct ARM_BLOCK {
+  uint32 pc;
+  uint32 n;
+  uint32 page;
+  uint32 gen;
+  uint32 idle; // nonzero if this block is a candidate idle loop
+#ifdef ENABLE_DYNAREC
+  uint32 dynaofs; // 0 if not compiled
+#endif
+#ifdef ENABLE_WASMREC
+  uint32 wasmfn;  // function table index, 0 if not compiled
+  uint32 runs;    // times interpreted so far
+#endif
+  struct ARM_DECODED ins[ARM_BLOCK_MAXINS];
+};
+
+#ifdef ENABLE_DYNAREC
+#define ARM_DYNACODE_MAX_SIZE   (0x10000)
+#define ARM_DYNACODE_SLOP_SIZE  (0x10)
+// worst case for one compiled block, with room to spare
+#define ARM_DYNACODE_BLOCK_SIZE (ARM_BLOCK_MAXINS * 0x100 + 0x40)
+#endif
+
 struct ARM_STATE {
   //
   // Registers
@@ -137,6 +184,16 @@ struct ARM_STATE {
   uint32 spsr_irq;
   uint32 spsr_und;
 
+  //
+  // Lazy flags
+  // When lazy_kind isn't LAZY_NONE, the flags in cpsr it covers are stale and
+  // must be recomputed from the last result (and operands) before use
+  //
+  uint32 lazy_kind;
+  uint32 lazy_op1;
+  uint32 lazy_op2;
+  uint32 lazy_res;
+
   sint32 cycles_remaining;
   sint32 cycles_remaining_last_checkpoint;
 
@@ -144,6 +201,7 @@ struct ARM_STATE {
   // These are REGISTERED EXTERNAL POINTERS.
   //
   arm_advance_callback_t advance;
+  arm_idle_callback_t idle;
   void *hwstate;
   struct ARM_MEMORY_MAP *map_load;
   struct ARM_MEMORY_MAP *map_store;
@@ -157,6 +215,49 @@ struct ARM_STATE {
   uint32 fetchbox;
 
   int badinsflag;
+
+  //
+  // Block cache; holds only static handler addresses and instruction words,
+  // so there are no location invariance issues here either.
+  //
+  uint32 codepagegen[ARM_CODEPAGE_COUNT];
+  struct ARM_BLOCK blocks[ARM_BLOCK_COUNT];
+
+  //
+  // Memory dispatch pages; rebuilt whenever the maps are registered
+  //
+  uint8 pages_load[ARM_PAGE_COUNT];
+  uint8 pages_store[ARM_PAGE_COUNT];
+
+  //
+  // Idle loop skipping, and what it has done so far
+  //
+  uint8 idle_enabled;
+  uint32 idle_pc_count;
+  uint32 idle_pcs[ARM_IDLE_PCS_MAX];
+  uint64 idle_cycles;
+
+#ifdef ENABLE_DYNAREC
+  //
+  // Compiled blocks; position independent, since the state pointer is
+  // passed in and everything else referenced is static.
+  // dyna_prepared is where dynacode was last made executable; it's only
+  // compared, never dereferenced, so a state that has moved since just runs
+  // the block interpreter until it's prepared again.
+  //
+  uint8 dyna_enabled;
+  size_t dyna_prepared;
+  uint32 dynacode_used;
+  uint8 dynacode[ARM_DYNACODE_MAX_SIZE];
+#endif
+
+#ifdef ENABLE_WASMREC
+  //
+  // Compiled blocks live in the function table, outside the state; they
+  // take the state pointer as a parameter
+  //
+  uint8 wasm_enabled;
+#endif
 };
 
 uint32 EMU_CALL arm_get_state_size(void) {
@@ -167,6 +268,72 @@ uint32 EMU_CALL arm_get_state_size(void) {
 
 static EMU_INLINE void pcchanged(struct ARM_STATE *state) { state->maxpc = 0; }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Lazy flag evaluation
+//
+// Flag-setting instructions just record what they did:
+//   LAZY_NZ   N,Z pending from lazy_res (C,V are up to date)
+//   LAZY_ADD  N,Z,C,V pending from lazy_op1 + lazy_op2 = lazy_res
+//   LAZY_SUB  N,Z,C,V pending from lazy_op1 - lazy_op2 = lazy_res
+// Carry-in is already folded into lazy_res for ADC/SBC/RSC; the C and V
+// formulas work on the result, so they come out the same.
+//
+#define LAZY_NONE (0)
+#define LAZY_NZ   (1)
+#define LAZY_ADD  (2)
+#define LAZY_SUB  (3)
+
+static void EMU_CALL flags_materialize(struct ARM_STATE *state) {
+  uint32 op1 = state->lazy_op1;
+  uint32 op2 = state->lazy_op2;
+  uint32 res = state->lazy_res;
+  uint32 v, c;
+  switch(state->lazy_kind) {
+  case LAZY_ADD:
+    v = ((op2^res)&(~(op1^op2))) >> 31;
+    c = (res^((op1^op2)|(op2^res))) >> 31;
+    state->cpsr &= ~((PSR_CMASK)|(PSR_VMASK));
+    state->cpsr |= v << PSR_POS_V;
+    state->cpsr |= c << PSR_POS_C;
+    break;
+  case LAZY_SUB:
+    v = ((op2^op1)&(~(op2^res))) >> 31;
+    c = (~(op1^((op2^op1)|(op1^res)))) >> 31;
+    state->cpsr &= ~((PSR_CMASK)|(PSR_VMASK));
+    state->cpsr |= v << PSR_POS_V;
+    state->cpsr |= c << PSR_POS_C;
+    break;
+  case LAZY_NZ:
+    break;
+  default:
+    return;
+  }
+  state->cpsr &= ~((PSR_NMASK)|(PSR_ZMASK));
+  state->cpsr |= (res&0x80000000) | (((uint32)(res==0))<<(PSR_POS_Z));
+  state->lazy_kind = LAZY_NONE;
+}
+
+//
+// Up to date cpsr
+//
+static EMU_INLINE uint32 flags_cpsr(struct ARM_STATE *state) {
+  if(state->lazy_kind != LAZY_NONE) flags_materialize(state);
+  return state->cpsr;
+}
+
+//
+// Bring C and V up to date, leaving N and Z lazy if they are
+//
+static EMU_INLINE void flags_settle_cv(struct ARM_STATE *state) {
+  if(state->lazy_kind >= LAZY_ADD) flags_materialize(state);
+}
+
+static EMU_INLINE uint32 flags_c(struct ARM_STATE *state) {
+  flags_settle_cv(state);
+  return ((state->cpsr) >> PSR_POS_C) & 1;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Swap registers either to or from their proper places
@@ -214,6 +381,7 @@ static void setuserreg(struct ARM_STATE *state, uint32 n, uint32 v) {
 static void setcpsr(struct ARM_STATE *state, uint32 psr) {
   regswap(state);
   state->cpsr = psr & 0xF00000FF;
+  state->lazy_kind = LAZY_NONE;
   regswap(state);
 }
 
@@ -227,7 +395,7 @@ static void exception(struct ARM_STATE *state, uint32 n) {
   };
   uint32 spsr;
   n &= 7;
-  spsr = state->cpsr;
+  spsr = flags_cpsr(state);
   setcpsr(state, ((state->cpsr) & (~(MODE_MASK))) | mode_on_entry[n]);
   state->spsr = spsr;
   state->r[14] = state->r[15] + lr_offset[n];
@@ -241,6 +409,28 @@ static void exception(struct ARM_STATE *state, uint32 n) {
 void EMU_CALL arm_clear_state(void *state) {
   memset(state, 0, sizeof(struct ARM_STATE));
   exception(ARMSTATE, EXCEPTION_RESET);
+  ARMSTATE->idle_enabled = 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Build a dispatch page table for a map
+// The map must end in an entry covering the whole address space, same as
+// the walker has always required
+//
+static void pages_build(uint8 *pages, struct ARM_MEMORY_MAP *map) {
+  uint32 page, i;
+  for(page = 0; page < ARM_PAGE_COUNT; page++) {
+    uint32 pstart = page << ARM_PAGE_SHIFT;
+    uint32 pend   = pstart + ((1 << ARM_PAGE_SHIFT) - 1);
+    pages[page] = ARM_PAGE_MIXED;
+    // the first entry touching the page must cover all of it
+    for(i = 0; i < ARM_PAGE_MIXED; i++) {
+      if(map[i].y < pstart || map[i].x > pend) continue;
+      if(map[i].x <= pstart && map[i].y >= pend) pages[page] = i;
+      break;
+    }
+  }
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -254,6 +444,9 @@ void EMU_CALL arm_set_memory_maps(
 ) {
   ARMSTATE->map_load  = map_load;
   ARMSTATE->map_store = map_store;
+  pages_build(ARMSTATE->pages_load , map_load );
+  pages_build(ARMSTATE->pages_store, map_store);
+  arm_invalidate_code(state);
 }
 
 void EMU_CALL arm_set_advance_callback(
@@ -265,6 +458,109 @@ void EMU_CALL arm_set_advance_callback(
   ARMSTATE->hwstate = hwstate;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Drop all predecoded blocks
+// Must be called whenever code memory is changed behind the ARM's back
+//
+void EMU_CALL arm_invalidate_code(void *state) {
+  uint32 i;
+  for(i = 0; i < ARM_BLOCK_COUNT; i++) { ARMSTATE->blocks[i].n = 0; }
+  // anything else caching memory contents has to drop it too
+  for(i = 0; i < ARM_CODEPAGE_COUNT; i++) { ARMSTATE->codepagegen[i]++; }
+}
+
+//
+// The code page counters double as write counters for other users
+//
+const uint32* EMU_CALL arm_get_write_generations(void *state) {
+  return ARMSTATE->codepagegen;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Idle loop skipping control and statistics
+//
+void EMU_CALL arm_enable_idle_skip(void *state, uint8 enable) {
+  ARMSTATE->idle_enabled = (enable != 0);
+}
+
+uint32 EMU_CALL arm_get_idle_pcs(void *state, uint32 *pcs, uint32 max) {
+  uint32 i;
+  for(i = 0; i < max && i < ARMSTATE->idle_pc_count; i++) {
+    pcs[i] = ARMSTATE->idle_pcs[i];
+  }
+  return ARMSTATE->idle_pc_count;
+}
+
+uint64 EMU_CALL arm_get_idle_cycles(void *state) {
+  return ARMSTATE->idle_cycles;
+}
+
+void EMU_CALL arm_set_idle_callback(void *state, arm_idle_callback_t idle) {
+  ARMSTATE->idle = idle;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Dynarec control
+//
+#ifdef ENABLE_DYNAREC
+static int dynacode_protect(struct ARM_STATE *state, int prot) {
+  unsigned long startaddr = (unsigned long)(&state->dynacode);
+  unsigned long length    = sizeof(state->dynacode);
+  int           psize     = getpagesize();
+  unsigned long addr      = ( startaddr & ~(psize - 1) );
+  return mprotect( (char *) addr, length + startaddr - addr + psize, prot );
+}
+#endif
+
+#ifdef ENABLE_WASMREC
+static void wasm_release_all(struct ARM_STATE *state);
+#endif
+
+//
+// Enabling makes the buffer executable first if it isn't already, and fails
+// (leaving the dynarec off) if that can't be done; disabling undoes it.
+// Translated WebAssembly blocks live in the function table, outside the
+// state, so disabling gives those back too.
+//
+sint32 EMU_CALL arm_enable_dynarec(void *state, uint8 enable) {
+#ifdef ENABLE_DYNAREC
+  if(enable && ARMSTATE->dyna_prepared != (size_t)(ARMSTATE->dynacode)) {
+    if(arm_prepare_dynacode(state) < 0) { ARMSTATE->dyna_enabled = 0; return -1; }
+  }
+  if(!enable && ARMSTATE->dyna_prepared) arm_unprepare_dynacode(state);
+  ARMSTATE->dyna_enabled = (enable != 0);
+#endif
+#ifdef ENABLE_WASMREC
+  if(!enable) wasm_release_all(ARMSTATE);
+  ARMSTATE->wasm_enabled = (enable != 0);
+#endif
+  return 0;
+}
+
+sint32 EMU_CALL arm_prepare_dynacode(void *state) {
+#ifdef ENABLE_DYNAREC
+  if(dynacode_protect(ARMSTATE, PROT_READ | PROT_WRITE | PROT_EXEC) != 0) {
+    ARMSTATE->dyna_prepared = 0;
+    return -1;
+  }
+  ARMSTATE->dyna_prepared = (size_t)(ARMSTATE->dynacode);
+#endif
+  return 0;
+}
+
+void EMU_CALL arm_unprepare_dynacode(void *state) {
+#ifdef ENABLE_DYNAREC
+  dynacode_protect(ARMSTATE, PROT_READ | PROT_WRITE);
+  ARMSTATE->dyna_prepared = 0;
+#endif
+#ifdef ENABLE_WASMREC
+  wasm_release_all(ARMSTATE);
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////////////
 
 uint32 EMU_CALL arm_getreg(void *state, sint32 regnum) {
@@ -273,7 +569,7 @@ uint32 EMU_CALL arm_getreg(void *state, sint32 regnum) {
     return ARMSTATE->r[n];
   }
   switch(regnum) {
-  case ARM_REG_CPSR: return ARMSTATE->cpsr;
+  case ARM_REG_CPSR: return flags_cpsr(ARMSTATE);
   case ARM_REG_SPSR: return ARMSTATE->spsr;
   }
   return 0;
@@ -294,15 +590,27 @@ void EMU_CALL arm_break(void *state) {
 //
 // Memory map walker
 //
-static EMU_INLINE struct ARM_MEMORY_TYPE* mmwalk(struct ARM_MEMORY_MAP *map, uint32 a) {
+static struct ARM_MEMORY_MAP* mmwalk(struct ARM_MEMORY_MAP *map, uint32 a) {
   for(;; map++) {
     uint32 x = map->x;
     uint32 y = map->y;
     if(a < x || a > y) continue;
-    return &(map->type);
+    return map;
   }
 }
 
+//
+// Page table lookup, walking only for mixed pages
+//
+static EMU_INLINE struct ARM_MEMORY_MAP* mmpage(struct ARM_MEMORY_MAP *map, const uint8 *pages, uint32 a) {
+  uint32 i = pages[a >> ARM_PAGE_SHIFT];
+  if(i == ARM_PAGE_MIXED) return mmwalk(map, a);
+  return map + i;
+}
+
+#define MMLOAD(A)  (&(mmpage(state->map_load , state->pages_load , (A))->type))
+#define MMSTORE(A) (&(mmpage(state->map_store, state->pages_store, (A))->type))
+
 /////////////////////////////////////////////////////////////////////////////
 
 static void hw_sync(struct ARM_STATE *state) {
@@ -316,7 +624,7 @@ static void hw_sync(struct ARM_STATE *state) {
 static EMU_INLINE void renew_fetch_region(struct ARM_STATE *state) {
   struct ARM_MEMORY_TYPE *t;
   state->r[15] &= ~3;
-  t = mmwalk(state->map_load, state->r[15]);
+  t = MMLOAD(state->r[15]);
   if(t->n == ARM_MAP_TYPE_POINTER) {
     uint32 astart = (state->r[15]) & (~(t->mask));
     state->maxpc = astart + ((t->mask) + 1);
@@ -328,12 +636,21 @@ static EMU_INLINE void renew_fetch_region(struct ARM_STATE *state) {
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Invalidate any blocks decoded from the code page containing this
+// (region-relative) address
+//
+static EMU_INLINE void codepage_touch(struct ARM_STATE *state, uint32 a) {
+  state->codepagegen[(a >> ARM_CODEPAGE_SHIFT) & (ARM_CODEPAGE_COUNT - 1)]++;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 
 static EMU_INLINE uint32 lb(struct ARM_STATE *state, uint32 a) {
   struct ARM_MEMORY_TYPE *t;
 //armsubtimeon();
-  t = mmwalk(state->map_load, a);
+  t = MMLOAD(a);
   a &= t->mask;
   if(t->n == ARM_MAP_TYPE_POINTER) {
     a ^= EMU_ENDIAN_XOR(3);
@@ -353,7 +670,7 @@ static EMU_INLINE uint32 lh(struct ARM_STATE *state, uint32 a) {
   struct ARM_MEMORY_TYPE *t;
   uint32 sh;
 //armsubtimeon();
-  t = mmwalk(state->map_load, a);
+  t = MMLOAD(a);
   sh = (a & 3) * 8;
   a &= t->mask & (~3);
   if(t->n == ARM_MAP_TYPE_POINTER) {
@@ -371,7 +688,7 @@ static EMU_INLINE uint32 lw(struct ARM_STATE *state, uint32 a) {
   struct ARM_MEMORY_TYPE *t;
   uint32 sh;
 //armsubtimeon();
-  t = mmwalk(state->map_load, a);
+  t = MMLOAD(a);
   sh = (a & 3) * 8;
   a &= t->mask & (~3);
   if(t->n == ARM_MAP_TYPE_POINTER) {
@@ -387,9 +704,10 @@ static EMU_INLINE uint32 lw(struct ARM_STATE *state, uint32 a) {
 static EMU_INLINE void sb(struct ARM_STATE *state, uint32 a, uint32 d) {
   struct ARM_MEMORY_TYPE *t;
 //armsubtimeon();
-  t = mmwalk(state->map_store, a);
+  t = MMSTORE(a);
   a &= t->mask;
   if(t->n == ARM_MAP_TYPE_POINTER) {
+    codepage_touch(state, a);
     a ^= EMU_ENDIAN_XOR(3);
     *((uint8*)(((uint8*)(t->p))+a)) = d;
   } else {
@@ -405,11 +723,12 @@ static EMU_INLINE void sh(struct ARM_STATE *state, uint32 a, uint32 d) {
   struct ARM_MEMORY_TYPE *t;
   uint32 sh;
 //armsubtimeon();
-  t = mmwalk(state->map_store, a);
+  t = MMSTORE(a);
   sh = (a & 3) * 8;
   a &= t->mask & (~3);
   d &= 0xFFFF;
   if(t->n == ARM_MAP_TYPE_POINTER) {
+    codepage_touch(state, a);
     *((uint32*)(((uint8*)(t->p))+a)) &= ~(0xFFFF << sh);
     *((uint32*)(((uint8*)(t->p))+a)) |=  (d      << sh);
   } else {
@@ -423,10 +742,11 @@ static EMU_INLINE void sw(struct ARM_STATE *state, uint32 a, uint32 d) {
   struct ARM_MEMORY_TYPE *t;
   uint32 sh;
 //armsubtimeon();
-  t = mmwalk(state->map_store, a);
+  t = MMSTORE(a);
   sh = (a & 3) * 8;
   a &= t->mask & (~3);
   if(t->n == ARM_MAP_TYPE_POINTER) {
+    codepage_touch(state, a);
     *((uint32*)(((uint8*)(t->p))+a)) &= ~(0xFFFFFFFF << sh);
     *((uint32*)(((uint8*)(t->p))+a)) |=  (d          << sh);
   } else {
@@ -455,8 +775,9 @@ static void EMU_CALL badins(struct ARM_STATE *state, uint32 insword) {
 #define WRITESTATUS(N) (((N)&1)!=0)
 #define ISLOGIC(N) ((((N)&0x0C)==0x00)||(((N)&0x18)==0x18))
 
-#define C_TO_CPSR { state->cpsr &= ~PSR_CMASK; state->cpsr |= (c&1) << PSR_POS_C; }
-#define GET_NZ_TO_CPSR(V) { state->cpsr &= ~((PSR_NMASK)|(PSR_ZMASK)); state->cpsr |= ((V)&0x80000000) | (((uint32)((V)==0))<<(PSR_POS_Z)); }
+#define C_TO_CPSR { flags_settle_cv(state); state->cpsr &= ~PSR_CMASK; state->cpsr |= (c&1) << PSR_POS_C; }
+#define NZ_TO_LAZY(V) { flags_settle_cv(state); state->lazy_kind = LAZY_NZ; state->lazy_res = (V); }
+#define ARITH_TO_LAZY(K,A,B,R) { state->lazy_kind = (K); state->lazy_op1 = (A); state->lazy_op2 = (B); state->lazy_res = (R); }
 
 #define DATAOP(N) (((N)>>1)&0xF)
 
@@ -483,7 +804,7 @@ static void EMU_CALL badins(struct ARM_STATE *state, uint32 insword) {
 //
 #define INSDATA(N)                                                           \
 static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
-  uint32 v, c;                                                               \
+  uint32 c;                                                                  \
   uint32 result, operand1, operand2;                                         \
   uint32 rd;                                                                 \
   /*                                                                 */      \
@@ -503,7 +824,7 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
         result = state->r[IFIELD(0,4)] * state->r[IFIELD(8,4)];             \
         if(N & 2) result += state->r[IFIELD(12,4)];                         \
         /* set N and Z here if we want them  */                             \
-        if(WRITESTATUS(N)) { GET_NZ_TO_CPSR(result); }                      \
+        if(WRITESTATUS(N)) { NZ_TO_LAZY(result); }                          \
         state->r[15] -= 4;                                                  \
         state->r[rd] = result;                                              \
         if(rd == 15) pcchanged(state);                                      \
@@ -535,7 +856,7 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
     if((insword & 0x0FFF0FFF) == 0x010F0000) {                 \
       state->r[15] += 4;                                       \
       rd = IFIELD(12, 4);                                      \
-      if(rd != 15) state->r[rd] = state->cpsr;                 \
+      if(rd != 15) state->r[rd] = flags_cpsr(state);           \
       return;                                                  \
     }                                                          \
     if((insword & 0x0FFF0FFF) == 0x014F0000) {                 \
@@ -562,6 +883,7 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
       state->r[15] += 8;                                       \
       src = state->r[IFIELD(0,4)];                             \
       state->r[15] -= 4;                                       \
+      state->lazy_kind = LAZY_NONE;                            \
       state->cpsr &=        0x0FFFFFFF;                        \
       state->cpsr |= (src & 0xF0000000);                       \
       return;                                                  \
@@ -579,6 +901,7 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
       uint32 src = IFIELD(0,8);                                \
       uint32 ror = IFIELD(8,4) * 2;                            \
       src = (src >> ror) | (src << (32-ror));                  \
+      state->lazy_kind = LAZY_NONE;                            \
       state->cpsr &=        0x0FFFFFFF;                        \
       state->cpsr |= (src & 0xF0000000);                       \
       return;                                                  \
@@ -605,7 +928,7 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
     /* rrx is a special case */                                               \
     if((insword & 0xFF0) == 0x060) {                                        \
       c = operand2 & 1;                                                     \
-      operand2 = (operand2 >> 1) | ((state->cpsr << 2) & 0x80000000);       \
+      operand2 = (operand2 >> 1) | (flags_c(state) << 31);                  \
       if(WRITESTATUS(N) && ISLOGIC(N)) { C_TO_CPSR; }                       \
     } else {                                                                \
       uint8 shiftby;                                                        \
@@ -679,13 +1002,9 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
     DATAOP(N)==DATA_ADC    \
   ) {       \
     result = operand1 + operand2;                                              \
-    if(DATAOP(N)==DATA_ADC) result += (((state->cpsr) >> PSR_POS_C) & 1);       \
+    if(DATAOP(N)==DATA_ADC) result += flags_c(state);                          \
     if(WRITESTATUS(N)) {                                                       \
-      v = ((operand2^result)&(~(operand1^operand2))) >> 31;                    \
-      c = (result^((operand1^operand2)|(operand2^result))) >> 31;              \
-      state->cpsr &= ~((PSR_CMASK)|(PSR_VMASK));                               \
-      state->cpsr |= v << PSR_POS_V;                                           \
-      state->cpsr |= c << PSR_POS_C;                                           \
+      ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);                     \
     }                                                                          \
   /* SUB and RSB and CMP and SBC and RSC  */                                   \
   } else if(               \
@@ -701,19 +1020,15 @@ static void EMU_CALL insdata##N(struct ARM_STATE *state, uint32 insword) {   \
     result = operand1 - operand2;                                                           \
     /* carry where needed */                                                                \
     if(DATAOP(N)==DATA_SBC || DATAOP(N)==DATA_RSC) {                                        \
-      result += (((state->cpsr) >> PSR_POS_C) & 1);                                         \
+      result += flags_c(state);                                                             \
       result--;                                                                             \
     }                                                                                       \
     if(WRITESTATUS(N)) {                                                                   \
-      v = ((operand2^operand1)&(~(operand2^result))) >> 31;                                \
-      c = (~(operand1^((operand2^operand1)|(operand1^result)))) >> 31;                     \
-      state->cpsr &= ~((PSR_CMASK)|(PSR_VMASK));                                           \
-      state->cpsr |= v << PSR_POS_V;                                                       \
-      state->cpsr |= c << PSR_POS_C;                                                       \
+      ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);                                 \
     }                                                                                      \
   }                                                                                        \
-  /* set N and Z here if we want them  */                                                  \
-  if(WRITESTATUS(N)) { GET_NZ_TO_CPSR(result); }                                           \
+  /* set N and Z here if we want them (arithmetic did all four above) */                   \
+  if(WRITESTATUS(N) && ISLOGIC(N)) { NZ_TO_LAZY(result); }                                 \
   /* it's safe to decrement the program counter again here */                              \
   state->r[15] -= 4;                                                                       \
   /* write results to the destination register if applicable */                            \
@@ -744,6 +1059,42 @@ INSDATA(0x28) INSDATA(0x29) INSDATA(0x2A) INSDATA(0x2B) INSDATA(0x2C) INSDATA(0x
 INSDATA(0x30) INSDATA(0x31) INSDATA(0x32) INSDATA(0x33) INSDATA(0x34) INSDATA(0x35) INSDATA(0x36) INSDATA(0x37)
 INSDATA(0x38) INSDATA(0x39) INSDATA(0x3A) INSDATA(0x3B) INSDATA(0x3C) INSDATA(0x3D) INSDATA(0x3E) INSDATA(0x3F)
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Condition table and operand-specialized Data Processing handlers
+// (generated by armmake.c)
+//
+#include "armops.h"
+
+//
+// Pick a specialized handler for a Data Processing instruction, if there is
+// one for its form; NULL otherwise
+//
+static inscallback insdp_specialize(uint32 insword) {
+  uint32 op = IFIELD(20,8);
+  uint32 dataop = DATAOP(op);
+  uint32 form;
+  if(op >= 0x40) return NULL;
+  // multiply/swap/halfword and PSR transfers stay generic
+  if(!(op & 0x20) && ((insword & 0x90) == 0x90)) return NULL;
+  if((op & 0x19) == 0x10) return NULL;
+  // nothing involving r15
+  if(((op & 0x18) != 0x10) && (IFIELD(12,4) == 15)) return NULL;
+  if(dataop != DATA_MOV && dataop != DATA_MVN && IFIELD(16,4) == 15) return NULL;
+  if(op & 0x20) {
+    if(IFIELD(8,4) != 0) return NULL;
+    form = INSDP_FORM_IMM;
+  } else if(!(insword & 0x10)) {
+    if(IFIELD(4,8) != 0) return NULL;
+    if(IFIELD(0,4) == 15) return NULL;
+    form = INSDP_FORM_REG;
+  } else {
+    if(IFIELD(0,4) == 15 || IFIELD(8,4) == 15) return NULL;
+    form = INSDP_FORM_RSR + IFIELD(5,2);
+  }
+  return insdptable[dataop][op & 1][form];
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Template for a Single Data Transfer instruction (0x40-0x7F in the list)
@@ -772,7 +1123,7 @@ static void EMU_CALL inssdt##N(struct ARM_STATE *state, uint32 insword) {   \
     /* shift                 */                                             \
     /* rrx is a special case */                                             \
     if((insword & 0xFF0) == 0x060) {                                        \
-      offset = (offset >> 1) | ((state->cpsr << 2) & 0x80000000);           \
+      offset = (offset >> 1) | (flags_c(state) << 31);                      \
     } else {                                                                \
       uint8 shiftby = IFIELD(7,5);                                          \
       shiftby |= ((shiftby == 0) & ((insword & 0x60) != 0)) << 5;           \
@@ -825,10 +1176,62 @@ INSSDT(0x78) INSSDT(0x79) INSSDT(0x7A) INSSDT(0x7B) INSSDT(0x7C) INSSDT(0x7D) IN
 #define BDT_W(N) (((N)>>1)&1)
 #define BDT_L(N) (((N)>>0)&1)
 
+#define BDT_LW(A)   (host ? *((uint32*)(host+(A))) : lw(state, (A)))
+#define BDT_SW(A,D) { if(host) { *((uint32*)(host+(A))) = (D); } else { sw(state, (A), (D)); } }
+
+//
+// Region serving every word of first..last, if that's a single
+// pointer-mapped region (and no mirror boundary is crossed); else NULL
+//
+static EMU_INLINE struct ARM_MEMORY_TYPE* bdt_region(
+  struct ARM_MEMORY_MAP *map, const uint8 *pages, uint32 first, uint32 last
+) {
+  struct ARM_MEMORY_TYPE *t;
+  uint32 i;
+  if((first & 3) || ((first ^ last) >> ARM_PAGE_SHIFT)) return NULL;
+  i = pages[first >> ARM_PAGE_SHIFT];
+  if(i == ARM_PAGE_MIXED) return NULL;
+  t = &(map[i].type);
+  if(t->n != ARM_MAP_TYPE_POINTER) return NULL;
+  if((first ^ last) & ~(t->mask)) return NULL;
+  return t;
+}
+
+//
+// Resolve a block transfer once: if all its words land in pointer-mapped
+// memory, return a host base such that host+address addresses each word
+// (same trick as fetchbase). Otherwise NULL, and it goes word by word
+// through lw/sw.
+//
+static EMU_INLINE uint8* bdt_host(
+  struct ARM_STATE *state, uint32 insword, uint32 base, uint32 pre, uint32 up, uint32 load
+) {
+  struct ARM_MEMORY_TYPE *t;
+  uint32 m = insword & 0xFFFF;
+  uint32 n, first, last;
+  for(n = 0; m; m &= m - 1) n++;
+  if(!n) return NULL;
+  if(up) { first = base + (pre ? 4 : 0); }
+  else   { first = base - 4 * n + (pre ? 0 : 4); }
+  last = first + 4 * (n - 1);
+  if(load) {
+    t = bdt_region(state->map_load, state->pages_load, first, last);
+  } else {
+    t = bdt_region(state->map_store, state->pages_store, first, last);
+    if(t) {
+      codepage_touch(state, first & t->mask);
+      codepage_touch(state, last  & t->mask);
+    }
+  }
+  if(!t) return NULL;
+  return ((uint8*)(t->p)) - (first & ~(t->mask));
+}
+
 #define INSBDT(N)                                                             \
 static void EMU_CALL insbdt##N(struct ARM_STATE *state, uint32 insword) {     \
   uint32 address = state->r[IFIELD(16,4)];                                    \
   uint32 rfe = 0;                                                             \
+  uint8 *host = bdt_host(state, insword, address, BDT_P(N), BDT_U(N), BDT_L(N)); \
   sint32 r = 0;                                                               \
   sint32 rend = 16;                                                           \
   sint32 rstep = 1;                                                           \
@@ -840,10 +1243,10 @@ static void EMU_CALL insbdt##N(struct ARM_STATE *state, uint32 insword) {     \
     if(( BDT_P(N))) { if(BDT_U(N)) { address += 4; } else { address -= 4; } } \
     if(BDT_L(N)) {                                                            \
       if(BDT_S(N)) {                                                          \
-        if((insword&0x8000)==0) { setuserreg(state, r, lw(state, address)); } \
-        else { state->r[r] = lw(state, address); }                            \
+        if((insword&0x8000)==0) { setuserreg(state, r, BDT_LW(address)); }  \
+        else { state->r[r] = BDT_LW(address); }                               \
       } else {                                                                \
-        state->r[r] = lw(state, address);                                     \
+        state->r[r] = BDT_LW(address);                                        \
       }                                                                       \
       /* if we just loaded the PC: */                                         \
       if(r == 15) {                                                           \
@@ -855,8 +1258,8 @@ static void EMU_CALL insbdt##N(struct ARM_STATE *state, uint32 insword) {     \
         }                                                                     \
       }                                                                       \
     } else {                                                                  \
-      if(BDT_S(N)) { sw(state, address, getuserreg(state, r)); }              \
-      else { sw(state, address, state->r[r]); }                               \
+      if(BDT_S(N)) { BDT_SW(address, getuserreg(state, r)); }                 \
+      else { BDT_SW(address, state->r[r]); }                                  \
     }                                                                         \
     if((!BDT_P(N))) { if(BDT_U(N)) { address += 4; } else { address -= 4; } } \
   }                                                                           \
@@ -894,8 +1297,6 @@ static void EMU_CALL insbranchlink(struct ARM_STATE *state, uint32 insword) {
 
 /////////////////////////////////////////////////////////////////////////////
 
-typedef void (EMU_CALL *inscallback)(struct ARM_STATE *state, uint32 insword);
-
 static inscallback inscalltable[256] = {
 // 00
   insdata0x00,insdata0x01,insdata0x02,insdata0x03,insdata0x04,insdata0x05,insdata0x06,insdata0x07,
@@ -947,6 +1348,624 @@ static inscallback inscalltable[256] = {
   badins,badins,badins,badins,badins,badins,badins,badins
 };
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Idle loop detection
+//
+// A candidate is a block that branches back to its own start, whose body
+// only loads (no writeback) and does data processing into registers other
+// than r15, where nothing the body writes is read before it's written
+// within the same pass, and where load base/index registers are written at
+// most once and not after the load. One pass through such a body is a fixed point: as
+// long as memory doesn't change, every later pass leaves the registers and
+// flags exactly as the first one did, and the branch goes the same way.
+//
+// Memory only changes behind the ARM's back through hardware, which gets a
+// chance to run on callback accesses and when arm_execute returns, so once a
+// pass has completed with all its loads in pointer-mapped memory, whole
+// passes can be skipped right up to the end of the slice. One load from
+// callback-mapped memory is allowed if the idle callback says for how long
+// it'll read the same (a timer or interrupt flag the hardware won't touch
+// before its next timer event), and then the skip stops short of that.
+//
+#define IDLE_FLAG_N (1 << 16)
+#define IDLE_FLAG_Z (1 << 17)
+#define IDLE_FLAG_C (1 << 18)
+#define IDLE_FLAG_V (1 << 19)
+
+//
+// Registers (bits 0-15) and flags read/written by a body instruction
+// Returns 0 if the instruction isn't allowed in an idle loop body
+//
+static uint32 idle_regs(uint32 insword, uint32 *reads, uint32 *writes) {
+  uint32 op = IFIELD(20,8);
+  uint32 rd = IFIELD(12,4);
+  if((insword >> 28) != ARM_COND_AL) return 0;
+  if(op < 0x40) {
+    uint32 dataop = DATAOP(op);
+    uint32 logic = ISLOGIC(op);
+    // no multiply/swap/halfword, no MRS/MSR
+    if(!(op & 0x20) && ((insword & 0x90) == 0x90)) return 0;
+    if((op & 0x19) == 0x10) return 0;
+    if(dataop != DATA_MOV && dataop != DATA_MVN) *reads |= 1 << IFIELD(16,4);
+    if(!(op & 0x20)) {
+      // no register-specified shifts
+      if(insword & 0x10) return 0;
+      *reads |= 1 << IFIELD(0,4);
+      if((insword & 0xFF0) == 0x060) {
+        *reads |= IDLE_FLAG_C;
+        if(WRITESTATUS(op) && logic) *writes |= IDLE_FLAG_C;
+      } else if((insword & 0xFE0) != 0) {
+        if(WRITESTATUS(op) && logic) *writes |= IDLE_FLAG_C;
+      }
+    }
+    if(dataop == DATA_ADC || dataop == DATA_SBC || dataop == DATA_RSC) *reads |= IDLE_FLAG_C;
+    if(WRITESTATUS(op)) {
+      *writes |= IDLE_FLAG_N | IDLE_FLAG_Z;
+      if(!logic) *writes |= IDLE_FLAG_C | IDLE_FLAG_V;
+    }
+    if((op & 0x18) != 0x10) {
+      if(rd == 15) return 0;
+      *writes |= 1 << rd;
+    }
+    return 1;
+  }
+  if(op < 0x80) {
+    // loads only, pre-indexed, no writeback
+    if(!SDT_L(op) || !SDT_P(op) || SDT_W(op)) return 0;
+    if(rd == 15) return 0;
+    *reads |= 1 << IFIELD(16,4);
+    if(SDT_I(op)) {
+      // register offset: LSL by an immediate only
+      if(insword & 0x70) return 0;
+      if(IFIELD(0,4) == 15) return 0;
+      *reads |= 1 << IFIELD(0,4);
+    }
+    *writes |= 1 << rd;
+    return 1;
+  }
+  return 0;
+}
+
+static uint32 idle_analyze(const struct ARM_BLOCK *b) {
+  uint32 i, insword, target;
+  uint32 allwrites = 0, written = 0, twice = 0, addrregs = 0;
+  if(b->n < 1) return 0;
+  //
+  // must end in a branch (without link) back to the start
+  //
+  insword = b->ins[b->n - 1].insword;
+  if(IFIELD(24,4) != 0xA) return 0;
+  target = b->pc + 4 * (b->n - 1) + 8 + ((uint32)((sint32)(insword << 8) >> 6));
+  if(target != b->pc) return 0;
+  //
+  // collect everything the body writes
+  //
+  // idle_skip rebuilds load addresses from the registers as they are at the
+  // end of the pass, so a load's base and index must hold the same value
+  // then as when it ran: written at most once, and never after the load
+  //
+  for(i = 0; i + 1 < b->n; i++) {
+    uint32 reads = 0, writes = 0;
+    insword = b->ins[i].insword;
+    if(!idle_regs(insword, &reads, &writes)) return 0;
+    if(writes & addrregs) return 0;
+    if(IFIELD(20,8) >= 0x40) {
+      addrregs |= 1 << IFIELD(16,4);
+      if(SDT_I(IFIELD(20,8))) addrregs |= 1 << IFIELD(0,4);
+    }
+    twice |= writes & allwrites;
+    allwrites |= writes;
+  }
+  if(twice & addrregs) return 0;
+  //
+  // then make sure nothing carries over from one pass to the next
+  //
+  for(i = 0; i < b->n; i++) {
+    uint32 reads = 0, writes = 0;
+    if(i + 1 < b->n) {
+      idle_regs(b->ins[i].insword, &reads, &writes);
+    } else if(b->ins[i].cond != ARM_COND_AL) {
+      reads = IDLE_FLAG_N | IDLE_FLAG_Z | IDLE_FLAG_C | IDLE_FLAG_V;
+    }
+    if(reads & allwrites & (~written)) return 0;
+    written |= writes;
+  }
+  return 1;
+}
+
+//
+// Called with the block just having looped back to its start
+//
+static void idle_skip(struct ARM_STATE *state, struct ARM_BLOCK *b) {
+  uint32 i, m, limit = 0xFFFFFFFF, polled = 0;
+  if(state->cycles_remaining <= 0) return;
+  if(state->r[15] != b->pc) return;
+  if(b->gen != state->codepagegen[b->page]) return;
+  //
+  // every load must have come from pointer-mapped memory, except for at
+  // most one from somewhere the idle callback vouches for
+  //
+  for(i = 0; i + 1 < b->n; i++) {
+    uint32 insword = b->ins[i].insword;
+    uint32 op = IFIELD(20,8);
+    uint32 address, offset, stable, since;
+    struct ARM_MEMORY_TYPE *t;
+    if(op < 0x40) continue;
+    address = state->r[IFIELD(16,4)];
+    if(IFIELD(16,4) == 15) address = b->pc + 4 * i + 8;
+    if(SDT_I(op)) {
+      offset = state->r[IFIELD(0,4)] << IFIELD(7,5);
+    } else {
+      offset = insword & 0xFFF;
+    }
+    if(SDT_U(op)) { address += offset; } else { address -= offset; }
+    t = MMLOAD(address);
+    if(t->n == ARM_MAP_TYPE_POINTER) continue;
+    if(!state->idle || polled++) return;
+    //
+    // the hardware was last synced by that load, so it answers from the
+    // time of the read; take off what's run since then
+    //
+    stable = state->idle(state->hwstate, address & t->mask & (~3));
+    since = state->cycles_remaining_last_checkpoint - state->cycles_remaining;
+    if(stable <= since) return;
+    limit = stable - since;
+  }
+  //
+  // skip as many whole passes as can be done while still leaving
+  // some cycles to run the tail end for real
+  //
+  m = (((uint32)(state->cycles_remaining)) - 1) / (2 * b->n);
+  if(m > limit / (2 * b->n)) m = limit / (2 * b->n);
+  if(!m) return;
+  state->cycles_remaining -= 2 * b->n * m;
+  state->idle_cycles += 2 * b->n * m;
+  for(i = 0; i < state->idle_pc_count; i++) {
+    if(state->idle_pcs[i] == b->pc) return;
+  }
+  if(state->idle_pc_count < ARM_IDLE_PCS_MAX) {
+    state->idle_pcs[state->idle_pc_count++] = b->pc;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// What the block translators may do inline: branches, and data processing
+// that insdp_specialize accepts with an imm8 or plain Rm operand and no
+// carry-in. Everything else calls the handler. The kinds are also part of
+// the WebAssembly descriptor, so they must match armwasm.js.
+//
+#if defined(ENABLE_DYNAREC) || defined(ENABLE_WASMREC)
+
+#define ARM_KIND_CALL   (0) // call the handler
+#define ARM_KIND_BRANCH (1) // B/BL done inline
+#define ARM_KIND_DP     (2) // data processing done inline
+
+static uint32 translate_kind(uint32 insword) {
+  uint32 op = IFIELD(20,8);
+  uint32 dataop = DATAOP(op);
+  if(op >= 0xA0 && op < 0xC0) return ARM_KIND_BRANCH;
+  if(!insdp_specialize(insword)) return ARM_KIND_CALL;
+  if(!(op & 0x20) && (insword & 0x10)) return ARM_KIND_CALL;
+  if(dataop == DATA_ADC || dataop == DATA_SBC || dataop == DATA_RSC) return ARM_KIND_CALL;
+  return ARM_KIND_DP;
+}
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// WebAssembly translator interface
+//
+// A block that has been interpreted ARM_WASM_HOT_RUNS times is described to
+// arm_wasm_compile (emscripten/armwasm.js), which returns a function table
+// index that is then called in place of block_run, or 0 to keep
+// interpreting. The descriptor layout must match armwasm.js.
+//
+#ifdef ENABLE_WASMREC
+
+#define ARM_WASM_HOT_RUNS (16)
+#define ARM_WASM_FAILED   (0xFFFFFFFF)
+
+#define WASMOFS(thefield) ((uint32)offsetof(struct ARM_STATE, thefield))
+
+struct ARM_WASM_DESC {
+  uint32 n;
+  uint32 pc;
+  uint32 ofs_r;
+  uint32 ofs_cpsr;
+  uint32 ofs_lazy_kind;
+  uint32 ofs_lazy_op1;
+  uint32 ofs_lazy_op2;
+  uint32 ofs_lazy_res;
+  uint32 ofs_cycles;
+  uint32 ofs_maxpc;
+  uint32 ofs_gen;
+  uint32 gen;
+  uint32 condtable;
+  uint32 materialize;
+  uint32 reserved;
+  struct { uint32 insword, cond, handler, kind; } ins[ARM_BLOCK_MAXINS];
+};
+
+extern uint32 arm_wasm_compile(const struct ARM_WASM_DESC *desc);
+extern void arm_wasm_release(uint32 fn);
+
+typedef void (*arm_wasm_block_t)(struct ARM_STATE *state);
+
+static void wasm_release(struct ARM_BLOCK *b) {
+  if(b->wasmfn && b->wasmfn != ARM_WASM_FAILED) arm_wasm_release(b->wasmfn);
+  b->wasmfn = 0;
+  b->runs = 0;
+}
+
+static void wasm_release_all(struct ARM_STATE *state) {
+  uint32 i;
+  for(i = 0; i < ARM_BLOCK_COUNT; i++) { wasm_release(state->blocks + i); }
+}
+
+static void wasmcompile(struct ARM_STATE *state, struct ARM_BLOCK *b) {
+  struct ARM_WASM_DESC desc;
+  uint32 i;
+  desc.n             = b->n;
+  desc.pc            = b->pc;
+  desc.ofs_r         = WASMOFS(r);
+  desc.ofs_cpsr      = WASMOFS(cpsr);
+  desc.ofs_lazy_kind = WASMOFS(lazy_kind);
+  desc.ofs_lazy_op1  = WASMOFS(lazy_op1);
+  desc.ofs_lazy_op2  = WASMOFS(lazy_op2);
+  desc.ofs_lazy_res  = WASMOFS(lazy_res);
+  desc.ofs_cycles    = WASMOFS(cycles_remaining);
+  desc.ofs_maxpc     = WASMOFS(maxpc);
+  desc.ofs_gen       = WASMOFS(codepagegen[b->page]);
+  desc.gen           = b->gen;
+  desc.condtable     = (uint32)(size_t)condtable;
+  desc.materialize   = (uint32)(size_t)flags_materialize;
+  desc.reserved      = 0;
+  for(i = 0; i < b->n; i++) {
+    desc.ins[i].insword = b->ins[i].insword;
+    desc.ins[i].cond    = b->ins[i].cond;
+    desc.ins[i].handler = (uint32)(size_t)(b->ins[i].handler);
+    desc.ins[i].kind    = translate_kind(b->ins[i].insword);
+  }
+  b->wasmfn = arm_wasm_compile(&desc);
+  if(!b->wasmfn) b->wasmfn = ARM_WASM_FAILED;
+}
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Decode a block starting at pc
+// Returns NULL if pc isn't in pointer-mapped memory
+//
+static struct ARM_BLOCK *block_build(struct ARM_STATE *state, struct ARM_BLOCK *b, uint32 pc) {
+  struct ARM_MEMORY_MAP *map;
+  uint32 a, n;
+  uint8 *p;
+  map = mmpage(state->map_load, state->pages_load, pc);
+  if(map->type.n != ARM_MAP_TYPE_POINTER) return NULL;
+  p = (uint8*)(map->type.p);
+  a = pc & map->type.mask;
+  b->pc = pc;
+#ifdef ENABLE_DYNAREC
+  b->dynaofs = 0;
+#endif
+#ifdef ENABLE_WASMREC
+  wasm_release(b);
+#endif
+  b->page = (a >> ARM_CODEPAGE_SHIFT) & (ARM_CODEPAGE_COUNT - 1);
+  b->gen = state->codepagegen[b->page];
+  for(n = 0; n < ARM_BLOCK_MAXINS; n++) {
+    struct ARM_DECODED *d = b->ins + n;
+    uint32 insword = *((uint32*)(p + a));
+    d->handler = insdp_specialize(insword);
+    if(!d->handler) d->handler = inscalltable[(insword >> 20) & 0xFF];
+    d->insword = insword;
+    d->cond    = insword >> 28;
+    // stop after anything that always leaves the straight line
+    if(((insword >> 20) & 0xFF) >= 0xA0) { n++; break; }
+    // stop at the end of the code page or wherever another map entry
+    // takes over
+    pc += 4;
+    a = (a + 4) & map->type.mask;
+    if(!(a & ((1 << ARM_CODEPAGE_SHIFT) - 1))) { n++; break; }
+    if(mmpage(state->map_load, state->pages_load, pc) != map) { n++; break; }
+  }
+  b->n = n;
+  b->idle = idle_analyze(b);
+  return b;
+}
+
+static EMU_INLINE struct ARM_BLOCK *block_lookup(struct ARM_STATE *state, uint32 pc) {
+  struct ARM_BLOCK *b = state->blocks + ((pc >> 2) & (ARM_BLOCK_COUNT - 1));
+  if(b->n && b->pc == pc && b->gen == state->codepagegen[b->page]) return b;
+  return block_build(state, b, pc);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Run one block for as long as execution stays on its straight line
+//
+static EMU_INLINE void block_run(struct ARM_STATE *state, struct ARM_BLOCK *b) {
+  const struct ARM_DECODED *d = b->ins;
+  const struct ARM_DECODED *dend = d + b->n;
+  uint32 pc = b->pc;
+  for(;;) {
+    if(d->cond == ARM_COND_AL || condtable[d->cond + (flags_cpsr(state) >> 24)]) {
+      d->handler(state, d->insword);
+    } else {
+      state->r[15] += 4;
+    }
+    state->cycles_remaining -= 2;
+    pc += 4;
+    if(++d == dend) break;
+    if(state->cycles_remaining <= 0) break;
+    if(state->r[15] != pc) break;
+    // the block may have just overwritten itself
+    if(b->gen != state->codepagegen[b->page]) break;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// x86-64 dynarec
+//
+// Each block compiles to a function taking the state pointer (rdi) that does
+// exactly what block_run does: condition checks, cycle accounting and the
+// straight-line/self-modification exits. Simple data processing and B/BL
+// (the same ones the WebAssembly translator takes, see translate_kind) are
+// translated to native code working on the registers in the state; the rest
+// calls the interpreter's handlers. EQ/NE are tested straight from a pending
+// lazy result, since Z is the same for every kind.
+// Registers stay in the state between instructions, so a handler call in
+// between never has to sync anything.
+//
+#ifdef ENABLE_DYNAREC
+
+#define C(N) { *outp++ = ((uint8)(N)); }
+#define C32(N) { *((uint32*)outp) = ((uint32)(N)); outp += 4; }
+#define C64(N) { *((uint64*)outp) = ((uint64)(N)); outp += 8; }
+
+#define STATEOFS(thefield) ((uint32)offsetof(struct ARM_STATE, thefield))
+
+// x86 registers, and the ModRM byte for [rbx+disp32]
+#define X_EAX (0)
+#define X_ECX (1)
+#define X_EDX (2)
+#define MODRM_STATE(R) (0x83 | ((R) << 3))
+
+// mov r32,[rbx+ofs] / mov [rbx+ofs],r32 / mov dword [rbx+ofs],imm
+#define LOAD(R,OFS)      { C(0x8B) C(MODRM_STATE(R)) C32(OFS) }
+#define STORE(OFS,R)     { C(0x89) C(MODRM_STATE(R)) C32(OFS) }
+#define STOREIMM(OFS,V)  { C(0xC7) C(0x83) C32(OFS) C32(V) }
+
+// rel32 jump targets, patched once the target is known
+#define JCC32(CC,FIXUP)  { C(0x0F) C(0x80 | (CC)) FIXUP = outp; C32(0) }
+#define JMP32(FIXUP)     { C(0xE9) FIXUP = outp; C32(0) }
+#define LAND(FIXUP)      { *((uint32*)(FIXUP)) = (uint32)(outp - ((FIXUP) + 4)); }
+
+#define CC_B  (0x2)
+#define CC_E  (0x4)
+#define CC_NE (0x5)
+#define CC_LE (0xE)
+
+typedef void (*arm_dyna_block_t)(struct ARM_STATE *state);
+
+//
+// flags_materialize if anything at or above the given lazy kind is pending;
+// leaves eax, ecx, edx clobbered
+//
+static uint8 *dyna_settle(uint8 *outp, uint32 kind) {
+  uint8 *ok;
+  C(0x83) C(0xBB) C32(STATEOFS(lazy_kind)) C(kind)       // cmp dword [rbx+lazy_kind],kind
+  JCC32(CC_B, ok)                                        // jb ok
+  C(0x48) C(0x89) C(0xDF)                                // mov rdi,rbx
+  C(0x48) C(0xB8) C64(flags_materialize)                 // mov rax,<flags_materialize>
+  C(0xFF) C(0xD0)                                        // call rax
+  LAND(ok)
+  return outp;
+}
+
+//
+// Condition check; *skip is left pointing at a jump to patch to wherever
+// execution goes when the condition fails
+//
+static uint8 *dyna_cond(uint8 *outp, uint32 cond, uint8 **skip) {
+  if(cond <= 1) {
+    uint8 *usecpsr, *test;
+    C(0x83) C(0xBB) C32(STATEOFS(lazy_kind)) C(0x00)     // cmp dword [rbx+lazy_kind],0
+    JCC32(CC_E, usecpsr)                                 // je usecpsr
+    C(0x83) C(0xBB) C32(STATEOFS(lazy_res)) C(0x00)      // cmp dword [rbx+lazy_res],0
+    JMP32(test)                                          // jmp test
+    LAND(usecpsr)
+    LOAD(X_EAX, STATEOFS(cpsr))                          // usecpsr: mov eax,[rbx+cpsr]
+    C(0xF7) C(0xD0)                                      // not eax
+    C(0xA9) C32(PSR_ZMASK)                               // test eax,PSR_ZMASK
+    LAND(test)
+    // ZF is now Z
+    JCC32((cond == 0) ? CC_NE : CC_E, *skip)             // test: jne/je skip
+    return outp;
+  }
+  outp = dyna_settle(outp, LAZY_NZ);
+  LOAD(X_EAX, STATEOFS(cpsr))                            // mov eax,[rbx+cpsr]
+  C(0xC1) C(0xE8) C(0x18)                                // shr eax,24
+  C(0x41) C(0x0F) C(0xB6) C(0x84) C(0x04) C32(cond)      // movzx eax,byte [r12+rax+cond]
+  C(0x85) C(0xC0)                                        // test eax,eax
+  JCC32(CC_E, *skip)                                     // jz skip
+  return outp;
+}
+
+//
+// Data processing, for what translate_kind accepts; mirrors the armops.h
+// handlers. op1 goes in edx, op2 in ecx, the result in eax.
+//
+static uint8 *dyna_dp(uint8 *outp, uint32 insword, uint32 next) {
+  uint32 dataop = DATAOP(IFIELD(20,8));
+  uint32 s = IFIELD(20,1);
+  uint32 rn = IFIELD(16,4);
+  uint32 rd = IFIELD(12,4);
+  uint32 logic = ISLOGIC(dataop << 1);
+  // the flags a logic op leaves alone have to be settled before it goes lazy
+  if(s && logic) outp = dyna_settle(outp, LAZY_ADD);
+  if(insword & 0x02000000) {
+    C(0xB9) C32(insword & 0xFF)                          // mov ecx,imm8
+  } else {
+    LOAD(X_ECX, STATEOFS(r[IFIELD(0,4)]))                // mov ecx,[rbx+rm]
+  }
+  if(dataop != DATA_MOV && dataop != DATA_MVN) {
+    LOAD(X_EDX, STATEOFS(r[rn]))                         // mov edx,[rbx+rn]
+  }
+  switch(dataop) {
+  case DATA_AND: case DATA_TST: C(0x89) C(0xD0) C(0x21) C(0xC8) break; // mov eax,edx / and eax,ecx
+  case DATA_EOR: case DATA_TEQ: C(0x89) C(0xD0) C(0x31) C(0xC8) break; // mov eax,edx / xor eax,ecx
+  case DATA_SUB: case DATA_CMP: C(0x89) C(0xD0) C(0x29) C(0xC8) break; // mov eax,edx / sub eax,ecx
+  case DATA_RSB:                C(0x89) C(0xC8) C(0x29) C(0xD0) break; // mov eax,ecx / sub eax,edx
+  case DATA_ADD: case DATA_CMN: C(0x89) C(0xD0) C(0x01) C(0xC8) break; // mov eax,edx / add eax,ecx
+  case DATA_ORR:                C(0x89) C(0xD0) C(0x09) C(0xC8) break; // mov eax,edx / or eax,ecx
+  case DATA_MOV:                C(0x89) C(0xC8)                 break; // mov eax,ecx
+  case DATA_BIC:                C(0x89) C(0xC8) C(0xF7) C(0xD0) C(0x21) C(0xD0) break; // mov eax,ecx / not eax / and eax,edx
+  case DATA_MVN:                C(0x89) C(0xC8) C(0xF7) C(0xD0) break; // mov eax,ecx / not eax
+  }
+  if(s) {
+    switch(dataop) {
+    case DATA_ADD: case DATA_CMN:
+      STOREIMM(STATEOFS(lazy_kind), LAZY_ADD)
+      STORE(STATEOFS(lazy_op1), X_EDX)
+      STORE(STATEOFS(lazy_op2), X_ECX)
+      break;
+    case DATA_SUB: case DATA_CMP:
+      STOREIMM(STATEOFS(lazy_kind), LAZY_SUB)
+      STORE(STATEOFS(lazy_op1), X_EDX)
+      STORE(STATEOFS(lazy_op2), X_ECX)
+      break;
+    case DATA_RSB:
+      STOREIMM(STATEOFS(lazy_kind), LAZY_SUB)
+      STORE(STATEOFS(lazy_op1), X_ECX)
+      STORE(STATEOFS(lazy_op2), X_EDX)
+      break;
+    default:
+      STOREIMM(STATEOFS(lazy_kind), LAZY_NZ)
+      break;
+    }
+    STORE(STATEOFS(lazy_res), X_EAX)
+  }
+  if(dataop < DATA_TST || dataop > DATA_CMN) {
+    STORE(STATEOFS(r[rd]), X_EAX)                        // mov [rbx+rd],eax
+  }
+  STOREIMM(STATEOFS(r[15]), next)                        // mov dword [rbx+r15],next
+  return outp;
+}
+
+//
+// B/BL
+//
+static uint8 *dyna_branch(uint8 *outp, uint32 insword, uint32 pc) {
+  uint32 target = pc + 8 + ((uint32)((sint32)(insword << 8) >> 6));
+  if(insword & 0x01000000) STOREIMM(STATEOFS(r[14]), pc + 4)
+  STOREIMM(STATEOFS(r[15]), target)                      // mov dword [rbx+r15],target
+  STOREIMM(STATEOFS(maxpc), 0)                           // mov dword [rbx+maxpc],0
+  return outp;
+}
+
+static void dynacompile(struct ARM_STATE *state, struct ARM_BLOCK *b) {
+  uint8 *outp;
+  uint8 *exits[3 * ARM_BLOCK_MAXINS];
+  uint32 nexits = 0;
+  uint32 i, pc = b->pc;
+  //
+  // Out of room: throw everything away and start over
+  //
+  if(
+    (state->dynacode_used < ARM_DYNACODE_SLOP_SIZE) ||
+    (state->dynacode_used + ARM_DYNACODE_BLOCK_SIZE > ARM_DYNACODE_MAX_SIZE)
+  ) {
+    for(i = 0; i < ARM_BLOCK_COUNT; i++) { state->blocks[i].dynaofs = 0; }
+    state->dynacode_used = ARM_DYNACODE_SLOP_SIZE;
+  }
+  b->dynaofs = state->dynacode_used;
+  outp = state->dynacode + b->dynaofs;
+  //
+  // Prefix
+  //
+  C(0x53)                                                  // push rbx
+  C(0x55)                                                  // push rbp
+  C(0x41) C(0x54)                                          // push r12
+  C(0x48) C(0x89) C(0xFB)                                  // mov rbx,rdi
+  C(0x49) C(0xBC) C64(condtable)                           // mov r12,<condtable>
+  //
+  // Each instruction
+  //
+  for(i = 0; i < b->n; i++, pc += 4) {
+    const struct ARM_DECODED *d = b->ins + i;
+    uint32 kind = translate_kind(d->insword);
+    uint8 *skip = NULL, *done;
+    if(d->cond != ARM_COND_AL) outp = dyna_cond(outp, d->cond, &skip);
+    switch(kind) {
+    case ARM_KIND_BRANCH:
+      outp = dyna_branch(outp, d->insword, pc);
+      break;
+    case ARM_KIND_DP:
+      outp = dyna_dp(outp, d->insword, pc + 4);
+      break;
+    default:
+      C(0x48) C(0x89) C(0xDF)                              // mov rdi,rbx
+      C(0xBE) C32(d->insword)                              // mov esi,insword
+      C(0x48) C(0xB8) C64(d->handler)                      // mov rax,<handler>
+      C(0xFF) C(0xD0)                                      // call rax
+      break;
+    }
+    if(skip) {
+      JMP32(done)                                          // jmp done
+      LAND(skip)
+      STOREIMM(STATEOFS(r[15]), pc + 4)                    // skip: mov dword [rbx+r15],next
+      LAND(done)
+    }
+    C(0x83) C(0xAB) C32(STATEOFS(cycles_remaining)) C(0x02) // done: sub dword [rbx+cycles_remaining],2
+    if(i + 1 < b->n) {
+      JCC32(CC_LE, exits[nexits]) nexits++;                // jle exit
+      // inline data processing can't leave the straight line or write memory
+      if(kind != ARM_KIND_DP) {
+        C(0x81) C(0xBB) C32(STATEOFS(r[15])) C32(pc + 4)   // cmp dword [rbx+r15],next
+        JCC32(CC_NE, exits[nexits]) nexits++;              // jne exit
+        C(0x81) C(0xBB) C32(STATEOFS(codepagegen[b->page])) C32(b->gen) // cmp dword [rbx+gen],gen
+        JCC32(CC_NE, exits[nexits]) nexits++;              // jne exit
+      }
+    }
+  }
+  //
+  // Suffix
+  //
+  for(i = 0; i < nexits; i++) { LAND(exits[i]) }
+  C(0x41) C(0x5C)                                          // exit: pop r12
+  C(0x5D)                                                  // pop rbp
+  C(0x5B)                                                  // pop rbx
+  C(0xC3)                                                  // ret
+  state->dynacode_used = (uint32)(outp - state->dynacode);
+}
+
+static EMU_INLINE void block_run_dyna(struct ARM_STATE *state, struct ARM_BLOCK *b) {
+  if(!(b->dynaofs)) dynacompile(state, b);
+  ((arm_dyna_block_t)(state->dynacode + b->dynaofs))(state);
+}
+
+#endif
+
+//
+// Interpret until hot, then run the translated block (if translation worked)
+//
+#ifdef ENABLE_WASMREC
+static EMU_INLINE void block_run_wasm(struct ARM_STATE *state, struct ARM_BLOCK *b) {
+  if(!(b->wasmfn) && ++(b->runs) >= ARM_WASM_HOT_RUNS) wasmcompile(state, b);
+  if(b->wasmfn && b->wasmfn != ARM_WASM_FAILED) {
+    ((arm_wasm_block_t)(size_t)(b->wasmfn))(state);
+  } else {
+    block_run(state, b);
+  }
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Returns 0 or positive on success
@@ -990,11 +2009,34 @@ sint32 EMU_CALL arm_execute(void *state, sint32 cycles, uint8 fiq) {
   ARMSTATE->maxpc = 0;
 
   while(ARMSTATE->cycles_remaining > 0) {
+    struct ARM_BLOCK *b;
 //armsubtimeon();
    // hw_sync(state);
 
 //armcount++;
 
+    //
+    // predecoded path; anything not in pointer-mapped memory (or misaligned)
+    // falls through to plain fetch-and-dispatch below
+    //
+    if(!(ARMSTATE->r[15] & 3)) {
+      b = block_lookup(ARMSTATE, ARMSTATE->r[15]);
+      if(b) {
+#ifdef ENABLE_DYNAREC
+        if(
+          ARMSTATE->dyna_enabled &&
+          ARMSTATE->dyna_prepared == (size_t)(ARMSTATE->dynacode)
+        ) { block_run_dyna(ARMSTATE, b); } else
+#endif
+#ifdef ENABLE_WASMREC
+        if(ARMSTATE->wasm_enabled) { block_run_wasm(ARMSTATE, b); } else
+#endif
+        block_run(ARMSTATE, b);
+        if(b->idle && ARMSTATE->idle_enabled) idle_skip(ARMSTATE, b);
+        continue;
+      }
+    }
+
     instruction = fetch(ARMSTATE);
 
 //armcount = (uint32)(ARMSTATE->maxpc);
@@ -1003,7 +2045,7 @@ sint32 EMU_CALL arm_execute(void *state, sint32 cycles, uint8 fiq) {
 //printf("%08X: %08X\n",ARMSTATE->r[15], instruction);
 
     // instruction may be skipped due to condition
-    if(!condtable[(instruction >> 28) + ((ARMSTATE->cpsr) >> 24)]) {
+    if(!condtable[(instruction >> 28) + (flags_cpsr(ARMSTATE) >> 24)]) {
       ARMSTATE->r[15] += 4;
       ARMSTATE->cycles_remaining -= 2;
       continue;
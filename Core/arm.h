@@ -20,6 +20,7 @@ void   EMU_CALL arm_clear_state(void *state);
 typedef uint32 (EMU_CALL * arm_load_callback_t   )(void *hwstate, uint32 a,           uint32 dmask);
 typedef void   (EMU_CALL * arm_store_callback_t  )(void *hwstate, uint32 a, uint32 d, uint32 dmask);
 typedef void   (EMU_CALL * arm_advance_callback_t)(void *hwstate, uint32 cycles);
+typedef uint32 (EMU_CALL * arm_idle_callback_t   )(void *hwstate, uint32 a);
 
 struct ARM_MEMORY_TYPE { uint32 mask, n; void *p; };
 struct ARM_MEMORY_MAP { uint32 x, y; struct ARM_MEMORY_TYPE type; };
@@ -47,6 +48,52 @@ void   EMU_CALL arm_setreg(void *state, sint32 regnum, uint32 value);
 
 void   EMU_CALL arm_break(void *state);
 
+//
+// Discards predecoded code; call after modifying memory other than through
+// the ARM's own stores
+//
+void   EMU_CALL arm_invalidate_code(void *state);
+
+//
+// Per-page write counters for pointer-mapped memory, indexed by
+// (region offset >> ARM_WRITEGEN_SHIFT) & (ARM_WRITEGEN_COUNT - 1)
+// Every store bumps its page; arm_invalidate_code bumps them all
+//
+#define ARM_WRITEGEN_SHIFT (12)
+#define ARM_WRITEGEN_COUNT (2048)
+const uint32* EMU_CALL arm_get_write_generations(void *state);
+
+//
+// Idle loop skipping; on by default
+// arm_get_idle_pcs fills in up to max loop addresses and returns how many
+// were found; arm_get_idle_cycles returns the total cycles skipped
+//
+void   EMU_CALL arm_enable_idle_skip(void *state, uint8 enable);
+uint32 EMU_CALL arm_get_idle_pcs(void *state, uint32 *pcs, uint32 max);
+uint64 EMU_CALL arm_get_idle_cycles(void *state);
+
+//
+// Optional; lets a loop that polls one callback-mapped address be skipped
+// too. Called with the (masked) address, right after the loop's read of it,
+// it returns how many cycles that address is sure to keep reading the same,
+// or 0 if it can't say. Without one, only loops that load from
+// pointer-mapped memory alone are skipped.
+//
+void   EMU_CALL arm_set_idle_callback(void *state, arm_idle_callback_t idle);
+
+//
+// x86-64 Linux dynarec, or the WebAssembly translator in Emscripten builds
+// made with ARM_WASM_DYNAREC; a no-op elsewhere
+// Enabling makes the state's code buffer executable, and returns negative
+// (leaving the dynarec off) if it can't. If the state is moved, call
+// arm_prepare_dynacode again at the new address; until then it interprets.
+// Disable it (or unprepare) before freeing or clearing the state, so
+// translated blocks held outside it are released.
+//
+sint32 EMU_CALL arm_enable_dynarec(void *state, uint8 enable);
+sint32 EMU_CALL arm_prepare_dynacode(void *state);
+void   EMU_CALL arm_unprepare_dynacode(void *state);
+
 //
 // Returns 0 or positive on success
 // Returns negative on error
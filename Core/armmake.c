@@ -0,0 +1,237 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// armmake - Generates operand-specialized ARM data processing handlers
+//            and the condition table
+//
+// Usage: armmake [output path]
+//
+// Writes armops.h, which is included by arm.c.
+//
+// The generic INSDATA handlers decode everything at run time: multiply and
+// PSR transfer special cases, the form of operand 2, whether the result is
+// written and whether it lands in r15. For the forms that make up nearly
+// all real code, this generates one handler per operation, S bit and form,
+// so none of those questions get asked again at run time:
+//
+//   imm     #imm8 with no rotation
+//   reg     Rm, LSL #0
+//   lsl/lsr/asr/ror  Rm, <shift> Rs
+//
+// arm.c only selects these when none of Rd/Rn/Rm/Rs is r15, so the
+// handlers never deal with pc-relative operands or branching.
+// Everything else keeps using the generic handlers.
+//
+// Shift expressions and the (lazy) flag updates are copied from INSDATA, so
+// results match it bit for bit.
+//
+// The condition table is emitted as const data too, so arm_init() has
+// nothing to build.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FILENAME_OUTPUT "armops.h"
+
+static const char *opname[16] = {
+  "and", "eor", "sub", "rsb", "add", "adc", "sbc", "rsc",
+  "tst", "teq", "cmp", "cmn", "orr", "mov", "bic", "mvn"
+};
+
+enum { FORM_IMM, FORM_REG, FORM_LSL, FORM_LSR, FORM_ASR, FORM_ROR, FORMS };
+
+static const char *formname[FORMS] = {
+  "imm", "reg", "lsl", "lsr", "asr", "ror"
+};
+
+static int is_test (int op) { return (op >= 0x8) && (op <= 0xB); }
+static int is_logic(int op) { return (op <= 0x1) || (op == 0x8) || (op == 0x9) || (op >= 0xC); }
+static int uses_rn (int op) { return (op != 0xD) && (op != 0xF); }
+
+//
+// Test ops without S are PSR transfers, never generated
+//
+static int is_generated(int op, int s) { return s || !is_test(op); }
+
+static void handler_name(char *buf, int op, int s, int form) {
+  sprintf(buf, "insdp_%s%s_%s", opname[op], s ? "s" : "", formname[form]);
+}
+
+static void write_operand2(FILE *f, int op, int s, int form) {
+  int setc = s && is_logic(op);
+  switch(form) {
+  case FORM_IMM:
+    fprintf(f, "  operand2 = IFIELD(0,8);\n");
+    break;
+  case FORM_REG:
+    fprintf(f, "  operand2 = state->r[IFIELD(0,4)];\n");
+    break;
+  default:
+    fprintf(f, "  operand2 = state->r[IFIELD(0,4)];\n");
+    fprintf(f, "  shiftby = state->r[IFIELD(8,4)];\n");
+    fprintf(f, "  if(shiftby) {\n");
+    switch(form) {
+    case FORM_LSL:
+      if(setc) fprintf(f, "    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }\n    C_TO_CPSR;\n");
+      fprintf(f, "    operand2 <<= shiftby;\n");
+      break;
+    case FORM_LSR:
+      if(setc) fprintf(f, "    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }\n    C_TO_CPSR;\n");
+      fprintf(f, "    operand2 >>= shiftby;\n");
+      break;
+    case FORM_ASR:
+      if(setc) fprintf(f, "    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }\n    C_TO_CPSR;\n");
+      fprintf(f, "    operand2 = ((sint32)(((sint32)operand2) >> shiftby));\n");
+      break;
+    case FORM_ROR:
+      if(setc) fprintf(f, "    c = operand2 >> ((shiftby-1)&31);\n    C_TO_CPSR;\n");
+      fprintf(f, "    shiftby &= 31;\n");
+      fprintf(f, "    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));\n");
+      break;
+    }
+    fprintf(f, "  }\n");
+    break;
+  }
+}
+
+static void write_operation(FILE *f, int op, int s) {
+  switch(op) {
+  case 0x0: case 0x8: fprintf(f, "  result = operand1 & operand2;\n"); break;
+  case 0x1: case 0x9: fprintf(f, "  result = operand1 ^ operand2;\n"); break;
+  case 0xC: fprintf(f, "  result = operand1 | operand2;\n"); break;
+  case 0xD: fprintf(f, "  result = operand2;\n"); break;
+  case 0xE: fprintf(f, "  result = operand1 & (~operand2);\n"); break;
+  case 0xF: fprintf(f, "  result = operand2 ^ 0xFFFFFFFF;\n"); break;
+  case 0x4: case 0x5: case 0xB:
+    fprintf(f, "  result = operand1 + operand2;\n");
+    if(op == 0x5) fprintf(f, "  result += flags_c(state);\n");
+    if(s) fprintf(f, "  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);\n");
+    return;
+  case 0x2: case 0x3: case 0x6: case 0x7: case 0xA:
+    if(op == 0x3 || op == 0x7) {
+      fprintf(f, "  result = operand1; operand1 = operand2; operand2 = result;\n");
+    }
+    fprintf(f, "  result = operand1 - operand2;\n");
+    if(op == 0x6 || op == 0x7) {
+      fprintf(f, "  result += flags_c(state);\n");
+      fprintf(f, "  result--;\n");
+    }
+    if(s) fprintf(f, "  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);\n");
+    return;
+  }
+  if(s) fprintf(f, "  NZ_TO_LAZY(result);\n");
+}
+
+static void write_handler(FILE *f, int op, int s, int form) {
+  char name[64];
+  int setc = s && is_logic(op) && (form >= FORM_LSL);
+  handler_name(name, op, s, form);
+  fprintf(f, "static void EMU_CALL %s(struct ARM_STATE *state, uint32 insword) {\n", name);
+  fprintf(f, "  uint32 result, %soperand2;\n", uses_rn(op) ? "operand1, " : "");
+  if(setc) fprintf(f, "  uint32 c;\n");
+  if(form >= FORM_LSL) fprintf(f, "  uint8 shiftby;\n");
+  write_operand2(f, op, s, form);
+  if(uses_rn(op)) fprintf(f, "  operand1 = state->r[IFIELD(16,4)];\n");
+  write_operation(f, op, s);
+  if(!is_test(op)) fprintf(f, "  state->r[IFIELD(12,4)] = result;\n");
+  fprintf(f, "  state->r[15] += 4;\n");
+  fprintf(f, "}\n\n");
+}
+
+//
+// rows: values of nzcv, columns: instruction condition field
+//
+static void write_condtable(FILE *f) {
+  int nzcv, cond;
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// Condition table: [(nzcv << 4) + condition], nonzero if it passes\n");
+  fprintf(f, "//\n");
+  fprintf(f, "static const uint8 condtable[256] = {\n");
+  for(nzcv = 0; nzcv < 16; nzcv++) {
+    int n = (nzcv >> 3) & 1;
+    int z = (nzcv >> 2) & 1;
+    int c = (nzcv >> 1) & 1;
+    int v = (nzcv >> 0) & 1;
+    fprintf(f, "  ");
+    for(cond = 0; cond < 16; cond++) {
+      int truth = 0;
+      switch(cond & 0xE) {
+      case 0x0: /* EQ */ truth = z; break;
+      case 0x2: /* CS */ truth = c; break;
+      case 0x4: /* MI */ truth = n; break;
+      case 0x6: /* VS */ truth = v; break;
+      case 0x8: /* HI */ truth = ((!z) && c); break;
+      case 0xA: /* GE */ truth = (n == v); break;
+      case 0xC: /* GT */ truth = ((!z) && (n == v)); break;
+      case 0xE: /* AL */ truth = 1; break;
+      }
+      if(cond & 1) { truth = !truth; }
+      fprintf(f, "%d,", truth ? 1 : 0);
+    }
+    fprintf(f, " // nzcv=%X\n", nzcv);
+  }
+  fprintf(f, "};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+  char filename[1024];
+  char name[64];
+  FILE *f;
+  int op, s, form;
+
+  sprintf(filename, "%s%s%s",
+    (argc > 1) ? argv[1] : "",
+    ((argc > 1) && argv[1][0] && argv[1][strlen(argv[1]) - 1] != '/') ? "/" : "",
+    FILENAME_OUTPUT
+  );
+  f = fopen(filename, "wt");
+  if(!f) { perror(filename); return 1; }
+
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// armops - Operand-specialized data processing handlers, condition table\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// GENERATED BY armmake.c - DO NOT EDIT\n");
+  fprintf(f, "// Included by arm.c\n");
+  fprintf(f, "//\n");
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n\n");
+
+  write_condtable(f);
+
+  for(op = 0; op < 16; op++) {
+    for(s = 0; s < 2; s++) {
+      if(!is_generated(op, s)) continue;
+      for(form = 0; form < FORMS; form++) write_handler(f, op, s, form);
+    }
+  }
+
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// [operation][S][form], NULL where there is no specialized handler\n");
+  fprintf(f, "//\n");
+  fprintf(f, "#define INSDP_FORM_IMM (%d)\n", FORM_IMM);
+  fprintf(f, "#define INSDP_FORM_REG (%d)\n", FORM_REG);
+  fprintf(f, "#define INSDP_FORM_RSR (%d)\n", FORM_LSL);
+  fprintf(f, "#define INSDP_FORMS    (%d)\n\n", FORMS);
+  fprintf(f, "static const inscallback insdptable[16][2][INSDP_FORMS] = {\n");
+  for(op = 0; op < 16; op++) {
+    fprintf(f, "// %s\n", opname[op]);
+    fprintf(f, "  {\n");
+    for(s = 0; s < 2; s++) {
+      fprintf(f, "    {");
+      for(form = 0; form < FORMS; form++) {
+        if(is_generated(op, s)) { handler_name(name, op, s, form); } else { strcpy(name, "NULL"); }
+        fprintf(f, "%s%s", name, (form + 1 < FORMS) ? "," : "");
+      }
+      fprintf(f, "}%s\n", (s == 0) ? "," : "");
+    }
+    fprintf(f, "  }%s\n", (op < 15) ? "," : "");
+  }
+  fprintf(f, "};\n\n");
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n");
+  fclose(f);
+  return 0;
+}
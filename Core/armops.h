@@ -0,0 +1,2453 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// armops - Operand-specialized data processing handlers, condition table
+//
+// GENERATED BY armmake.c - DO NOT EDIT
+// Included by arm.c
+//
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Condition table: [(nzcv << 4) + condition], nonzero if it passes
+//
+static const uint8 condtable[256] = {
+  0,1,0,1,0,1,0,1,0,1,1,0,1,0,1,0, // nzcv=0
+  0,1,0,1,0,1,1,0,0,1,0,1,0,1,1,0, // nzcv=1
+  0,1,1,0,0,1,0,1,1,0,1,0,1,0,1,0, // nzcv=2
+  0,1,1,0,0,1,1,0,1,0,0,1,0,1,1,0, // nzcv=3
+  1,0,0,1,0,1,0,1,0,1,1,0,0,1,1,0, // nzcv=4
+  1,0,0,1,0,1,1,0,0,1,0,1,0,1,1,0, // nzcv=5
+  1,0,1,0,0,1,0,1,0,1,1,0,0,1,1,0, // nzcv=6
+  1,0,1,0,0,1,1,0,0,1,0,1,0,1,1,0, // nzcv=7
+  0,1,0,1,1,0,0,1,0,1,0,1,0,1,1,0, // nzcv=8
+  0,1,0,1,1,0,1,0,0,1,1,0,1,0,1,0, // nzcv=9
+  0,1,1,0,1,0,0,1,1,0,0,1,0,1,1,0, // nzcv=A
+  0,1,1,0,1,0,1,0,1,0,1,0,1,0,1,0, // nzcv=B
+  1,0,0,1,1,0,0,1,0,1,0,1,0,1,1,0, // nzcv=C
+  1,0,0,1,1,0,1,0,0,1,1,0,0,1,1,0, // nzcv=D
+  1,0,1,0,1,0,0,1,0,1,0,1,0,1,1,0, // nzcv=E
+  1,0,1,0,1,0,1,0,0,1,1,0,0,1,1,0, // nzcv=F
+};
+
+static void EMU_CALL insdp_and_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_and_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_and_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_and_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_and_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_and_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_ands_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_ands_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_ands_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_ands_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_ands_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_ands_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eor_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eor_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eor_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eor_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eor_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eor_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eors_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eors_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eors_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eors_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eors_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_eors_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sub_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sub_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sub_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sub_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sub_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sub_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_subs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_subs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_subs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_subs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_subs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_subs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsb_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsb_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsb_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsb_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsb_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsb_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsbs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsbs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsbs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsbs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsbs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsbs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_add_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_add_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_add_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_add_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_add_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_add_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adds_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adds_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adds_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adds_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adds_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adds_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adc_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adc_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adc_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adc_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adc_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adc_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adcs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adcs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adcs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adcs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adcs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_adcs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  result += flags_c(state);
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbc_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbc_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbc_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbc_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbc_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbc_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbcs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbcs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbcs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbcs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbcs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_sbcs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsc_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsc_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsc_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsc_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsc_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rsc_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rscs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rscs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rscs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rscs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rscs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_rscs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1; operand1 = operand2; operand2 = result;
+  result = operand1 - operand2;
+  result += flags_c(state);
+  result--;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_tsts_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_tsts_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_tsts_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_tsts_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_tsts_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_tsts_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_teqs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_teqs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_teqs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_teqs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_teqs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_teqs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 ^ operand2;
+  NZ_TO_LAZY(result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmps_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmps_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmps_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmps_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmps_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmps_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 - operand2;
+  ARITH_TO_LAZY(LAZY_SUB, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmns_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmns_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmns_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmns_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmns_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_cmns_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 + operand2;
+  ARITH_TO_LAZY(LAZY_ADD, operand1, operand2, result);
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orr_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orr_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orr_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orr_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orr_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orr_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orrs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orrs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orrs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orrs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orrs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_orrs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 | operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mov_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = IFIELD(0,8);
+  result = operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mov_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  result = operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mov_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  result = operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mov_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  result = operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mov_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  result = operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mov_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  result = operand2;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_movs_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = IFIELD(0,8);
+  result = operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_movs_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  result = operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_movs_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  result = operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_movs_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  result = operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_movs_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  result = operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_movs_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  result = operand2;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bic_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bic_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bic_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bic_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bic_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bic_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bics_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = IFIELD(0,8);
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bics_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bics_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bics_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bics_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_bics_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand1, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  operand1 = state->r[IFIELD(16,4)];
+  result = operand1 & (~operand2);
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvn_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = IFIELD(0,8);
+  result = operand2 ^ 0xFFFFFFFF;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvn_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  result = operand2 ^ 0xFFFFFFFF;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvn_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 <<= shiftby;
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvn_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 >>= shiftby;
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvn_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvn_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvns_imm(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = IFIELD(0,8);
+  result = operand2 ^ 0xFFFFFFFF;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvns_reg(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  operand2 = state->r[IFIELD(0,4)];
+  result = operand2 ^ 0xFFFFFFFF;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvns_lsl(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (32-shiftby); }
+    C_TO_CPSR;
+    operand2 <<= shiftby;
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvns_lsr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby > 32) { c = 0; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 >>= shiftby;
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvns_asr(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    if(shiftby >= 32) { c = operand2 >> 31; } else { c = operand2 >> (shiftby-1); }
+    C_TO_CPSR;
+    operand2 = ((sint32)(((sint32)operand2) >> shiftby));
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+static void EMU_CALL insdp_mvns_ror(struct ARM_STATE *state, uint32 insword) {
+  uint32 result, operand2;
+  uint32 c;
+  uint8 shiftby;
+  operand2 = state->r[IFIELD(0,4)];
+  shiftby = state->r[IFIELD(8,4)];
+  if(shiftby) {
+    c = operand2 >> ((shiftby-1)&31);
+    C_TO_CPSR;
+    shiftby &= 31;
+    operand2 = (operand2 >> shiftby) | (operand2 << (32-shiftby));
+  }
+  result = operand2 ^ 0xFFFFFFFF;
+  NZ_TO_LAZY(result);
+  state->r[IFIELD(12,4)] = result;
+  state->r[15] += 4;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// [operation][S][form], NULL where there is no specialized handler
+//
+#define INSDP_FORM_IMM (0)
+#define INSDP_FORM_REG (1)
+#define INSDP_FORM_RSR (2)
+#define INSDP_FORMS    (6)
+
+static const inscallback insdptable[16][2][INSDP_FORMS] = {
+// and
+  {
+    {insdp_and_imm,insdp_and_reg,insdp_and_lsl,insdp_and_lsr,insdp_and_asr,insdp_and_ror},
+    {insdp_ands_imm,insdp_ands_reg,insdp_ands_lsl,insdp_ands_lsr,insdp_ands_asr,insdp_ands_ror}
+  },
+// eor
+  {
+    {insdp_eor_imm,insdp_eor_reg,insdp_eor_lsl,insdp_eor_lsr,insdp_eor_asr,insdp_eor_ror},
+    {insdp_eors_imm,insdp_eors_reg,insdp_eors_lsl,insdp_eors_lsr,insdp_eors_asr,insdp_eors_ror}
+  },
+// sub
+  {
+    {insdp_sub_imm,insdp_sub_reg,insdp_sub_lsl,insdp_sub_lsr,insdp_sub_asr,insdp_sub_ror},
+    {insdp_subs_imm,insdp_subs_reg,insdp_subs_lsl,insdp_subs_lsr,insdp_subs_asr,insdp_subs_ror}
+  },
+// rsb
+  {
+    {insdp_rsb_imm,insdp_rsb_reg,insdp_rsb_lsl,insdp_rsb_lsr,insdp_rsb_asr,insdp_rsb_ror},
+    {insdp_rsbs_imm,insdp_rsbs_reg,insdp_rsbs_lsl,insdp_rsbs_lsr,insdp_rsbs_asr,insdp_rsbs_ror}
+  },
+// add
+  {
+    {insdp_add_imm,insdp_add_reg,insdp_add_lsl,insdp_add_lsr,insdp_add_asr,insdp_add_ror},
+    {insdp_adds_imm,insdp_adds_reg,insdp_adds_lsl,insdp_adds_lsr,insdp_adds_asr,insdp_adds_ror}
+  },
+// adc
+  {
+    {insdp_adc_imm,insdp_adc_reg,insdp_adc_lsl,insdp_adc_lsr,insdp_adc_asr,insdp_adc_ror},
+    {insdp_adcs_imm,insdp_adcs_reg,insdp_adcs_lsl,insdp_adcs_lsr,insdp_adcs_asr,insdp_adcs_ror}
+  },
+// sbc
+  {
+    {insdp_sbc_imm,insdp_sbc_reg,insdp_sbc_lsl,insdp_sbc_lsr,insdp_sbc_asr,insdp_sbc_ror},
+    {insdp_sbcs_imm,insdp_sbcs_reg,insdp_sbcs_lsl,insdp_sbcs_lsr,insdp_sbcs_asr,insdp_sbcs_ror}
+  },
+// rsc
+  {
+    {insdp_rsc_imm,insdp_rsc_reg,insdp_rsc_lsl,insdp_rsc_lsr,insdp_rsc_asr,insdp_rsc_ror},
+    {insdp_rscs_imm,insdp_rscs_reg,insdp_rscs_lsl,insdp_rscs_lsr,insdp_rscs_asr,insdp_rscs_ror}
+  },
+// tst
+  {
+    {NULL,NULL,NULL,NULL,NULL,NULL},
+    {insdp_tsts_imm,insdp_tsts_reg,insdp_tsts_lsl,insdp_tsts_lsr,insdp_tsts_asr,insdp_tsts_ror}
+  },
+// teq
+  {
+    {NULL,NULL,NULL,NULL,NULL,NULL},
+    {insdp_teqs_imm,insdp_teqs_reg,insdp_teqs_lsl,insdp_teqs_lsr,insdp_teqs_asr,insdp_teqs_ror}
+  },
+// cmp
+  {
+    {NULL,NULL,NULL,NULL,NULL,NULL},
+    {insdp_cmps_imm,insdp_cmps_reg,insdp_cmps_lsl,insdp_cmps_lsr,insdp_cmps_asr,insdp_cmps_ror}
+  },
+// cmn
+  {
+    {NULL,NULL,NULL,NULL,NULL,NULL},
+    {insdp_cmns_imm,insdp_cmns_reg,insdp_cmns_lsl,insdp_cmns_lsr,insdp_cmns_asr,insdp_cmns_ror}
+  },
+// orr
+  {
+    {insdp_orr_imm,insdp_orr_reg,insdp_orr_lsl,insdp_orr_lsr,insdp_orr_asr,insdp_orr_ror},
+    {insdp_orrs_imm,insdp_orrs_reg,insdp_orrs_lsl,insdp_orrs_lsr,insdp_orrs_asr,insdp_orrs_ror}
+  },
+// mov
+  {
+    {insdp_mov_imm,insdp_mov_reg,insdp_mov_lsl,insdp_mov_lsr,insdp_mov_asr,insdp_mov_ror},
+    {insdp_movs_imm,insdp_movs_reg,insdp_movs_lsl,insdp_movs_lsr,insdp_movs_asr,insdp_movs_ror}
+  },
+// bic
+  {
+    {insdp_bic_imm,insdp_bic_reg,insdp_bic_lsl,insdp_bic_lsr,insdp_bic_asr,insdp_bic_ror},
+    {insdp_bics_imm,insdp_bics_reg,insdp_bics_lsl,insdp_bics_lsr,insdp_bics_asr,insdp_bics_ror}
+  },
+// mvn
+  {
+    {insdp_mvn_imm,insdp_mvn_reg,insdp_mvn_lsl,insdp_mvn_lsr,insdp_mvn_asr,insdp_mvn_ror},
+    {insdp_mvns_imm,insdp_mvns_reg,insdp_mvns_lsl,insdp_mvns_lsr,insdp_mvns_asr,insdp_mvns_ror}
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////
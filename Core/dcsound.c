@@ -66,6 +66,7 @@ uint32 EMU_CALL dcsound_get_state_size(void) {
 
 static void recompute_memory_maps(struct DCSOUND_STATE *state);
 static void EMU_CALL dcsound_advance(void *state, uint32 elapse);
+static uint32 EMU_CALL dcsound_yam_idle(void *state, uint32 a);
 
 void EMU_CALL dcsound_clear_state(void *state) {
   uint32 offset;
@@ -90,10 +91,12 @@ void EMU_CALL dcsound_clear_state(void *state) {
 
   arm_clear_state(ARMSTATE);
   arm_set_advance_callback(ARMSTATE, dcsound_advance, DCSOUNDSTATE);
+  arm_set_idle_callback(ARMSTATE, dcsound_yam_idle);
   arm_set_memory_maps(ARMSTATE, MAPLOAD, MAPSTORE);
 
   yam_clear_state(YAMSTATE, 2);
   yam_setram(YAMSTATE, (uint32*)(RAMBYTEPTR), 0x800000, EMU_ENDIAN_XOR(3), EMU_ENDIAN_XOR(2));
+  yam_setramwritegen(YAMSTATE, arm_get_write_generations(ARMSTATE), ARM_WRITEGEN_SHIFT, ARM_WRITEGEN_COUNT);
   //
   // We want to initialize the Yamaha interrupt system here, because some
   // homebrew DC stuff expects it'll start at the BIOS-initialized values
@@ -154,8 +157,10 @@ static void location_check(struct DCSOUND_STATE *state) {
   if(state->myself != state) {
     recompute_memory_maps(state);
     arm_set_advance_callback(ARMSTATE, dcsound_advance, DCSOUNDSTATE);
+    arm_set_idle_callback(ARMSTATE, dcsound_yam_idle);
     arm_set_memory_maps(ARMSTATE, MAPLOAD, MAPSTORE);
     yam_setram(YAMSTATE, (uint32*)(RAMBYTEPTR), 0x800000, EMU_ENDIAN_XOR(3), EMU_ENDIAN_XOR(2));
+    yam_setramwritegen(YAMSTATE, arm_get_write_generations(ARMSTATE), ARM_WRITEGEN_SHIFT, ARM_WRITEGEN_COUNT);
     state->myself = state;
   }
 }
@@ -252,6 +257,43 @@ static uint32 cycles_until_next_interrupt(
   return yamcycles - state->cycles_ahead_of_sound;
 }
 
+//
+// Same for any timer, including those that only set a pending bit
+//
+static uint32 cycles_until_next_timer(
+  struct DCSOUND_STATE *state
+) {
+  uint32 yamsamples;
+  uint32 yamcycles;
+  timeswitch(state, TIMEYAM);
+  yamsamples = yam_get_min_samples_until_timer(YAMSTATE);
+  timeswitch(state, TIMEDCSOUND);
+  if(yamsamples > 0x10000) { yamsamples = 0x10000; }
+  yamcycles = yamsamples * CYCLES_PER_SAMPLE;
+  if(yamcycles <= state->cycles_ahead_of_sound) return 0;
+  return yamcycles - state->cycles_ahead_of_sound;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// How long an AICA register the ARM is polling will keep its value
+// (CALLBACK)
+//
+// The interrupt enable/pending/level registers and INTRequest only change
+// on a timer event or a store, and an idle loop doesn't store, so they hold
+// until the next timer expires. Anything else (timer counts, PlayStatus,
+// PlayPos) can move on any sample.
+//
+static uint32 EMU_CALL dcsound_yam_idle(void *state, uint32 a) {
+  uint32 r;
+  a &= 0xFFFC;
+  if(!((a >= 0x289C && a <= 0x28BC) || a == 0x2D00)) return 0;
+  timeswitch(DCSOUNDSTATE, TIMEDCSOUND);
+  r = cycles_until_next_timer(DCSOUNDSTATE);
+  timeswitch(DCSOUNDSTATE, TIMEARM);
+  return r;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Invalid-address catchers
@@ -420,6 +462,7 @@ uint32 EMU_CALL dcsound_getword(void *state, uint32 a) {
 
 void EMU_CALL dcsound_setword(void *state, uint32 a, uint32 d) {
   *((uint32*)(RAMBYTEPTR+(a&0x7FFFFC))) = d;
+  arm_invalidate_code(ARMSTATE);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -437,6 +480,7 @@ void EMU_CALL dcsound_upload_to_ram(
     (RAMBYTEPTR)[((address+i)^(EMU_ENDIAN_XOR(3)))&0x7FFFFF] =
       ((uint8*)src)[i];
   }
+  arm_invalidate_code(ARMSTATE);
 }
 
 /////////////////////////////////////////////////////////////////////////////
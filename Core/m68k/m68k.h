@@ -41,6 +41,13 @@
 
 #include "macros.h"
 
+/* The layout of m68ki_cpu_core depends on the switches in m68kconf.h, which
+ * must be included first so that every file sees the same structure.
+ */
+#ifndef M68KCONF__HEADER
+#error "include m68kconf.h before m68k.h"
+#endif
+
 
 /* ======================================================================== */
 /* ==================== ARCHITECTURE-DEPENDANT DEFINES ==================== */
@@ -57,11 +64,9 @@
 #undef sint8
 #undef sint16
 #undef sint32
-#undef sint64
 #undef uint8
 #undef uint16
 #undef uint32
-#undef uint64
 #undef sint
 #undef uint
 
@@ -77,10 +82,18 @@
 #define uint   unsigned int
 
 
+/* 64-bit types are left as the host defined them (emuconfig.h), if it did,
+ * so that files using both agree on them */
 #if M68K_USE_64_BIT
+#ifndef sint64
 #define sint64 signed   long long
+#endif
+#ifndef uint64
 #define uint64 unsigned long long
+#endif
 #else
+#undef sint64
+#undef uint64
 #define sint64 sint32
 #define uint64 uint32
 #endif /* M68K_USE_64_BIT */
@@ -226,8 +239,49 @@ typedef struct
   uint pc;
   uint cycle;
   uint detected;
+  uint value;    /* what the polled location returned last time */
+  uint64 skipped; /* cycles skipped in confirmed idle loops */
 } cpu_idle_t;
 
+#if M68K_DECODE_CACHE
+/* 68k decoded instruction cache
+ * An entry only saves the fetch, the dispatch and the cycle lookup.  The
+ * handlers still work out their effective addresses, reading the extension
+ * words through the fetch window, so nothing about operands is kept here.
+ */
+#define M68K_DECODE_ENTRIES    4096  /* direct-mapped on the pc */
+#define M68K_DECODE_PAGE_SHIFT 9     /* invalidation granularity */
+#define M68K_DECODE_PAGES      (M68K_DECODE_RANGE >> M68K_DECODE_PAGE_SHIFT)
+
+struct _m68ki_cpu_core;
+
+typedef struct
+{
+  uint pc;                                        /* opcode address, odd when empty */
+  uint gen;                                       /* generation of its page when decoded */
+  void (*handler)(struct _m68ki_cpu_core *m68k);  /* opcode handler */
+  uint16 ir;                                      /* opcode */
+  uint16 cycles;                                  /* base cycles */
+} cpu_decoded_t;
+#endif
+
+#if M68K_DYNAREC
+/* 68k compiled blocks */
+#define M68K_DYNA_BLOCKS       1024     /* direct-mapped on the pc */
+#define M68K_DYNA_MAXINS       16       /* instructions per block */
+#define M68K_DYNACODE_SIZE     0x40000
+#define M68K_DYNACODE_SLOP     0x10
+#define M68K_DYNACODE_BLOCK    (M68K_DYNA_MAXINS * 0xC0 + 0x40) /* worst case for one block, with room to spare */
+
+typedef struct
+{
+  uint pc;                                        /* start address, odd when empty */
+  uint gen;                                       /* generation of its page when compiled */
+  uint page;                                      /* page it lies on */
+  uint dynaofs;                                   /* offset of its code in dynacode */
+} cpu_dynablock_t;
+#endif
+
 typedef struct _m68ki_cpu_core
 {
   cpu_memory_map memory_map[256]; /* memory mapping */
@@ -261,6 +315,22 @@ typedef struct _m68ki_cpu_core
 #if M68K_EMULATE_PREFETCH
   uint pref_addr;    /* Last prefetch address */
   uint pref_data;    /* Data in the prefetch queue */
+#endif
+#if M68K_FETCH_WINDOW
+  uint fetch_start;  /* Address the fetch window starts at */
+  uint fetch_size;   /* Addresses below fetch_start + fetch_size can be read as a long, 0 if unset */
+  const unsigned char *fetch_base; /* Host address of fetch_start, looked up again on every m68k_execute() */
+#endif
+#if M68K_DECODE_CACHE
+  uint dc_gen[M68K_DECODE_PAGES];       /* Bumped on every write to the page */
+  cpu_decoded_t dc[M68K_DECODE_ENTRIES]; /* Decoded instructions */
+#endif
+#if M68K_DYNAREC
+  uint dyna_enabled; /* Run compiled blocks */
+  const unsigned char *dyna_prepared; /* Where dynacode was made executable; only compared, so a moved core interprets until prepared again */
+  uint dyna_used;    /* Bytes of dynacode in use */
+  cpu_dynablock_t dyna_blocks[M68K_DYNA_BLOCKS];
+  unsigned char dynacode[M68K_DYNACODE_SIZE]; /* Position independent; the core is passed in */
 #endif
   uint sr_mask;      /* Implemented status register bits */
 #if M68K_EMULATE_ADDRESS_ERROR
@@ -299,7 +369,6 @@ typedef struct _m68ki_cpu_core
   uint virq_state;
   uint nmi_pending;
 
-  const unsigned char* cyc_instruction;
   const unsigned char* cyc_exception;
 
   /* Callbacks to host */
@@ -398,6 +467,24 @@ extern int m68k_execute(m68ki_cpu_core *, unsigned int cycles);
 #define RESET_LINE 0
 void m68k_set_irq(m68ki_cpu_core *m68k, int irqline, int state);
 
+#if M68K_DECODE_CACHE
+/* Tell the CPU that code at the given address may have been modified by
+ * something other than the CPU itself.
+ */
+extern void m68k_invalidate_code(m68ki_cpu_core *, unsigned int address);
+#endif
+
+#if M68K_DYNAREC
+/* Run compiled code instead of interpreting.  Enabling makes the core's code
+ * buffer executable, and returns -1 (leaving the dynarec off) if it can't.
+ * If the core moves, call m68k_prepare_dynacode() again at the new address;
+ * until then it interprets.  Disable it before freeing the core.
+ */
+extern int m68k_enable_dynarec(m68ki_cpu_core *, int enable);
+extern int m68k_prepare_dynacode(m68ki_cpu_core *);
+extern void m68k_unprepare_dynacode(m68ki_cpu_core *);
+#endif
+
 /* Halt the CPU as if you pulsed the HALT pin. */
 extern void m68k_pulse_halt(m68ki_cpu_core *);
 extern void m68k_clear_halt(m68ki_cpu_core *);
@@ -101,11 +101,7 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_PROTOTYPE_FOOTER
 
 
-/* Build the opcode handler table */
-void m68ki_build_opcode_table(void);
-
-extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
-extern unsigned char m68ki_cycles[][0x10000];
+/* The dispatch tables themselves are declared in m68kcpu.h */
 
 
 /* ======================================================================== */
@@ -120,134 +116,21 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_HEADER
 
 /* ======================================================================== */
-/* ========================= OPCODE TABLE BUILDER ========================= */
+/* ========================= OPCODE DISPATCH TABLES ======================= */
 /* ======================================================================== */
 
 #include "m68kops.h"
 
-#define NUM_CPU_TYPES 5
-
-void  (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
-unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
-
-/* This is used to generate the opcode handler jump table */
-typedef struct
-{
-	void (*opcode_handler)(m68ki_cpu_core *m68k);        /* handler function */
-	unsigned int  mask;                  /* mask on opcode */
-	unsigned int  match;                 /* what to match after masking */
-	unsigned char cycles[NUM_CPU_TYPES]; /* cycles each cpu type takes */
-} opcode_handler_struct;
-
-
-/* Opcode handler table */
-static const opcode_handler_struct m68k_opcode_handler_table[] =
+/* Opcode classes: each distinct handler with its 68000 cycle count */
+const m68ki_opcode_class m68ki_opcode_classes[] =
 {
-/*   function                      mask    match    000  010  020  040 */
+/*   function                      000 */
 
 
 
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_FOOTER
 
-	{0, 0, 0, {0, 0, 0, 0, 0}}
-};
-
-
-/* Build the opcode handler jump table */
-void m68ki_build_opcode_table(void)
-{
-	const opcode_handler_struct *ostruct;
-	int instr;
-	int i;
-	int j;
-	int k;
-
-	for(i = 0; i < 0x10000; i++)
-	{
-		/* default to illegal */
-		m68ki_instruction_jump_table[i] = m68k_op_illegal;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][i] = 0;
-	}
-
-	ostruct = m68k_opcode_handler_table;
-	while(ostruct->mask != 0xff00)
-	{
-		for(i = 0;i < 0x10000;i++)
-		{
-			if((i & ostruct->mask) == ostruct->match)
-			{
-				m68ki_instruction_jump_table[i] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][i] = ostruct->cycles[k];
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xff00)
-	{
-		for(i = 0;i <= 0xff;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1f8)
-	{
-		for(i = 0;i < 8;i++)
-		{
-			for(j = 0;j < 8;j++)
-			{
-				instr = ostruct->match | (i << 9) | j;
-				m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][instr] = ostruct->cycles[k];
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff0)
-	{
-		for(i = 0;i <= 0x0f;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1ff)
-	{
-		for(i = 0;i <= 0x07;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | (i << 9)] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff8)
-	{
-		for(i = 0;i <= 0x07;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xffff)
-	{
-		m68ki_instruction_jump_table[ostruct->match] = ostruct->opcode_handler;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
-		ostruct++;
-	}
-}
-
 
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
@@ -259,10 +142,6 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_OPCODE_HANDLER_HEADER
 
 #include "m68kcpu.h"
-#include "mame.h"
-extern void m68040_fpu_op0(m68ki_cpu_core *m68k);
-extern void m68040_fpu_op1(m68ki_cpu_core *m68k);
-extern void m68881_mmu_ops(m68ki_cpu_core *m68k);
 
 /* ======================================================================== */
 /* ========================= INSTRUCTION HANDLERS ========================= */
@@ -894,22 +773,12 @@ M68KMAKE_OP(1111, 0, ., .)
 
 M68KMAKE_OP(040fpu0, 32, ., .)
 {
-	if(CPU_TYPE_IS_030_PLUS(m68k->cpu_type))
-	{
-		m68040_fpu_op0(m68k);
-		return;
-	}
 	m68ki_exception_1111(m68k);
 }
 
 
 M68KMAKE_OP(040fpu1, 32, ., .)
 {
-	if(CPU_TYPE_IS_030_PLUS(m68k->cpu_type))
-	{
-		m68040_fpu_op1(m68k);
-		return;
-	}
 	m68ki_exception_1111(m68k);
 }
 
@@ -3120,11 +2989,6 @@ M68KMAKE_OP(bftst, 32, ., .)
 
 M68KMAKE_OP(bkpt, 0, ., .)
 {
-	if(CPU_TYPE_IS_010_PLUS(m68k->cpu_type))
-	{
-		if (m68k->bkpt_ack_callback != NULL)
-			(*m68k->bkpt_ack_callback)(m68k->device, CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type) ? m68k->ir & 7 : 0);
-	}
 	m68ki_exception_illegal(m68k);
 }
 
@@ -3287,8 +3151,6 @@ M68KMAKE_OP(callm, 32, ., .)
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		REG_PC += 2;
 (void)ea;	/* just to avoid an 'unused variable' warning */
-		logerror("%s at %08x: called unimplemented instruction %04x (callm)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_illegal(m68k);
@@ -4224,9 +4086,6 @@ M68KMAKE_OP(cmpi, 32, ., d)
 	UINT32 dst = DY;
 	UINT32 res = dst - src;
 
-	if (m68k->cmpild_instr_callback != NULL)
-		(*m68k->cmpild_instr_callback)(m68k->device, src, m68k->ir & 7);
-
 	m68k->n_flag = NFLAG_32(res);
 	m68k->not_z_flag = MASK_OUT_ABOVE_32(res);
 	m68k->v_flag = VFLAG_SUB_32(src, dst, res);
@@ -4365,8 +4224,6 @@ M68KMAKE_OP(cpbcc, 32, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type))
 	{
-		logerror( "%s at %08x: called unimplemented instruction %04x (cpbcc)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_1111(m68k);
@@ -4377,8 +4234,6 @@ M68KMAKE_OP(cpdbcc, 32, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type))
 	{
-		logerror("%s at %08x: called unimplemented instruction %04x (cpdbcc)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_1111(m68k);
@@ -4389,8 +4244,6 @@ M68KMAKE_OP(cpgen, 32, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type))
 	{
-		logerror("%s at %08x: called unimplemented instruction %04x (cpgen)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_1111(m68k);
@@ -4401,8 +4254,6 @@ M68KMAKE_OP(cpscc, 32, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type))
 	{
-		logerror("%s at %08x: called unimplemented instruction %04x (cpscc)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_1111(m68k);
@@ -4413,8 +4264,6 @@ M68KMAKE_OP(cptrapcc, 32, ., .)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type))
 	{
-		logerror("%s at %08x: called unimplemented instruction %04x (cptrapcc)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_1111(m68k);
@@ -7997,21 +7846,11 @@ M68KMAKE_OP(pea, 32, ., .)
 
 M68KMAKE_OP(pflush, 32, ., .)
 {
-	if ((CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type)) && (m68k->has_pmmu))
-	{
-		logerror("68040: unhandled PFLUSH\n");
-		return;
-	}
 	m68ki_exception_1111(m68k);
 }
 
 M68KMAKE_OP(pmmu, 32, ., .)
 {
-	if ((CPU_TYPE_IS_EC020_PLUS(m68k->cpu_type)) && (m68k->has_pmmu))
-	{
-		m68881_mmu_ops(m68k);
-	}
-	else
 	{
 		m68ki_exception_1111(m68k);
 	}
@@ -8021,8 +7860,6 @@ M68KMAKE_OP(reset, 0, ., .)
 {
 	if(m68k->s_flag)
 	{
-		if (m68k->reset_instr_callback != NULL)
-			(*m68k->reset_instr_callback)(m68k->device);
 		m68k->remaining_cycles -= m68k->cyc_reset;
 		return;
 	}
@@ -8727,8 +8564,6 @@ M68KMAKE_OP(rte, 32, ., .)
 		UINT32 new_pc;
 		UINT32 format_word;
 
-		if (m68k->rte_instr_callback != NULL)
-			(*m68k->rte_instr_callback)(m68k->device);
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 
 		if(CPU_TYPE_IS_000(m68k->cpu_type))
@@ -8738,8 +8573,10 @@ M68KMAKE_OP(rte, 32, ., .)
 			m68ki_jump(m68k, new_pc);
 			m68ki_set_sr(m68k, new_sr);
 
+#if M68K_EMULATE_ADDRESS_ERROR
 			m68k->instr_mode = INSTRUCTION_YES;
 			m68k->run_mode = RUN_MODE_NORMAL;
+#endif
 
 			return;
 		}
@@ -8754,12 +8591,16 @@ M68KMAKE_OP(rte, 32, ., .)
 				m68ki_fake_pull_16(m68k);	/* format word */
 				m68ki_jump(m68k, new_pc);
 				m68ki_set_sr(m68k, new_sr);
+#if M68K_EMULATE_ADDRESS_ERROR
 				m68k->instr_mode = INSTRUCTION_YES;
 				m68k->run_mode = RUN_MODE_NORMAL;
+#endif
 				return;
 			}
+#if M68K_EMULATE_ADDRESS_ERROR
 			m68k->instr_mode = INSTRUCTION_YES;
 			m68k->run_mode = RUN_MODE_NORMAL;
+#endif
 			/* Not handling bus fault (9) */
 			m68ki_exception_format_error(m68k);
 			return;
@@ -8776,8 +8617,10 @@ rte_loop:
 				m68ki_fake_pull_16(m68k);	/* format word */
 				m68ki_jump(m68k, new_pc);
 				m68ki_set_sr(m68k, new_sr);
+#if M68K_EMULATE_ADDRESS_ERROR
 				m68k->instr_mode = INSTRUCTION_YES;
 				m68k->run_mode = RUN_MODE_NORMAL;
+#endif
 				return;
 			case 1: /* Throwaway */
 				new_sr = m68ki_pull_16(m68k);
@@ -8792,13 +8635,17 @@ rte_loop:
 				m68ki_fake_pull_32(m68k);	/* address */
 				m68ki_jump(m68k, new_pc);
 				m68ki_set_sr(m68k, new_sr);
+#if M68K_EMULATE_ADDRESS_ERROR
 				m68k->instr_mode = INSTRUCTION_YES;
 				m68k->run_mode = RUN_MODE_NORMAL;
+#endif
 				return;
 		}
 		/* Not handling long or short bus fault */
+#if M68K_EMULATE_ADDRESS_ERROR
 		m68k->instr_mode = INSTRUCTION_YES;
 		m68k->run_mode = RUN_MODE_NORMAL;
+#endif
 		m68ki_exception_format_error(m68k);
 		return;
 	}
@@ -8811,8 +8658,6 @@ M68KMAKE_OP(rtm, 32, ., .)
 	if(CPU_TYPE_IS_020_VARIANT(m68k->cpu_type))
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
-		logerror("%s at %08x: called unimplemented instruction %04x (rtm)\n",
-					 m68k->device->tag, REG_PC - 2, m68k->ir);
 		return;
 	}
 	m68ki_exception_illegal(m68k);
@@ -9688,8 +9533,6 @@ M68KMAKE_OP(tas, 8, ., .)
        disabled in order to function properly.  Some Amiga software may also rely
        on this, but only when accessing specific addresses so additional functionality
        will be needed. */
-	if (m68k->tas_instr_callback != NULL)
-		allow_writeback = (*m68k->tas_instr_callback)(m68k->device);
 
 	if (allow_writeback)
 		m68ki_write_8(m68k, ea, dst | 0x80);
@@ -15,6 +15,15 @@
 #define OPT_ON              1
 #define OPT_SPECIFY_HANDLER 2
 
+/* CPU types other than the 68000.
+ * The opcode tables m68kmake generates carry 68000 cycle counts only, and
+ * there is no m68k_set_cpu_type(), so these must stay OFF: m68kcpu.h
+ * refuses to build otherwise.
+ */
+#define M68K_EMULATE_010            OPT_OFF
+#define M68K_EMULATE_EC020          OPT_OFF
+#define M68K_EMULATE_020            OPT_OFF
+
 /* If ON, the CPU will call m68k_write_32_pd() when it executes move.l with a
  * predecrement destination EA mode instead of m68k_write_32().
  * To simulate real 68k behavior, m68k_write_32_pd() must first write the high
@@ -72,6 +81,39 @@
  */
 #define M68K_CHECK_PC_ADDRESS_ERROR OPT_OFF
 
+/* If ON, instruction words are read straight from a host pointer to the
+ * memory-based (ROM, RAM) area the PC is in, which is only looked up again
+ * in the memory map once the PC leaves it. The memory map must not change
+ * while m68k_execute() is running.
+ * NOTE: Cannot be used together with M68K_EMULATE_PREFETCH.
+ */
+#define M68K_FETCH_WINDOW           OPT_ON
+
+/* If ON, the CPU keeps a cache of decoded instructions (handler and cycles)
+ * for code in the first M68K_DECODE_RANGE bytes of memory-based (ROM, RAM)
+ * address space, so that it doesn't have to go through the memory map and
+ * opcode tables on every instruction.  Effective addresses are still worked
+ * out by the opcode handlers.
+ * Writes done by the CPU invalidate it, anything else that modifies code in
+ * that range must call m68k_invalidate_code().
+ * NOTE: Cannot be used together with M68K_EMULATE_PREFETCH.
+ */
+#define M68K_DECODE_CACHE           OPT_ON
+#define M68K_DECODE_RANGE           0x80000
+
+/* If ON, runs of instructions from the decoded instruction cache are compiled
+ * to x86-64 code.  Register and immediate forms of MOVE, the ALU instructions,
+ * Bcc and DBcc become native code, anything else calls its opcode handler.
+ * Needs M68K_DECODE_CACHE; m68k_enable_dynarec() makes the core's code buffer
+ * executable.
+ * NOTE: Only available on x86-64 Linux, where mprotect is always there.
+ */
+#if defined(__x86_64__) && defined(__linux__) && !defined(EMSCRIPTEN)
+#define M68K_DYNAREC                M68K_DECODE_CACHE
+#else
+#define M68K_DYNAREC                OPT_OFF
+#endif
+
 
 /* ----------------------------- COMPATIBILITY ---------------------------- */
 
@@ -37,6 +37,12 @@ static const char copyright_notice[] =
 #include "m68kcpu.h"
 #include "m68kops.h"
 
+#if M68K_DYNAREC
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 /* ======================================================================== */
 /* ================================= DATA ================================= */
 /* ======================================================================== */
@@ -507,6 +513,872 @@ static int m68k_translate( m68ki_cpu_core *m68k, unsigned int *address )
 	return TRUE;
 }
 
+#if M68K_FETCH_WINDOW
+/* Point the fetch window at the memory-based area around pc, taking in the
+ * neighbouring banks for as long as they continue the same host memory
+ */
+static void m68ki_set_fetch_window(m68ki_cpu_core *m68k, uint pc)
+{
+	const cpu_memory_map *map = m68k->memory_map;
+	uint first = (pc >> 16) & 0xff;
+	uint last = first;
+
+	m68k->fetch_size = 0;
+	if(!map[first].base || map[first].read16)
+		return;
+	while(first > 0 && map[first - 1].base && !map[first - 1].read16 &&
+	      map[first - 1].base + 0x10000 == map[first].base)
+		first--;
+	while(last < 0xff && map[last + 1].base && !map[last + 1].read16 &&
+	      map[last].base + 0x10000 == map[last + 1].base)
+		last++;
+
+	m68k->fetch_start = (pc & 0xff000000) | (first << 16);
+	m68k->fetch_size  = ((last - first + 1) << 16) - 3;
+	m68k->fetch_base  = map[first].base;
+}
+
+UINT32 m68ki_fetch_16(m68ki_cpu_core *m68k, uint pc)
+{
+	m68ki_set_fetch_window(m68k, pc);
+	if(pc - m68k->fetch_start < m68k->fetch_size)
+		return *(const uint16 *)(m68k->fetch_base + (pc - m68k->fetch_start));
+	return m68k_read_immediate_16(m68k, pc);
+}
+
+UINT32 m68ki_fetch_32(m68ki_cpu_core *m68k, uint pc)
+{
+	m68ki_set_fetch_window(m68k, pc);
+	if(pc - m68k->fetch_start < m68k->fetch_size)
+	{
+		const uint16 *p = (const uint16 *)(m68k->fetch_base + (pc - m68k->fetch_start));
+		return (p[0] << 16) | p[1];
+	}
+	return m68k_read_immediate_32(m68k, pc);
+}
+#endif
+
+#if M68K_DECODE_CACHE
+/* Empty the decoded instruction cache */
+static void m68ki_decode_flush(m68ki_cpu_core *m68k)
+{
+	uint i;
+	for(i = 0; i < M68K_DECODE_ENTRIES; i++)
+		m68k->dc[i].pc = 1;
+#if M68K_DYNAREC
+	for(i = 0; i < M68K_DYNA_BLOCKS; i++)
+		m68k->dyna_blocks[i].pc = 1;
+	m68k->dyna_used = 0;
+#endif
+}
+
+/* Decode the instruction at pc into d, if it can be cached at all: the opcode
+ * must be memory-based
+ */
+static int m68ki_decode(m68ki_cpu_core *m68k, cpu_decoded_t *d, uint pc)
+{
+	uint address = pc & 0xffffff;
+	const cpu_memory_map *temp = &m68k->memory_map[(address >> 16) & 0xff];
+
+	if((address & 1) || address >= M68K_DECODE_RANGE)
+		return 0;
+	if(!temp->base || temp->read16)
+		return 0;
+
+	d->pc      = pc;
+	d->gen     = m68k->dc_gen[address >> M68K_DECODE_PAGE_SHIFT];
+	d->ir      = m68k_read_immediate_16(m68k, address);
+	d->handler = m68ki_opcode(d->ir)->handler;
+	d->cycles  = m68ki_opcode(d->ir)->cycles;
+	return 1;
+}
+
+/* Execute one instruction, through the decoded instruction cache if possible */
+INLINE void m68ki_execute_decoded(m68ki_cpu_core *m68k)
+{
+	uint pc = REG_PC;
+	uint i = (pc >> 1) & (M68K_DECODE_ENTRIES - 1);
+	cpu_decoded_t *d = &m68k->dc[i];
+
+	/* only cacheable addresses ever get a tag, so the page index is in range;
+	 * empty entries are tagged 1, which an odd pc could still match */
+	if((d->pc != pc || (pc & 1) || d->gen != m68k->dc_gen[(pc & 0xffffff) >> M68K_DECODE_PAGE_SHIFT]) && !m68ki_decode(m68k, d, pc))
+	{
+		const m68ki_opcode_class *op;
+		m68k->ir = m68ki_read_imm_16(m68k);
+		op = m68ki_opcode(m68k->ir);
+		op->handler(m68k);
+		m68k->remaining_cycles -= op->cycles;
+		return;
+	}
+
+	REG_PC = pc + 2;
+	m68k->ir = d->ir;
+	d->handler(m68k);
+	m68k->remaining_cycles -= d->cycles;
+}
+
+void m68k_invalidate_code(m68ki_cpu_core *m68k, unsigned int address)
+{
+	m68ki_code_written(m68k, address);
+}
+#endif
+
+#if M68K_DYNAREC
+/* Compiled blocks run the common register and immediate forms of MOVE and
+ * the ALU instructions, and Bcc and DBcc, as native code on the registers in
+ * the core; everything else calls its opcode handler, with the fetch, the
+ * dispatch and the cycle accounting done inline.  A block keeps going for as
+ * long as execution falls through to the next instruction on the same
+ * unmodified page, and a branch back to its start loops without leaving it.
+ */
+typedef void (*m68ki_dyna_block_t)(m68ki_cpu_core *m68k);
+
+#define C(N) { *outp++ = ((uint8)(N)); }
+#define C32(N) { *((uint32*)outp) = ((uint32)(N)); outp += 4; }
+#define C64(N) { *((uint64*)outp) = ((uint64)(N)); outp += 8; }
+
+#define CPUOFS(field) ((uint32)offsetof(m68ki_cpu_core, field))
+
+static int m68ki_dynacode_protect(m68ki_cpu_core *m68k, int prot)
+{
+	unsigned long startaddr = (unsigned long)(&m68k->dynacode);
+	unsigned long length    = sizeof(m68k->dynacode);
+	int           psize     = getpagesize();
+	unsigned long addr      = (startaddr & ~(psize - 1));
+	return mprotect((char *)addr, length + startaddr - addr + psize, prot);
+}
+
+/* Enabling makes the code buffer executable if it isn't already, and fails
+ * (leaving the dynarec off) if that can't be done; disabling undoes it.
+ */
+int m68k_enable_dynarec(m68ki_cpu_core *m68k, int enable)
+{
+	if(enable && m68k->dyna_prepared != m68k->dynacode)
+	{
+		if(m68k_prepare_dynacode(m68k) < 0)
+		{
+			m68k->dyna_enabled = 0;
+			return -1;
+		}
+	}
+	if(!enable && m68k->dyna_prepared)
+		m68k_unprepare_dynacode(m68k);
+	m68k->dyna_enabled = (enable != 0);
+	return 0;
+}
+
+int m68k_prepare_dynacode(m68ki_cpu_core *m68k)
+{
+	if(m68ki_dynacode_protect(m68k, PROT_READ | PROT_WRITE | PROT_EXEC) != 0)
+	{
+		m68k->dyna_prepared = NULL;
+		return -1;
+	}
+	m68k->dyna_prepared = m68k->dynacode;
+	return 0;
+}
+
+void m68k_unprepare_dynacode(m68ki_cpu_core *m68k)
+{
+	m68ki_dynacode_protect(m68k, PROT_READ | PROT_WRITE);
+	m68k->dyna_prepared = NULL;
+}
+
+/* Extension words used by an effective address */
+static uint m68ki_ea_words(uint mode, uint reg, uint is_long)
+{
+	switch(mode)
+	{
+		case 5: case 6:
+			return 1;
+		case 7:
+			switch(reg)
+			{
+				case 0: case 2: case 3: return 1;
+				case 1: return 2;
+				case 4: return is_long ? 2 : 1;
+			}
+			return 0;
+	}
+	return 0;
+}
+
+/* Length of a 68000 instruction in words.  Only used to know where the next
+ * instruction of a block starts; if it's wrong, the pc check after the
+ * instruction just ends the block there.
+ */
+static uint m68ki_instruction_length(uint ir)
+{
+	uint mode = (ir >> 3) & 7;
+	uint reg  = ir & 7;
+	uint size = (ir >> 6) & 3;
+
+	switch(ir >> 12)
+	{
+		case 0x0:
+			if(ir & 0x0100)
+				return mode == 1 ? 2 : 1 + m68ki_ea_words(mode, reg, 0);  /* MOVEP / bit ops on Dn */
+			if((ir & 0x0f00) == 0x0800)
+				return 2 + m68ki_ea_words(mode, reg, 0);                  /* bit ops on #imm */
+			if((ir & 0xbf) == 0x3c)
+				return 2;                                                /* to CCR / SR */
+			return 1 + (size == 2 ? 2 : 1) + m68ki_ea_words(mode, reg, size == 2);
+		case 0x1: case 0x2: case 0x3:
+			return 1 + m68ki_ea_words(mode, reg, (ir >> 12) == 2) + m68ki_ea_words((ir >> 6) & 7, (ir >> 9) & 7, 0);
+		case 0x4:
+			if((ir & 0xfff8) == 0x4e50 || ir == 0x4e72)
+				return 2;                                                /* LINK / STOP */
+			if((ir & 0xffc0) == 0x4e40)
+				return 1;                                                /* TRAP, UNLK, MOVE USP, ... */
+			if((ir & 0xfb80) == 0x4880 && mode >= 2)
+				return 2 + m68ki_ea_words(mode, reg, 0);                  /* MOVEM */
+			if((ir & 0xf1c0) == 0x4180)
+				return 1 + m68ki_ea_words(mode, reg, 0);                  /* CHK */
+			return 1 + m68ki_ea_words(mode, reg, size == 2);
+		case 0x5:
+			return (ir & 0xf8) == 0xc8 ? 2 : 1 + m68ki_ea_words(mode, reg, 0); /* DBcc, ADDQ/SUBQ/Scc */
+		case 0x6:
+			return (ir & 0xff) ? 1 : 2;
+		case 0x7: case 0xa: case 0xf:
+			return 1;
+		case 0x8: case 0xc:
+			return 1 + m68ki_ea_words(mode, reg, size == 2);
+		case 0x9: case 0xb: case 0xd:
+			return 1 + m68ki_ea_words(mode, reg, size == 3 ? (ir & 0x0100) != 0 : size == 2);
+		case 0xe:
+			return (size == 3) ? 1 + m68ki_ea_words(mode, reg, 0) : 1;
+	}
+	return 1;
+}
+
+/* Instructions that never fall through */
+static int m68ki_block_ends(uint ir)
+{
+	if((ir >> 8) == 0x60 || (ir >> 8) == 0x61)
+		return 1;                                                    /* BRA / BSR */
+	if((ir & 0xff80) == 0x4e80)
+		return 1;                                                    /* JSR / JMP */
+	if(ir == 0x4e72 || ir == 0x4e73 || ir == 0x4e75 || ir == 0x4e77)
+		return 1;                                                    /* STOP / RTE / RTS / RTR */
+	if((ir & 0xfff0) == 0x4e40 || ir == 0x4afc)
+		return 1;                                                    /* TRAP / ILLEGAL */
+	return (ir >> 12) == 0xa || (ir >> 12) == 0xf;
+}
+
+/* x86 registers used by the inline code */
+#define X_EAX 0
+#define X_ECX 1
+#define X_EDX 2
+#define X_ESI 6
+#define X_EDI 7
+
+/* x86 ALU opcodes, reg,reg form; the /digit of the imm32 form is op >> 3 */
+#define X_ADD 0x01
+#define X_OR  0x09
+#define X_AND 0x21
+#define X_SUB 0x29
+#define X_XOR 0x31
+#define X_MOV 0x89
+
+/* mov/movzx/movsx r,[rbx+ofs] */
+static uint8 *m68ki_dyna_load(uint8 *outp, uint r, uint32 ofs, uint size, uint sext)
+{
+	if(size == 4)
+		C(0x8B)
+	else
+	{
+		C(0x0F) C((size == 1 ? 0xB6 : 0xB7) | (sext ? 0x08 : 0))
+	}
+	C(0x83 | (r << 3)) C32(ofs)
+	return outp;
+}
+
+/* mov [rbx+ofs],r, only the low size bytes; byte stores only from eax-edx */
+static uint8 *m68ki_dyna_store(uint8 *outp, uint r, uint32 ofs, uint size)
+{
+	if(size == 2)
+		C(0x66)
+	C(size == 1 ? 0x88 : 0x89) C(0x83 | (r << 3)) C32(ofs)
+	return outp;
+}
+
+/* op dst,src */
+static uint8 *m68ki_dyna_alu(uint8 *outp, uint op, uint dst, uint src)
+{
+	C(op) C(0xC0 | (src << 3) | dst)
+	return outp;
+}
+
+/* op r,imm; mov r,imm for X_MOV */
+static uint8 *m68ki_dyna_alu_imm(uint8 *outp, uint op, uint r, uint32 imm)
+{
+	if(op == X_MOV)
+		C(0xB8 + r)
+	else
+	{
+		C(0x81) C(0xC0 | (op & 0x38) | r)
+	}
+	C32(imm)
+	return outp;
+}
+
+/* shr r,n */
+static uint8 *m68ki_dyna_shr(uint8 *outp, uint r, uint n)
+{
+	if(n)
+	{
+		C(0xC1) C(0xE8 | r) C(n)
+	}
+	return outp;
+}
+
+/* Instructions done inline.  The flags come out exactly as the opcode
+ * handlers leave them, high garbage bits included, since the other handlers
+ * and the SR read them as they are.
+ */
+enum
+{
+	M68KI_DYNA_MOVE = 1,  /* dst = src, flags as MOVE; CLR is a MOVE of 0 */
+	M68KI_DYNA_TST,       /* flags as MOVE only */
+	M68KI_DYNA_ADD,
+	M68KI_DYNA_SUB,
+	M68KI_DYNA_CMP,
+	M68KI_DYNA_AND,
+	M68KI_DYNA_OR,
+	M68KI_DYNA_EOR,
+	M68KI_DYNA_MOVEA,     /* address register forms, no flags, long result */
+	M68KI_DYNA_ADDA,
+	M68KI_DYNA_SUBA,
+	M68KI_DYNA_CMPA,      /* long compare */
+	M68KI_DYNA_BCC,
+	M68KI_DYNA_DBCC
+};
+
+typedef struct
+{
+	uint kind;
+	uint size;  /* operand bytes; word sources of address forms are sign extended */
+	uint src;   /* register number 0-15, or 16 for an immediate */
+	uint32 imm; /* immediate source, or branch target */
+	uint dst;   /* register number 0-15 */
+	uint cond;  /* condition of Bcc and DBcc */
+} m68ki_dyna_insn;
+
+/* Source operand: Dn, An (not for bytes) or an immediate after the opcode */
+static int m68ki_dyna_source(m68ki_cpu_core *m68k, m68ki_dyna_insn *d, uint ir, uint address, uint size)
+{
+	uint mode = (ir >> 3) & 7;
+	uint reg  = ir & 7;
+
+	if(mode == 0 || (mode == 1 && size != 1))
+	{
+		d->src = (mode << 3) | reg;
+		return 1;
+	}
+	if(mode == 7 && reg == 4)
+	{
+		d->src = 16;
+		if(size == 4)
+			d->imm = m68k_read_immediate_32(m68k, address + 2);
+		else
+			d->imm = m68k_read_immediate_16(m68k, address + 2) & (size == 1 ? 0xff : 0xffff);
+		return 1;
+	}
+	return 0;
+}
+
+/* Decode an instruction that can be done inline.  Register numbers are
+ * 0-7 for D0-D7 and 8-15 for A0-A7, as in dar[].
+ */
+static int m68ki_dyna_decode(m68ki_cpu_core *m68k, m68ki_dyna_insn *d, uint ir, uint address)
+{
+	static const uint8 sizes[4] = { 1, 2, 4, 0 };
+	uint mode  = (ir >> 3) & 7;
+	uint reg   = ir & 7;
+	uint rx    = (ir >> 9) & 7;
+	uint size  = sizes[(ir >> 6) & 3];
+	uint opmode = (ir >> 6) & 7;
+
+	d->size = size;
+	switch(ir >> 12)
+	{
+		case 0x0:                                                    /* ORI ANDI SUBI ADDI EORI CMPI #imm,Dn */
+			if(mode != 0 || !size || (ir & 0x0100))
+				return 0;
+			switch((ir >> 9) & 7)
+			{
+				case 0: d->kind = M68KI_DYNA_OR;  break;
+				case 1: d->kind = M68KI_DYNA_AND; break;
+				case 2: d->kind = M68KI_DYNA_SUB; break;
+				case 3: d->kind = M68KI_DYNA_ADD; break;
+				case 5: d->kind = M68KI_DYNA_EOR; break;
+				case 6: d->kind = M68KI_DYNA_CMP; break;
+				default: return 0;
+			}
+			d->dst = reg;
+			return m68ki_dyna_source(m68k, d, 0x3c, address, size);
+		case 0x1: case 0x2: case 0x3:                                /* MOVE, MOVEA <Dn|An|#imm>,<Dn|An> */
+			size = (ir >> 12) == 1 ? 1 : (ir >> 12) == 2 ? 4 : 2;
+			d->size = size;
+			if(opmode == 0)
+				d->kind = M68KI_DYNA_MOVE;
+			else if(opmode == 1 && size != 1)
+				d->kind = M68KI_DYNA_MOVEA;
+			else
+				return 0;
+			d->dst = (opmode << 3) | rx;
+			return m68ki_dyna_source(m68k, d, ir, address, size);
+		case 0x4:                                                    /* CLR Dn, TST Dn */
+			if(mode != 0 || !size)
+				return 0;
+			d->dst = reg;
+			if((ir & 0xff00) == 0x4200)
+			{
+				d->kind = M68KI_DYNA_MOVE;
+				d->src  = 16;
+				d->imm  = 0;
+				return 1;
+			}
+			if((ir & 0xff00) == 0x4a00)
+			{
+				d->kind = M68KI_DYNA_TST;
+				d->src  = reg;
+				return 1;
+			}
+			return 0;
+		case 0x5:
+			if(size && mode <= 1 && !(mode == 1 && size == 1))       /* ADDQ SUBQ #q,<Dn|An> */
+			{
+				if(mode == 1)
+				{
+					d->kind = (ir & 0x0100) ? M68KI_DYNA_SUBA : M68KI_DYNA_ADDA;
+					d->size = 4;
+				}
+				else
+					d->kind = (ir & 0x0100) ? M68KI_DYNA_SUB : M68KI_DYNA_ADD;
+				d->src = 16;
+				d->imm = ((rx - 1) & 7) + 1;
+				d->dst = (mode << 3) | reg;
+				return 1;
+			}
+			if((ir & 0xf8) == 0xc8)                                  /* DBcc */
+			{
+				d->kind = M68KI_DYNA_DBCC;
+				d->cond = (ir >> 8) & 15;
+				d->dst  = reg;
+				d->imm  = address + 2 + (INT16)m68k_read_immediate_16(m68k, address + 2);
+				return 1;
+			}
+			return 0;
+		case 0x6:                                                    /* BRA, Bcc; not BSR */
+			if(((ir >> 8) & 15) == 1 || (ir & 0xff) == 0xff)
+				return 0;
+			d->kind = M68KI_DYNA_BCC;
+			d->cond = (ir >> 8) & 15;
+			d->size = (ir & 0xff) ? 1 : 2;
+			if(d->size == 1)
+				d->imm = address + 2 + (INT8)(ir & 0xff);
+			else
+				d->imm = address + 2 + (INT16)m68k_read_immediate_16(m68k, address + 2);
+			return 1;
+		case 0x7:                                                    /* MOVEQ */
+			if(ir & 0x0100)
+				return 0;
+			d->kind = M68KI_DYNA_MOVE;
+			d->size = 4;
+			d->src  = 16;
+			d->imm  = (INT8)(ir & 0xff);
+			d->dst  = rx;
+			return 1;
+		case 0x8: case 0xc:                                          /* OR, AND <ea>,Dn */
+			if(opmode > 2)
+				return 0;
+			d->kind = (ir >> 12) == 0x8 ? M68KI_DYNA_OR : M68KI_DYNA_AND;
+			d->dst  = rx;
+			return mode != 1 && m68ki_dyna_source(m68k, d, ir, address, size);
+		case 0x9: case 0xd:                                          /* SUB, ADD <ea>,Dn; SUBA, ADDA <ea>,An */
+			if(opmode == 3 || opmode == 7)
+			{
+				d->kind = (ir >> 12) == 0x9 ? M68KI_DYNA_SUBA : M68KI_DYNA_ADDA;
+				d->size = opmode == 3 ? 2 : 4;
+				d->dst  = 8 | rx;
+				return m68ki_dyna_source(m68k, d, ir, address, d->size);
+			}
+			if(opmode > 2)
+				return 0;
+			d->kind = (ir >> 12) == 0x9 ? M68KI_DYNA_SUB : M68KI_DYNA_ADD;
+			d->dst  = rx;
+			return m68ki_dyna_source(m68k, d, ir, address, size);
+		case 0xb:                                                    /* CMP <ea>,Dn; CMPA <ea>,An; EOR Dn,Dn */
+			if(opmode == 3 || opmode == 7)
+			{
+				d->kind = M68KI_DYNA_CMPA;
+				d->size = opmode == 3 ? 2 : 4;
+				d->dst  = 8 | rx;
+				return m68ki_dyna_source(m68k, d, ir, address, d->size);
+			}
+			if(opmode <= 2)
+			{
+				d->kind = M68KI_DYNA_CMP;
+				d->dst  = rx;
+				return m68ki_dyna_source(m68k, d, ir, address, size);
+			}
+			if(mode != 0)
+				return 0;
+			d->kind = M68KI_DYNA_EOR;
+			d->src  = rx;
+			d->dst  = reg;
+			return 1;
+	}
+	return 0;
+}
+
+/* Leave the truth of condition cc (2-15) of the flags in al, inverted for
+ * odd cc: set means HI, CC, NE, VC, PL, GE or GT
+ */
+static uint8 *m68ki_dyna_cond(uint8 *outp, uint cc)
+{
+	switch(cc >> 1)
+	{
+		case 1: case 2:                                            /* HI LS, CC CS */
+			C(0xF7) C(0x83) C32(CPUOFS(c_flag)) C32(0x100)         /* test dword [rbx+c_flag],0x100 */
+			C(0x0F) C(0x94) C(0xC0)                                /* setz al */
+			break;
+		case 3:                                                    /* NE EQ */
+			C(0x83) C(0xBB) C32(CPUOFS(not_z_flag)) C(0)           /* cmp dword [rbx+not_z_flag],0 */
+			C(0x0F) C(0x95) C(0xC0)                                /* setne al */
+			break;
+		case 4:                                                    /* VC VS */
+			C(0xF7) C(0x83) C32(CPUOFS(v_flag)) C32(0x80)          /* test dword [rbx+v_flag],0x80 */
+			C(0x0F) C(0x94) C(0xC0)                                /* setz al */
+			break;
+		case 5:                                                    /* PL MI */
+			C(0xF7) C(0x83) C32(CPUOFS(n_flag)) C32(0x80)          /* test dword [rbx+n_flag],0x80 */
+			C(0x0F) C(0x94) C(0xC0)                                /* setz al */
+			break;
+		case 6: case 7:                                            /* GE LT, GT LE */
+			outp = m68ki_dyna_load(outp, X_EAX, CPUOFS(n_flag), 4, 0);
+			C(0x33) C(0x83) C32(CPUOFS(v_flag))                    /* xor eax,[rbx+v_flag] */
+			C(0xA9) C32(0x80)                                      /* test eax,0x80 */
+			C(0x0F) C(0x94) C(0xC0)                                /* setz al */
+			break;
+	}
+	if(cc == 2 || cc == 3 || cc == 14 || cc == 15)
+	{
+		C(0x83) C(0xBB) C32(CPUOFS(not_z_flag)) C(0)               /* cmp dword [rbx+not_z_flag],0 */
+		C(0x0F) C(0x95) C(0xC1)                                    /* setne cl */
+		C(0x20) C(0xC8)                                            /* and al,cl */
+	}
+	return outp;
+}
+
+/* Jump to a label yet to be placed if condition cc (2-15) holds, or doesn't
+ * if negate; returns where the rel32 goes
+ */
+static uint8 *m68ki_dyna_jcc(uint8 **outpp, uint cc, uint negate)
+{
+	uint8 *outp = m68ki_dyna_cond(*outpp, cc);
+	uint8 *rel;
+
+	C(0x84) C(0xC0)                                                /* test al,al */
+	C(0x0F) C((((cc & 1) != 0) != (negate != 0)) ? 0x84 : 0x85)    /* jz/jnz */
+	rel = outp; C32(0)
+	*outpp = outp;
+	return rel;
+}
+
+/* Register operand offset */
+#define DYNA_REG(N) (CPUOFS(dar) + ((N) << 2))
+
+/* Data and address operations: ecx = source, edx = destination, eax = result */
+static uint8 *m68ki_dyna_op(uint8 *outp, const m68ki_dyna_insn *d)
+{
+	uint size = d->size;
+	uint mask = size == 1 ? 0xff : size == 2 ? 0xffff : 0xffffffff;
+	uint nsh  = size == 1 ? 0 : size == 2 ? 8 : 24;
+	uint addr = d->kind >= M68KI_DYNA_MOVEA;
+	uint32 imm = d->imm;
+
+	if(addr && size == 2 && d->src == 16)
+		imm = (UINT32)(INT16)imm;
+	if(d->src == 16)
+		outp = m68ki_dyna_alu_imm(outp, X_MOV, X_ECX, imm);
+	else
+		outp = m68ki_dyna_load(outp, X_ECX, DYNA_REG(d->src), size, addr);
+
+	if(addr && d->kind != M68KI_DYNA_CMPA)
+	{
+		if(d->kind == M68KI_DYNA_MOVEA)
+			return m68ki_dyna_store(outp, X_ECX, DYNA_REG(d->dst), 4);
+		C(d->kind == M68KI_DYNA_ADDA ? X_ADD : X_SUB) C(0x83 | (X_ECX << 3)) C32(DYNA_REG(d->dst)) /* add/sub [rbx+An],ecx */
+		return outp;
+	}
+	if(addr)
+	{
+		size = 4;
+		mask = 0xffffffff;
+		nsh  = 24;
+	}
+	if(d->kind != M68KI_DYNA_MOVE && d->kind != M68KI_DYNA_TST)
+		outp = m68ki_dyna_load(outp, X_EDX, DYNA_REG(d->dst), size, 0);
+
+	switch(d->kind)
+	{
+		case M68KI_DYNA_MOVE:
+		case M68KI_DYNA_TST:
+			outp = m68ki_dyna_alu(outp, X_MOV, X_EAX, X_ECX);
+			break;
+		case M68KI_DYNA_AND:
+		case M68KI_DYNA_OR:
+		case M68KI_DYNA_EOR:
+			outp = m68ki_dyna_alu(outp, X_MOV, X_EAX, X_EDX);
+			outp = m68ki_dyna_alu(outp, d->kind == M68KI_DYNA_AND ? X_AND : d->kind == M68KI_DYNA_OR ? X_OR : X_XOR, X_EAX, X_ECX);
+			break;
+		case M68KI_DYNA_ADD:
+			outp = m68ki_dyna_alu(outp, X_MOV, X_EAX, X_EDX);
+			outp = m68ki_dyna_alu(outp, X_ADD, X_EAX, X_ECX);
+			break;
+		default:                                                   /* SUB CMP CMPA */
+			outp = m68ki_dyna_alu(outp, X_MOV, X_EAX, X_EDX);
+			outp = m68ki_dyna_alu(outp, X_SUB, X_EAX, X_ECX);
+			break;
+	}
+
+	/* N from the unmasked result, as NFLAG_8/16/32 */
+	outp = m68ki_dyna_alu(outp, X_MOV, X_ESI, X_EAX);
+	outp = m68ki_dyna_shr(outp, X_ESI, nsh);
+	outp = m68ki_dyna_store(outp, X_ESI, CPUOFS(n_flag), 4);
+
+	if(d->kind <= M68KI_DYNA_TST || (d->kind >= M68KI_DYNA_AND && d->kind <= M68KI_DYNA_EOR))
+	{
+		C(0xC7) C(0x83) C32(CPUOFS(v_flag)) C32(VFLAG_CLEAR)       /* mov dword [rbx+v_flag],0 */
+		C(0xC7) C(0x83) C32(CPUOFS(c_flag)) C32(CFLAG_CLEAR)       /* mov dword [rbx+c_flag],0 */
+	}
+	else
+	{
+		uint add = d->kind == M68KI_DYNA_ADD;
+		/* V: (S^R)&(D^R) for adds, (S^D)&(R^D) for subtracts */
+		outp = m68ki_dyna_alu(outp, X_MOV, X_ESI, add ? X_ECX : X_EDX);
+		outp = m68ki_dyna_alu(outp, X_XOR, X_ESI, add ? X_EAX : X_ECX);
+		outp = m68ki_dyna_alu(outp, X_MOV, X_EDI, add ? X_EDX : X_EAX);
+		outp = m68ki_dyna_alu(outp, X_XOR, X_EDI, add ? X_EAX : X_EDX);
+		outp = m68ki_dyna_alu(outp, X_AND, X_ESI, X_EDI);
+		outp = m68ki_dyna_shr(outp, X_ESI, nsh);
+		outp = m68ki_dyna_store(outp, X_ESI, CPUOFS(v_flag), 4);
+		/* C: the result's bit 8 (or 16) for bytes and words, CFLAG_ADD/SUB_32 for longs */
+		if(size == 4)
+		{
+			/* add: (S&D)|(~R&(S|D)), sub: (S&R)|(~D&(S|R)) */
+			uint a = add ? X_EDX : X_EAX;
+			uint r = add ? X_EAX : X_EDX;
+			outp = m68ki_dyna_alu(outp, X_MOV, X_ESI, X_ECX);
+			outp = m68ki_dyna_alu(outp, X_AND, X_ESI, a);
+			outp = m68ki_dyna_alu(outp, X_MOV, X_EDI, X_ECX);
+			outp = m68ki_dyna_alu(outp, X_OR, X_EDI, a);
+			C(0xF7) C(0xD0 | r)                                    /* not r */
+			outp = m68ki_dyna_alu(outp, X_AND, X_EDI, r);
+			C(0xF7) C(0xD0 | r)                                    /* not r */
+			outp = m68ki_dyna_alu(outp, X_OR, X_ESI, X_EDI);
+			outp = m68ki_dyna_shr(outp, X_ESI, 23);
+		}
+		else
+		{
+			outp = m68ki_dyna_alu(outp, X_MOV, X_ESI, X_EAX);
+			outp = m68ki_dyna_shr(outp, X_ESI, nsh);
+		}
+		outp = m68ki_dyna_store(outp, X_ESI, CPUOFS(c_flag), 4);
+		if(d->kind == M68KI_DYNA_ADD || d->kind == M68KI_DYNA_SUB)
+			outp = m68ki_dyna_store(outp, X_ESI, CPUOFS(x_flag), 4);
+	}
+
+	/* Z from the masked result, which is also what's written back */
+	if(mask != 0xffffffff)
+		outp = m68ki_dyna_alu_imm(outp, X_AND, X_EAX, mask);
+	outp = m68ki_dyna_store(outp, X_EAX, CPUOFS(not_z_flag), 4);
+	if(d->kind != M68KI_DYNA_TST && d->kind != M68KI_DYNA_CMP && d->kind != M68KI_DYNA_CMPA)
+		outp = m68ki_dyna_store(outp, X_EAX, DYNA_REG(d->dst), size);
+	return outp;
+}
+
+/* Compile the block starting at pc into b, if it can be cached at all */
+static int m68ki_dynacompile(m68ki_cpu_core *m68k, cpu_dynablock_t *b, uint pc)
+{
+	uint address = pc & 0xffffff;
+	const cpu_memory_map *temp = &m68k->memory_map[(address >> 16) & 0xff];
+	uint8 *outp, *start;
+	uint8 *exits[3 * M68K_DYNA_MAXINS];
+	uint nexits = 0;
+	uint n, i;
+
+	if((address & 1) || address >= M68K_DECODE_RANGE)
+		return 0;
+	if(!temp->base || temp->read16)
+		return 0;
+
+	/* Out of room: throw everything away and start over */
+	if(m68k->dyna_used < M68K_DYNACODE_SLOP || m68k->dyna_used + M68K_DYNACODE_BLOCK > M68K_DYNACODE_SIZE)
+	{
+		for(i = 0; i < M68K_DYNA_BLOCKS; i++)
+			m68k->dyna_blocks[i].pc = 1;
+		m68k->dyna_used = M68K_DYNACODE_SLOP;
+	}
+
+	b->pc      = pc;
+	b->page    = address >> M68K_DECODE_PAGE_SHIFT;
+	b->gen     = m68k->dc_gen[b->page];
+	b->dynaofs = m68k->dyna_used;
+	outp = m68k->dynacode + b->dynaofs;
+
+	C(0x53)                                                        /* push rbx */
+	C(0x48) C(0x89) C(0xFB)                                        /* mov rbx,rdi */
+	start = outp;
+
+	for(n = 0; n < M68K_DYNA_MAXINS; n++)
+	{
+		uint ir = m68k_read_immediate_16(m68k, address);
+		const m68ki_opcode_class *op = m68ki_opcode(ir);
+		uint next = address + (m68ki_instruction_length(ir) << 1);
+		uint nextpc = pc + (next - address);
+		uint last = n + 1 == M68K_DYNA_MAXINS || m68ki_block_ends(ir) ||
+		            (next >> M68K_DECODE_PAGE_SHIFT) != b->page;
+		m68ki_dyna_insn d;
+
+		C(0xC7) C(0x83) C32(CPUOFS(ppc)) C32(pc)                   /* mov dword [rbx+ppc],pc */
+		C(0xC7) C(0x83) C32(CPUOFS(ir)) C32(ir)                    /* mov dword [rbx+ir],ir */
+
+		/* Immediates are compiled in, so they must be on the block's page too */
+		if(((next - 1) >> M68K_DECODE_PAGE_SHIFT) == b->page && m68ki_dyna_decode(m68k, &d, ir, address))
+		{
+			uint target = pc + (d.imm - address);
+			uint8 *rel = NULL;
+
+			if(d.kind == M68KI_DYNA_BCC)
+			{
+				if(d.cond)
+					rel = m68ki_dyna_jcc(&outp, d.cond, 1);
+				C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(target)        /* mov dword [rbx+pc],target */
+				if(d.cond == 0 && target == pc)                  /* BRA to itself: idle */
+				{
+					C(0x83) C(0xBB) C32(CPUOFS(remaining_cycles)) C(0) /* cmp dword [rbx+remaining_cycles],0 */
+					C(0x7E) C(0x0A)                                /* jle +10 */
+					C(0xC7) C(0x83) C32(CPUOFS(remaining_cycles)) C32(0) /* mov dword [rbx+remaining_cycles],0 */
+				}
+			}
+			else if(d.kind == M68KI_DYNA_DBCC)
+			{
+				uint8 *rel2;
+				if(d.cond == 0)
+				{
+					/* DBT never branches */
+					C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(nextpc)    /* mov dword [rbx+pc],next */
+					C(0x81) C(0xAB) C32(CPUOFS(remaining_cycles)) C32(op->cycles) /* sub dword [rbx+remaining_cycles],cycles */
+					goto fallthrough;
+				}
+				if(d.cond != 1)
+					rel = m68ki_dyna_jcc(&outp, d.cond, 0);
+				outp = m68ki_dyna_load(outp, X_EAX, DYNA_REG(d.dst), 4, 0);
+				C(0x83) C(0xE8) C(0x01)                            /* sub eax,1 */
+				C(0x0F) C(0xB7) C(0xC0)                            /* movzx eax,ax */
+				outp = m68ki_dyna_store(outp, X_EAX, DYNA_REG(d.dst), 2);
+				C(0x3D) C32(0xffff)                                /* cmp eax,0xffff */
+				C(0x0F) C(0x84) rel2 = outp; C32(0)                /* je expired */
+				C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(target)        /* mov dword [rbx+pc],target */
+				outp = m68ki_dyna_load(outp, X_EAX, CPUOFS(cyc_dbcc_f_noexp), 4, 0);
+				C(0x29) C(0x83) C32(CPUOFS(remaining_cycles))      /* sub [rbx+remaining_cycles],eax */
+				C(0x81) C(0xAB) C32(CPUOFS(remaining_cycles)) C32(op->cycles) /* sub dword [rbx+remaining_cycles],cycles */
+				if(target == b->pc)
+				{
+					C(0x0F) C(0x8F) C32(start - (outp + 4))        /* jg start */
+				}
+				C(0xE9) exits[nexits++] = outp; C32(0)             /* jmp exit */
+				*((uint32*)rel2) = (uint32)(outp - (rel2 + 4));     /* expired: */
+				outp = m68ki_dyna_load(outp, X_EAX, CPUOFS(cyc_dbcc_f_exp), 4, 0);
+				C(0x29) C(0x83) C32(CPUOFS(remaining_cycles))      /* sub [rbx+remaining_cycles],eax */
+				if(rel)                                            /* condition true: */
+					*((uint32*)rel) = (uint32)(outp - (rel + 4));
+				C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(nextpc)        /* mov dword [rbx+pc],next */
+				C(0x81) C(0xAB) C32(CPUOFS(remaining_cycles)) C32(op->cycles) /* sub dword [rbx+remaining_cycles],cycles */
+				goto fallthrough;
+			}
+			else
+			{
+				C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(nextpc)        /* mov dword [rbx+pc],next */
+				outp = m68ki_dyna_op(outp, &d);
+			}
+			C(0x81) C(0xAB) C32(CPUOFS(remaining_cycles)) C32(op->cycles) /* sub dword [rbx+remaining_cycles],cycles */
+
+			if(d.kind == M68KI_DYNA_BCC)
+			{
+				if(target == b->pc)
+				{
+					C(0x0F) C(0x8F) C32(start - (outp + 4))        /* jg start */
+				}
+				if(!rel)
+					break;
+				C(0xE9) exits[nexits++] = outp; C32(0)             /* jmp exit */
+				*((uint32*)rel) = (uint32)(outp - (rel + 4));      /* not taken: */
+				C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(nextpc)        /* mov dword [rbx+pc],next */
+				outp = m68ki_dyna_load(outp, X_EAX, d.size == 1 ? CPUOFS(cyc_bcc_notake_b) : CPUOFS(cyc_bcc_notake_w), 4, 0);
+				C(0x29) C(0x83) C32(CPUOFS(remaining_cycles))      /* sub [rbx+remaining_cycles],eax */
+				C(0x81) C(0xAB) C32(CPUOFS(remaining_cycles)) C32(op->cycles) /* sub dword [rbx+remaining_cycles],cycles */
+			}
+
+fallthrough:
+			/* Inline instructions can't leave the straight line any other
+			 * way or write memory, so only the cycles need checking */
+			pc = nextpc;
+			address = next;
+			if(last)
+				break;
+			C(0x0F) C(0x8E) exits[nexits++] = outp; C32(0)         /* jle exit */
+			continue;
+		}
+
+		C(0xC7) C(0x83) C32(CPUOFS(pc)) C32(pc + 2)                /* mov dword [rbx+pc],pc+2 */
+		C(0x48) C(0x89) C(0xDF)                                    /* mov rdi,rbx */
+		C(0x48) C(0xB8) C64(op->handler)                           /* mov rax,<handler> */
+		C(0xFF) C(0xD0)                                            /* call rax */
+		C(0x81) C(0xAB) C32(CPUOFS(remaining_cycles)) C32(op->cycles) /* sub dword [rbx+remaining_cycles],cycles */
+
+		pc = nextpc;
+		address = next;
+		if(last)
+			break;
+
+		C(0x0F) C(0x8E) exits[nexits++] = outp; C32(0)             /* jle exit */
+		C(0x81) C(0xBB) C32(CPUOFS(pc)) C32(pc)                    /* cmp dword [rbx+pc],next */
+		C(0x0F) C(0x85) exits[nexits++] = outp; C32(0)             /* jne exit */
+		C(0x81) C(0xBB) C32(CPUOFS(dc_gen[b->page])) C32(b->gen)   /* cmp dword [rbx+gen],gen */
+		C(0x0F) C(0x85) exits[nexits++] = outp; C32(0)             /* jne exit */
+	}
+
+	for(i = 0; i < nexits; i++)
+		*((uint32*)(exits[i])) = (uint32)(outp - (exits[i] + 4));
+	C(0x5B)                                                        /* exit: pop rbx */
+	C(0xC3)                                                        /* ret */
+	m68k->dyna_used = (uint)(outp - m68k->dynacode);
+	return 1;
+}
+
+/* Run the compiled block at the pc, or a single instruction if there's none */
+INLINE void m68ki_execute_dyna(m68ki_cpu_core *m68k)
+{
+	uint pc = REG_PC;
+	cpu_dynablock_t *b = &m68k->dyna_blocks[(pc >> 1) & (M68K_DYNA_BLOCKS - 1)];
+
+	if((b->pc == pc && !(pc & 1) && b->gen == m68k->dc_gen[b->page]) || m68ki_dynacompile(m68k, b, pc))
+		((m68ki_dyna_block_t)(m68k->dynacode + b->dynaofs))(m68k);
+	else
+		m68ki_execute_decoded(m68k);
+}
+
+#undef C
+#undef C32
+#undef C64
+#undef CPUOFS
+#endif
+
 /* Execute some instructions until we use up cycles clock cycles */
 int m68k_execute(m68ki_cpu_core *m68k, unsigned int cycles)
 {
@@ -524,6 +1396,11 @@ int m68k_execute(m68ki_cpu_core *m68k, unsigned int cycles)
 	/* Set our pool of clock cycles available */
 	m68k->remaining_cycles = cycles;
 
+#if M68K_FETCH_WINDOW
+	/* The memory may have moved since the last call */
+	m68k->fetch_size = 0;
+#endif
+
 	/* See if interrupts came in */
 	m68ki_check_interrupts(m68k);
 
@@ -542,10 +1419,23 @@ int m68k_execute(m68ki_cpu_core *m68k, unsigned int cycles)
 			/* Record previous program counter */
 			REG_PPC = REG_PC;
 
-			/* Read an instruction and call its handler */
-			m68k->ir = m68ki_read_imm_16(m68k);
-			m68ki_instruction_jump_table[m68k->ir](m68k);
-			m68k->remaining_cycles -= m68k->cyc_instruction[m68k->ir];
+#if M68K_DYNAREC
+			if(m68k->dyna_enabled && m68k->dyna_prepared == m68k->dynacode)
+				m68ki_execute_dyna(m68k);
+			else
+#endif
+#if M68K_DECODE_CACHE
+			m68ki_execute_decoded(m68k);
+#else
+			{
+				/* Read an instruction and call its handler */
+				const m68ki_opcode_class *op;
+				m68k->ir = m68ki_read_imm_16(m68k);
+				op = m68ki_opcode(m68k->ir);
+				op->handler(m68k);
+				m68k->remaining_cycles -= op->cycles;
+			}
+#endif
 
 			/* Trace m68k_exception, if necessary */
 			m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
@@ -561,18 +1451,6 @@ int m68k_execute(m68ki_cpu_core *m68k, unsigned int cycles)
 	return m68k->initial_cycles - m68k->remaining_cycles;
 }
 
-static void m68k_init_internal(m68ki_cpu_core *m68k)
-{
-	static UINT32 emulation_initialized = 0;
-
-	/* The first call to this function initializes the opcode handler jump table */
-	if(!emulation_initialized)
-	{
-		m68ki_build_opcode_table();
-		emulation_initialized = 1;
-	}
-}
-
 /* Pulse the RESET line on the CPU */
 void m68k_pulse_reset(m68ki_cpu_core *m68k)
 {
@@ -603,6 +1481,15 @@ void m68k_pulse_reset(m68ki_cpu_core *m68k)
 	m68k->pref_addr = 0x1000;
 #endif
 
+#if M68K_FETCH_WINDOW
+	m68k->fetch_size = 0;
+#endif
+
+#if M68K_DECODE_CACHE
+	/* Code may have been loaded behind our back */
+	m68ki_decode_flush(m68k);
+#endif
+
 	/* Read the initial stack pointer and program counter */
 	m68ki_jump(m68k, 0);
 	REG_SP = m68ki_read_imm_32(m68k);
@@ -624,10 +1511,7 @@ void m68k_pulse_reset(m68ki_cpu_core *m68k)
 
 void m68k_init(m68ki_cpu_core *m68k)
 {
-	m68k_init_internal(m68k);
-
 	m68k->sr_mask          = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-	m68k->cyc_instruction  = m68ki_cycles[0];
 	m68k->cyc_exception    = m68ki_exception_cycle_table[0];
 	m68k->cyc_bcc_notake_b = -2;
 	m68k->cyc_bcc_notake_w = 2;
@@ -638,4 +1522,8 @@ void m68k_init(m68ki_cpu_core *m68k)
 	m68k->cyc_movem_l      = 3;
 	m68k->cyc_shift        = 1;
 	m68k->cyc_reset        = 132;
+
+#if M68K_DECODE_CACHE
+	m68ki_decode_flush(m68k);
+#endif
 }
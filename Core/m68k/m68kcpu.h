@@ -25,6 +25,7 @@
 #ifndef __M68KCPU_H__
 #define __M68KCPU_H__
 
+#include "m68kconf.h"
 #include "m68k.h"
 
 #include <limits.h>
@@ -237,7 +238,7 @@
 /* These defines are dependant on the configuration defines in m68kconf.h */
 
 /* Disable certain comparisons if we're not using all CPU types */
-#if 1
+#if !(M68K_EMULATE_010 || M68K_EMULATE_EC020 || M68K_EMULATE_020)
 #define CPU_TYPE_IS_040_PLUS(A) 0
 #define CPU_TYPE_IS_040_LESS(A) 1
 
@@ -277,11 +278,10 @@
 #define CPU_TYPE_IS_010_LESS(A)    ((A) & (CPU_TYPE_000 | CPU_TYPE_008 | CPU_TYPE_010))
 
 #define CPU_TYPE_IS_000(A)         ((A) == CPU_TYPE_000 || (A) == CPU_TYPE_008)
-#endif
 
+#error "only the 68000 is supported: the opcode tables carry 68000 cycles only (see m68kconf.h)"
+#endif
 
-/* Configuration switches (see m68kconf.h for explanation) */
-#define M68K_EMULATE_TRACE          0
 
 /* Enable or disable trace emulation */
 #if M68K_EMULATE_TRACE
@@ -576,6 +576,24 @@ extern const UINT32   m68ki_shift_32_table[];
 extern const UINT8    m68ki_exception_cycle_table[][256];
 extern const UINT8    m68ki_ea_idx_cycle_table[];
 
+/* Opcode dispatch, generated by m68kmake: the top bits of an opcode pick a
+ * block, the block gives its class, and the class is a handler and its
+ * cycle count.  Both the classes and the blocks are deduplicated.
+ */
+#define M68KI_OPCODE_BLOCK_SHIFT 5 /* must match m68kmake.c */
+
+typedef struct
+{
+	void (*handler)(m68ki_cpu_core *m68k); /* opcode handler */
+	UINT8 cycles;                          /* 68000 cycles */
+} m68ki_opcode_class;
+
+extern const m68ki_opcode_class m68ki_opcode_classes[];
+extern const UINT16   m68ki_opcode_blocks[][1 << M68KI_OPCODE_BLOCK_SHIFT];
+extern const UINT16   m68ki_opcode_block_index[0x10000 >> M68KI_OPCODE_BLOCK_SHIFT];
+
+#define m68ki_opcode(IR) (&m68ki_opcode_classes[m68ki_opcode_blocks[m68ki_opcode_block_index[(IR) >> M68KI_OPCODE_BLOCK_SHIFT]][(IR) & ((1 << M68KI_OPCODE_BLOCK_SHIFT) - 1)]])
+
 /* Read data immediately after the program counter */
 INLINE UINT32 m68ki_read_imm_16(m68ki_cpu_core *m68k);
 INLINE UINT32 m68ki_read_imm_32(m68ki_cpu_core *m68k);
@@ -690,6 +708,12 @@ INLINE void m68ki_exception_address_error(m68ki_cpu_core *m68k);
 INLINE void m68ki_exception_interrupt(m68ki_cpu_core *m68k, UINT32 int_level);
 INLINE void m68ki_check_interrupts(m68ki_cpu_core *m68k);            /* ASG: check for interrupts */
 
+#if M68K_FETCH_WINDOW
+/* Immediate reads from outside the fetch window */
+UINT32 m68ki_fetch_16(m68ki_cpu_core *m68k, uint pc);
+UINT32 m68ki_fetch_32(m68ki_cpu_core *m68k, uint pc);
+#endif
+
 /* quick disassembly (used for logging) */
 char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type);
 
@@ -745,8 +769,14 @@ INLINE UINT32 m68ki_read_imm_16(m68ki_cpu_core *m68k)
 #else
 	pc = REG_PC;
 	REG_PC += 2;
+#if M68K_FETCH_WINDOW
+	if(pc - m68k->fetch_start < m68k->fetch_size)
+		return *(const uint16 *)(m68k->fetch_base + (pc - m68k->fetch_start));
+	return m68ki_fetch_16(m68k, pc);
+#else
 	return m68k_read_immediate_16(m68k, pc);
 #endif
+#endif
 }
 
 INLINE UINT32 m68ki_read_imm_32(m68ki_cpu_core *m68k)
@@ -778,14 +808,30 @@ INLINE UINT32 m68ki_read_imm_32(m68ki_cpu_core *m68k)
 #endif
 	uint pc = REG_PC;
 	REG_PC += 4;
+#if M68K_FETCH_WINDOW
+	if(pc - m68k->fetch_start < m68k->fetch_size)
+	{
+		const uint16 *p = (const uint16 *)(m68k->fetch_base + (pc - m68k->fetch_start));
+		return (p[0] << 16) | p[1];
+	}
+	return m68ki_fetch_32(m68k, pc);
+#else
 	return m68k_read_immediate_32(m68k, pc);
 #endif
+#endif
 }
 
 
 
 /* ------------------------- Top level read/write ------------------------- */
 
+/* Writes to memory-based space invalidate decoded instructions on that page */
+#if M68K_DECODE_CACHE
+#define m68ki_code_written(M, A) if(((A) & 0xffffff) < M68K_DECODE_RANGE) (M)->dc_gen[((A) & 0xffffff) >> M68K_DECODE_PAGE_SHIFT]++
+#else
+#define m68ki_code_written(M, A)
+#endif
+
 /* Handles all memory accesses (except for immediate reads if they are
  * configured to use separate functions in m68kconf.h).
  * All memory accesses must go through these top level functions.
@@ -824,7 +870,11 @@ INLINE void m68ki_write_8_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint v
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write8) (*temp->write8)(temp->param,address&0xFFFFFF,value);
-	else WRITE_BYTE(temp->base, (address) & 0xffff, value);
+	else
+	{
+		WRITE_BYTE(temp->base, (address) & 0xffff, value);
+		m68ki_code_written(m68k, address);
+	}
 }
 
 INLINE void m68ki_write_16_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint value)
@@ -833,7 +883,11 @@ INLINE void m68ki_write_16_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,address&0xFFFFFF,value);
-	else *(uint16 *)(temp->base + ((address) & 0xffff)) = value;
+	else
+	{
+		*(uint16 *)(temp->base + ((address) & 0xffff)) = value;
+		m68ki_code_written(m68k, address);
+	}
 }
 
 INLINE void m68ki_write_32_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint value)
@@ -842,11 +896,19 @@ INLINE void m68ki_write_32_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,address&0xFFFFFF,value>>16);
-	else *(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+	else
+	{
+		*(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+		m68ki_code_written(m68k, address);
+	}
 
 	temp = &m68k->memory_map[((address + 2)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,(address+2)&0xFFFFFF,value&0xffff);
-	else *(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+	else
+	{
+		*(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+		m68ki_code_written(m68k, address + 2);
+	}
 }
 
 /* Special call to simulate undocumented 68k behavior when move.l with a
@@ -860,11 +922,19 @@ INLINE void m68ki_write_32_pd_fc(m68ki_cpu_core *m68k, UINT32 address, UINT32 fc
 
 	temp = &m68k->memory_map[((address + 2)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,(address+2)&0xFFFFFF,value&0xffff);
-	else *(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+	else
+	{
+		*(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+		m68ki_code_written(m68k, address + 2);
+	}
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,(address)&0xFFFFFF,value>>16);
-	else *(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+	else
+	{
+		*(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+		m68ki_code_written(m68k, address);
+	}
 }
 
 
@@ -1532,7 +1602,7 @@ INLINE void m68ki_exception_privilege_violation(m68ki_cpu_core *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_PRIVILEGE_VIOLATION);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_PRIVILEGE_VIOLATION] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_PRIVILEGE_VIOLATION] - m68ki_opcode(m68k->ir)->cycles;
 }
 
 /* Exception for A-Line instructions */
@@ -1545,7 +1615,7 @@ INLINE void m68ki_exception_1010(m68ki_cpu_core *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_1010);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1010] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1010] - m68ki_opcode(m68k->ir)->cycles;
 }
 
 /* Exception for F-Line instructions */
@@ -1558,7 +1628,7 @@ INLINE void m68ki_exception_1111(m68ki_cpu_core *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_1111);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1111] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_1111] - m68ki_opcode(m68k->ir)->cycles;
 }
 
 /* Exception for illegal instructions */
@@ -1578,7 +1648,7 @@ INLINE void m68ki_exception_illegal(m68ki_cpu_core *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_ILLEGAL_INSTRUCTION);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ILLEGAL_INSTRUCTION] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ILLEGAL_INSTRUCTION] - m68ki_opcode(m68k->ir)->cycles;
 }
 
 /* Exception for format errror in RTE */
@@ -1589,7 +1659,7 @@ INLINE void m68ki_exception_format_error(m68ki_cpu_core *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_FORMAT_ERROR);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_FORMAT_ERROR] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_FORMAT_ERROR] - m68ki_opcode(m68k->ir)->cycles;
 }
 
 /* Exception for address error */
@@ -1616,7 +1686,7 @@ INLINE void m68ki_exception_address_error(m68ki_cpu_core *m68k)
 	m68ki_jump_vector(m68k, EXCEPTION_ADDRESS_ERROR);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ADDRESS_ERROR] - m68k->cyc_instruction[m68k->ir];
+	m68k->remaining_cycles -= m68k->cyc_exception[EXCEPTION_ADDRESS_ERROR] - m68ki_opcode(m68k->ir)->cycles;
 }
 #endif
 
@@ -86,6 +86,9 @@ static const char g_version[] = "4.55";
 #define EA_ALLOWED_LENGTH                11	/* Max length of ea allowed str */
 #define MAX_OPCODE_INPUT_TABLE_LENGTH  1000	/* Max length of opcode handler tbl */
 #define MAX_OPCODE_OUTPUT_TABLE_LENGTH 3000	/* Max length of opcode handler tbl */
+#define OPCODE_BLOCK_SHIFT                5	/* Opcodes per dispatch block (log2), must match m68kcpu.h */
+#define OPCODE_BLOCK_SIZE      (1 << OPCODE_BLOCK_SHIFT)
+#define OPCODE_BLOCK_COUNT     (0x10000 >> OPCODE_BLOCK_SHIFT)
 
 /* Default filenames */
 #define FILENAME_INPUT      "m68k_in.c"
@@ -236,7 +239,7 @@ static void write_function_name(FILE* filep, char* base_name);
 static void add_opcode_output_table_entry(opcode_struct* op, char* name);
 static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr);
 static void print_opcode_output_table(FILE* filep);
-static void write_table_entry(FILE* filep, opcode_struct* op);
+static void write_class_entry(FILE* filep, const char* name, int cycles);
 static void set_opcode_struct(opcode_struct* src, opcode_struct* dst, int ea_mode);
 static void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* opinfo, int ea_mode);
 static void generate_opcode_ea_variants(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* op);
@@ -269,6 +272,13 @@ static opcode_struct g_opcode_input_table[MAX_OPCODE_INPUT_TABLE_LENGTH];
 static opcode_struct g_opcode_output_table[MAX_OPCODE_OUTPUT_TABLE_LENGTH];
 static int g_opcode_output_table_length = 0;
 
+/* Dispatch tables: handler class of each opcode, and the blocks they're kept in */
+static unsigned short g_opcode_class[0x10000];
+static int g_class_entry[MAX_OPCODE_OUTPUT_TABLE_LENGTH+1]; /* output table entry of each class, -1 = illegal */
+static int g_num_classes = 0;
+static unsigned short g_block_index[OPCODE_BLOCK_COUNT];
+static int g_num_blocks = 0;
+
 static const ea_info_struct g_ea_info_table[13] =
 {/* fname    ea        mask  match */
 	{"",     "",       0x00, 0x00}, /* EA_MODE_NONE */
@@ -820,31 +830,92 @@ static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr)
 	return a->op_match - b->op_match;
 }
 
+/*
+ * Resolve every opcode to its handler and write the dispatch tables.
+ * Handlers are applied from the least to the most specific mask, so
+ * more specific ones win; anything left over is illegal.
+ * Each distinct handler/cycles pair becomes a class, and the class numbers
+ * are stored in deduplicated blocks of OPCODE_BLOCK_SIZE opcodes.
+ */
 static void print_opcode_output_table(FILE* filep)
 {
-	int i;
+	static int entry_of[0x10000];
+	static int class_of_entry[MAX_OPCODE_OUTPUT_TABLE_LENGTH];
+	static int block_first[OPCODE_BLOCK_COUNT];
+	int i, j, k;
+
 	qsort((void *)g_opcode_output_table, g_opcode_output_table_length, sizeof(g_opcode_output_table[0]), compare_nof_true_bits);
 
-	for(i=0;i<g_opcode_output_table_length;i++)
-		write_table_entry(filep, g_opcode_output_table+i);
-}
+	for(i=0;i<0x10000;i++)
+		entry_of[i] = -1;
+	for(j=0;j<g_opcode_output_table_length;j++)
+	{
+		opcode_struct* op = g_opcode_output_table + j;
+		for(i=0;i<0x10000;i++)
+			if((i & op->op_mask) == op->op_match)
+				entry_of[i] = j;
+	}
 
-/* Write an entry in the opcode handler table */
-static void write_table_entry(FILE* filep, opcode_struct* op)
-{
-	int i;
+	/* Class 0 is the illegal instruction */
+	g_class_entry[0] = -1;
+	g_num_classes = 1;
+	for(j=0;j<g_opcode_output_table_length;j++)
+	{
+		opcode_struct* op = g_opcode_output_table + j;
+		class_of_entry[j] = -1;
+		for(k=1;k<g_num_classes;k++)
+		{
+			opcode_struct* other = g_opcode_output_table + g_class_entry[k];
+			if(strcmp(other->name, op->name) == 0 && other->cycles[0] == op->cycles[0])
+				break;
+		}
+		if(k == g_num_classes)
+			g_class_entry[g_num_classes++] = j;
+		class_of_entry[j] = k;
+	}
+	for(i=0;i<0x10000;i++)
+		g_opcode_class[i] = entry_of[i] < 0 ? 0 : class_of_entry[entry_of[i]];
 
-	fprintf(filep, "\t{%-28s, 0x%04x, 0x%04x, {",
-		op->name, op->op_mask, op->op_match);
+	for(i=0;i<OPCODE_BLOCK_COUNT;i++)
+	{
+		for(k=0;k<g_num_blocks;k++)
+			if(memcmp(g_opcode_class + (i << OPCODE_BLOCK_SHIFT), g_opcode_class + (block_first[k] << OPCODE_BLOCK_SHIFT), sizeof(g_opcode_class[0]) << OPCODE_BLOCK_SHIFT) == 0)
+				break;
+		if(k == g_num_blocks)
+			block_first[g_num_blocks++] = i;
+		g_block_index[i] = k;
+	}
 
-	for(i=0;i<NUM_CPUS;i++)
+	write_class_entry(filep, "m68k_op_illegal", 0);
+	for(k=1;k<g_num_classes;k++)
 	{
-		fprintf(filep, "%3d", op->cycles[i]);
-		if(i < NUM_CPUS-1)
-			fprintf(filep, ", ");
+		opcode_struct* op = g_opcode_output_table + g_class_entry[k];
+		write_class_entry(filep, op->name, op->cycles[0]);
 	}
+	fprintf(filep, "};\n\n\n");
 
-	fprintf(filep, "}},\n");
+	fprintf(filep, "/* Class of each opcode, in blocks of %d */\n", OPCODE_BLOCK_SIZE);
+	fprintf(filep, "const unsigned short m68ki_opcode_blocks[%d][%d] =\n{\n", g_num_blocks, OPCODE_BLOCK_SIZE);
+	for(k=0;k<g_num_blocks;k++)
+	{
+		fprintf(filep, "\t{");
+		for(i=0;i<OPCODE_BLOCK_SIZE;i++)
+			fprintf(filep, "%s%d", i ? "," : "", g_opcode_class[(block_first[k] << OPCODE_BLOCK_SHIFT) + i]);
+		fprintf(filep, "},\n");
+	}
+	fprintf(filep, "};\n\n\n");
+
+	fprintf(filep, "/* Block of each group of %d opcodes */\n", OPCODE_BLOCK_SIZE);
+	fprintf(filep, "const unsigned short m68ki_opcode_block_index[%d] =\n{", OPCODE_BLOCK_COUNT);
+	for(i=0;i<OPCODE_BLOCK_COUNT;i++)
+		fprintf(filep, "%s%d", (i & 15) ? "," : (i ? ",\n\t" : "\n\t"), g_block_index[i]);
+	fprintf(filep, "\n};\n");
+}
+
+/* Write an entry in the opcode class table */
+static void write_class_entry(FILE* filep, const char* name, int cycles)
+{
+	fprintf(filep, "\t{%-28s, %3d},\n", name, cycles);
 }
 
 /* Fill out an opcode struct with a specific addressing mode of the source opcode struct */
@@ -1421,6 +1492,7 @@ int main(int argc, char *argv[])
 	fclose(g_input_file);
 
 	printf("Generated %d opcode handlers from %d primitives\n", g_num_functions, g_num_primitives);
+	printf("Dispatch: %d classes in %d blocks\n", g_num_classes, g_num_blocks);
 
 	return 0;
 }
@@ -6,11 +6,7 @@
 /* ======================================================================== */
 
 
-/* Build the opcode handler table */
-void m68ki_build_opcode_table(void);
-
-extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
-extern unsigned char m68ki_cycles[][0x10000];
+/* The dispatch tables themselves are declared in m68kcpu.h */
 
 
 /* ======================================================================== */
@@ -490,6 +490,156 @@ static void recompute_and_set_memory_maps(
 
 #ifdef USE_M68K
 
+static uint32 cycles_until_next_timer(struct SATSOUND_STATE *state);
+
+//
+// Poll loop detection
+//
+// A driver waiting on a timer or interrupt flag keeps reading the same
+// register from the same instruction and keeps getting the same value.
+// Once that's been seen twice in a row, and the loop around the read is
+// nothing but compares and branches, the value can't change before the
+// next timer expires, so the SCPU just burns the cycles up to that point.
+// Only registers that nothing but a timer or an SCPU write can change
+// qualify; writes to the sound registers reset detection.
+//
+#define POLL_WINDOW    (200)
+#define POLL_MAXINS    (8)
+#define POLL_CONFIRMED (0x0001)
+#define POLL_REJECTED  (0x2000)
+#define POLL_KEY       (0x1FFE)
+
+//
+// Extension words used by an effective address, or -1 if it's not one a
+// poll loop may use: no (An)+/-(An), and memory only for the polled read
+//
+static sint32 satsound_poll_ea_words(uint32 ea, uint32 size, uint32 memory) {
+  switch((ea >> 3) & 7) {
+  case 0: case 1: return 0;
+  case 2: return memory ? 0 : -1;
+  case 5: case 6: return memory ? 1 : -1;
+  case 7:
+    switch(ea & 7) {
+    case 0: case 2: case 3: return memory ? 1 : -1;
+    case 1: return memory ? 2 : -1;
+    case 4: return (size == 2) ? 2 : 1;
+    }
+  }
+  return -1;
+}
+
+//
+// Length in words of an instruction that may appear in a poll loop, or 0 if
+// it may not. The polled read itself may be a MOVE to a data register, TST,
+// BTST, CMP or CMPI from memory; everything else in the loop may only
+// compare registers and immediates. Branches are handled by the caller.
+//
+static uint32 satsound_poll_insn_words(uint32 w, uint32 polled) {
+  uint32 size = (w >> 6) & 3;
+  sint32 ext = -1;
+  if(polled && (w & 0xC000) == 0 && (w & 0x3000) && !(w & 0x01C0)) {
+    // MOVE <ea>,Dn
+    static const uint8 movesize[4] = { 0, 0, 2, 1 };
+    ext = satsound_poll_ea_words(w, movesize[(w >> 12) & 3], 1);
+  } else if((w & 0xFF00) == 0x4A00 && size != 3) {
+    // TST
+    ext = satsound_poll_ea_words(w, size, polled);
+  } else if((w & 0xFF00) == 0x0C00 && size != 3) {
+    // CMPI
+    ext = satsound_poll_ea_words(w, size, polled);
+    if(ext >= 0) ext += (size == 2) ? 2 : 1;
+  } else if((w & 0xFFC0) == 0x0800) {
+    // BTST #n
+    ext = satsound_poll_ea_words(w, 0, polled);
+    if(ext >= 0) ext += 1;
+  } else if((w & 0xF1C0) == 0x0100 && (w & 0x38) != 0x08) {
+    // BTST Dn (mode 1 would be MOVEP)
+    ext = satsound_poll_ea_words(w, 0, polled);
+  } else if((w & 0xF000) == 0xB000 && ((w >> 6) & 7) != 4 && ((w >> 6) & 7) != 5 && ((w >> 6) & 7) != 6) {
+    // CMP, CMPA (opmodes 4-6 are EOR/CMPM)
+    ext = satsound_poll_ea_words(w, (w & 0x0100) ? 2 : size, polled);
+  }
+  if(ext < 0) return 0;
+  // the polled read has to actually read memory
+  if(polled && ((w >> 3) & 7) < 2) return 0;
+  if(polled && ((w >> 3) & 7) == 7 && (w & 7) == 4) return 0;
+  return 1 + ext;
+}
+
+//
+// Check that the loop around the read at pc has no side effects: from pc
+// on it has to reach a branch back to the start of the loop, and from that
+// start it has to reach pc, through allowed instructions and at most
+// POLL_MAXINS of each. Forward branches out of the loop are fine.
+//
+static uint32 satsound_poll_loop_ok(struct SATSOUND_STATE *state, uint32 pc) {
+  uint32 a, n, w, len, start = 0xFFFFFFFF;
+  pc &= 0xFFFFFF;
+  if(pc >= 0x80000) return 0;
+  a = pc;
+  for(n = 0; n < POLL_MAXINS && a < 0x80000; n++) {
+    w = *((uint16*)(RAMBYTEPTR + a));
+    if(n && (w & 0xF000) == 0x6000 && (w & 0x0F00) != 0x0100) {
+      sint32 disp = (sint8)(w & 0xFF);
+      if((w & 0xFF) == 0xFF) return 0;
+      len = 1;
+      if(!disp) {
+        if(a + 2 >= 0x80000) return 0;
+        disp = (sint16)(*((uint16*)(RAMBYTEPTR + a + 2)));
+        len = 2;
+      }
+      if(a + 2 + disp <= pc) { start = a + 2 + disp; break; }
+      // BRA forward leaves the loop for good
+      if(!(w & 0x0F00)) return 0;
+    } else {
+      len = satsound_poll_insn_words(w, n == 0);
+      if(!len) return 0;
+    }
+    a += 2 * len;
+  }
+  if(start == 0xFFFFFFFF) return 0;
+  for(a = start, n = 0; a < pc && n < POLL_MAXINS; n++) {
+    len = satsound_poll_insn_words(*((uint16*)(RAMBYTEPTR + a)), 0);
+    if(!len) return 0;
+    a += 2 * len;
+  }
+  return a == pc;
+}
+
+static void satsound_poll_detect(struct SATSOUND_STATE *state, uint32 address, uint32 value) {
+  cpu_idle_t *poll = &(SCPUSTATE->poll);
+  uint32 now = state->cycles_executed;
+  uint32 key;
+  address &= 0xFFE;
+  if(address >= 0x400 && (address < 0x41E || address >= 0x430)) {
+    poll->detected = 0;
+    return;
+  }
+  key = 0x1000 | address;
+  if(
+    (poll->detected & POLL_KEY) == key &&
+    poll->pc == SCPUSTATE->ppc &&
+    poll->value == value &&
+    now <= poll->cycle
+  ) {
+    if(poll->detected & POLL_CONFIRMED) {
+      sint32 skip = cycles_until_next_timer(state);
+      if(skip > SCPUSTATE->remaining_cycles) { skip = SCPUSTATE->remaining_cycles; }
+      if(skip > 0) {
+        SCPUSTATE->remaining_cycles -= skip;
+        poll->skipped += skip;
+      }
+    } else if(!(poll->detected & POLL_REJECTED)) {
+      poll->detected |= satsound_poll_loop_ok(state, SCPUSTATE->ppc) ? POLL_CONFIRMED : POLL_REJECTED;
+    }
+  } else {
+    poll->detected = key;
+  }
+  poll->pc = SCPUSTATE->ppc;
+  poll->value = value;
+  poll->cycle = now + POLL_WINDOW;
+}
+
 static unsigned int satsound_read_dummy(void *param, unsigned int address)
 {
   return 0;
@@ -503,8 +653,11 @@ static unsigned int satsound_apu_read8(void *state, unsigned int address)
 {
   if (address >= 0x100000 && address < 0x100c00) {
     int shift = ((address & 1) ^ 1) * 8;
+    unsigned int d;
     satsound_advancesync(SATSOUNDSTATE);
-    return (yam_scsp_load_reg(YAMSTATE, address & 0xFFE, 0xFF << shift) >> shift) & 0xFF;
+    d = (yam_scsp_load_reg(YAMSTATE, address & 0xFFE, 0xFF << shift) >> shift) & 0xFF;
+    satsound_poll_detect(SATSOUNDSTATE, address, d);
+    return d;
   }
 
   return 0;
@@ -513,8 +666,11 @@ static unsigned int satsound_apu_read8(void *state, unsigned int address)
 static unsigned int satsound_apu_read16(void *state, unsigned int address)
 {
   if (address >= 0x100000 && address < 0x100c00) {
+    unsigned int d;
     satsound_advancesync(SATSOUNDSTATE);
-    return yam_scsp_load_reg(YAMSTATE, address & 0xFFE, 0xFFFF) & 0xFFFF;
+    d = yam_scsp_load_reg(YAMSTATE, address & 0xFFE, 0xFFFF) & 0xFFFF;
+    satsound_poll_detect(SATSOUNDSTATE, address, d);
+    return d;
   }
 
   return 0;
@@ -526,6 +682,7 @@ static void satsound_apu_write8(void *state, unsigned int address, unsigned int
     uint8 breakcpu = 0;
     int shift = ((address & 1) ^ 1) * 8;
     satsound_advancesync(SATSOUNDSTATE);
+    SCPUSTATE->poll.detected = 0;
     //printf("satsound_yam_writebyte(%08X,%08X)\n",address,data);
     yam_scsp_store_reg(
       YAMSTATE,
@@ -546,6 +703,7 @@ static void satsound_apu_write16(void *state, unsigned int address, unsigned int
   if (address >= 0x100000 && address < 0x100c00) {
     uint8 breakcpu = 0;
     satsound_advancesync(SATSOUNDSTATE);
+    SCPUSTATE->poll.detected = 0;
     //printf("satsound_yam_writebyte(%08X,%08X)\n",address,data);
     yam_scsp_store_reg(
       YAMSTATE,
@@ -610,16 +768,28 @@ static void recompute_and_set_memory_maps(
 // This is then used as an upper bound for how many cycles can be executed
 // before checking for futher interrupts
 //
-static uint32 cycles_until_next_interrupt(struct SATSOUND_STATE *state) {
-  uint32 yamsamples;
+static uint32 cycles_until_samples(struct SATSOUND_STATE *state, uint32 yamsamples) {
   uint32 yamcycles;
-  yamsamples = yam_get_min_samples_until_interrupt(YAMSTATE);
   if(yamsamples > 0x10000) { yamsamples = 0x10000; }
   yamcycles = yamsamples * CYCLES_PER_SAMPLE;
   if(yamcycles <= state->cycles_ahead_of_sound) return 1;
   return yamcycles - state->cycles_ahead_of_sound;
 }
 
+static uint32 cycles_until_next_interrupt(struct SATSOUND_STATE *state) {
+  return cycles_until_samples(state, yam_get_min_samples_until_interrupt(YAMSTATE));
+}
+
+#ifdef USE_M68K
+//
+// Same for any timer, including those that only set a pending bit;
+// bounds how far a poll loop can be skipped
+//
+static uint32 cycles_until_next_timer(struct SATSOUND_STATE *state) {
+  return cycles_until_samples(state, yam_get_min_samples_until_timer(YAMSTATE));
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Executes the given number of cycles or the given number of samples
@@ -676,6 +846,7 @@ sint32 EMU_CALL satsound_execute(
   SATSOUNDSTATE->scpu_odometer_checkpoint = s68000_read_odometer(SCPUSTATE);
 #elif defined(USE_M68K)
   SATSOUNDSTATE->scpu_odometer_checkpoint = 0;
+  SCPUSTATE->poll.detected = 0;
 #else
   SATSOUNDSTATE->scpu_odometer_checkpoint = 0;
 #endif
@@ -799,6 +970,9 @@ uint16 EMU_CALL satsound_getword(void *state, uint32 a) {
 
 void EMU_CALL satsound_setword(void *state, uint32 a, uint16 d) {
   *((uint16*)(RAMBYTEPTR+(a&0x7FFFE))) = d;
+#if defined(USE_M68K) && M68K_DECODE_CACHE
+  m68k_invalidate_code(SCPUSTATE, a&0x7FFFE);
+#endif
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -816,3 +990,41 @@ uint32 EMU_CALL satsound_get_pc(void *state) {
 }
 
 /////////////////////////////////////////////////////////////////////////////
+//
+// Get the number of SCPU cycles skipped in idle loops so far
+//
+uint64 EMU_CALL satsound_get_idle_skipped_cycles(void *state) {
+#ifdef USE_M68K
+  return SCPUSTATE->poll.skipped;
+#else
+  return 0;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// SCPU dynarec control (x86-64 Linux Musashi builds; a no-op elsewhere)
+//
+sint32 EMU_CALL satsound_enable_dynarec(void *state, uint8 enable) {
+#if defined(USE_M68K) && M68K_DYNAREC
+  return m68k_enable_dynarec(SCPUSTATE, enable);
+#else
+  return 0;
+#endif
+}
+
+sint32 EMU_CALL satsound_prepare_dynacode(void *state) {
+#if defined(USE_M68K) && M68K_DYNAREC
+  return m68k_prepare_dynacode(SCPUSTATE);
+#else
+  return 0;
+#endif
+}
+
+void EMU_CALL satsound_unprepare_dynacode(void *state) {
+#if defined(USE_M68K) && M68K_DYNAREC
+  m68k_unprepare_dynacode(SCPUSTATE);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////
@@ -64,6 +64,24 @@ sint32 EMU_CALL satsound_execute(
 //
 uint32 EMU_CALL satsound_get_pc(void *state);
 
+//
+// Get the number of SCPU cycles skipped in idle loops so far (Musashi
+// builds only, 0 elsewhere)
+//
+uint64 EMU_CALL satsound_get_idle_skipped_cycles(void *state);
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// SCPU dynarec; x86-64 Linux Musashi builds only, a no-op elsewhere.
+// Enabling makes the state's code buffer executable, and returns negative
+// (leaving the dynarec off) if it can't. If the state is moved, call
+// satsound_prepare_dynacode again at the new address; until then it
+// interprets. Disable it before freeing the state.
+//
+sint32 EMU_CALL satsound_enable_dynarec(void *state, uint8 enable);
+sint32 EMU_CALL satsound_prepare_dynacode(void *state);
+void   EMU_CALL satsound_unprepare_dynacode(void *state);
+
 /////////////////////////////////////////////////////////////////////////////
 
 #ifdef __cplusplus
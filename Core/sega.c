@@ -304,4 +304,16 @@ void EMU_CALL sega_enable_dsp_dynarec(void *state, uint8 enable) {
   if(yamstate) yam_enable_dsp_dynarec(yamstate, enable);
 }
 
+sint32 EMU_CALL sega_enable_arm_dynarec(void *state, uint8 enable) {
+  if(HAVE_DCSOUND) return arm_enable_dynarec(dcsound_get_arm_state(DCSOUNDSTATE), enable);
+  return 0;
+}
+
+sint32 EMU_CALL sega_enable_scpu_dynarec(void *state, uint8 enable) {
+#ifndef DISABLE_SSF
+  if(HAVE_SATSOUND) return satsound_enable_dynarec(SATSOUNDSTATE, enable);
+#endif
+  return 0;
+}
+
 /////////////////////////////////////////////////////////////////////////////
@@ -94,6 +94,13 @@ uint32 EMU_CALL sega_get_pc(void *state);
 void EMU_CALL sega_enable_dry(void *state, uint8 enable);
 void EMU_CALL sega_enable_dsp(void *state, uint8 enable);
 void EMU_CALL sega_enable_dsp_dynarec(void *state, uint8 enable);
+//
+// The ARM and SCPU dynarecs make their code buffers executable when enabled
+// and return negative (staying off) if that fails. Disable them again before
+// freeing the state.
+//
+sint32 EMU_CALL sega_enable_arm_dynarec(void *state, uint8 enable);
+sint32 EMU_CALL sega_enable_scpu_dynarec(void *state, uint8 enable);
 
 /////////////////////////////////////////////////////////////////////////////
 
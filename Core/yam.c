@@ -41,6 +41,17 @@
 // no 'conversion from _blah_ possible loss of data' warnings
 #pragma warning (disable: 4244)
 
+// SIMD mixing kernels: SSE2 on x86, AVX2 picked at run time when the CPU
+// has it; everything else (Emscripten included) uses the C versions
+#if !defined(EMSCRIPTEN) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define YAM_MIX_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define YAM_MIX_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 
 #define RENDERMAX (200)
@@ -149,9 +160,283 @@ static void convert_stereo_send_level(
   *lin_r = lr;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Register decode tables
+//
+// One entry per register word, so a CPU access finds its handler, and for
+// channel registers the channel and field, with a single lookup instead of
+// a chain of range checks
+//
+#define REG_NONE  (0)  // reads 0, writes ignored
+#define REG_SYS   (1)  // system registers, decoded by address
+#define REG_CHAN  (2)  // slot = channel, field = offset within the channel
+#define REG_EFX   (3)  // AICA effect send level/pan, slot = index
+#define REG_RING  (4)  // SCSP ring buffer window, slot = word offset
+#define REG_COEF  (5)  // slot = index (same for the rest)
+#define REG_MADRS (6)
+#define REG_MPRO  (7)  // field = shift within the 64-bit step
+#define REG_TEMP  (8)
+#define REG_MEMS  (9)
+#define REG_MIXS  (10)
+#define REG_EFREG (11)
+#define REG_EXTS  (12)
+
+struct YAM_REGDECODE {
+  uint8 kind;
+  uint8 slot;
+  uint8 field;
+  uint8 reserved;
+};
+
+//
+// The tables themselves (generated by yammake.c)
+//
+#include "yamtables.h"
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Mixing kernels
+//
+// mono:   out[i] += (in[i] * lin) >> att
+// stereo: out[2*i+0] += (in[i] * lin_l) >> att_l
+//         out[2*i+1] += (in[i] * lin_r) >> att_r
+// clip:   out[i] = (in[i] * lin) >> att, saturated to 16 bits
+//
+// lanes:  one output sample for each of YAM_LANES channels side by side,
+//         see generate_samples_lanes
+//
+// The vector versions do the same 32-bit wrapping multiply and arithmetic
+// shift as the C versions, so results are bit-identical; they leave any
+// leftover samples at the end to the C versions.
+//
+#define YAM_LANES (4)
+
+//
+// Per-lane inputs and filter state for the lanes kernel; out is the result
+//
+struct YAM_LANEDATA {
+  sint32 cur[YAM_LANES], next[YAM_LANES], frc[YAM_LANES];
+  sint32 att[YAM_LANES], lpflevel[YAM_LANES], q[YAM_LANES];
+  sint32 lpp1[YAM_LANES], lpp2[YAM_LANES];
+  sint32 voff[YAM_LANES], lpon[YAM_LANES];
+  sint32 out[YAM_LANES];
+};
+
+struct YAM_MIXER {
+  void (*mono)(sint32 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att);
+  void (*stereo)(sint32 *out, const sint32 *in, uint32 n, sint32 lin_l, uint32 att_l, sint32 lin_r, uint32 att_r);
+  void (*clip)(sint16 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att);
+  void (*lanes)(struct YAM_LANEDATA *d);
+};
+
+static void mix_mono_c(sint32 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att) {
+  uint32 i;
+  for(i = 0; i < n; i++) {
+    out[i] += (in[i] * lin) >> att;
+  }
+}
+
+static void mix_stereo_c(sint32 *out, const sint32 *in, uint32 n, sint32 lin_l, uint32 att_l, sint32 lin_r, uint32 att_r) {
+  uint32 i;
+  for(i = 0; i < n; i++) {
+    out[2 * i + 0] += (in[i] * lin_l) >> att_l;
+    out[2 * i + 1] += (in[i] * lin_r) >> att_r;
+  }
+}
+
+static void mix_clip_c(sint16 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att) {
+  uint32 i;
+  for(i = 0; i < n; i++) {
+    sint32 s = in[i];
+    s *= lin; s >>= att;
+    if(s < (-0x8000)) s = (-0x8000);
+    if(s > ( 0x7FFF)) s = ( 0x7FFF);
+    out[i] = s;
+  }
+}
+
+//
+// Interpolate, attenuate and filter (same math as generate_samples)
+//
+static void mix_lanes_c(struct YAM_LANEDATA *d) {
+  uint32 l;
+  for(l = 0; l < YAM_LANES; l++) {
+    sint32 f = (d->frc[l] >> 4) & 0x3FFF;
+    sint32 s = (d->next[l] * f + d->cur[l] * (0x4000 - f)) >> 14;
+    sint32 a = d->att[l];
+    sint32 v = 0;
+    sint32 fv = d->lpflevel[l];
+    sint32 lf = (((fv & 0xFF) | 0x100) << 4) >> ((fv >> 8) ^ 0x1F);
+    if(a < 0x3C0) { v = (s * (((a & 0x3F) ^ 0x7F) + 1)) >> (7 + (a >> 6)); }
+    if(!d->voff[l]) { s = v; }
+    v = (lf * s + (0x2000 - lf + d->q[l]) * d->lpp1[l] - d->q[l] * d->lpp2[l]) >> 13;
+    if(d->lpon[l]) { d->lpp2[l] = d->lpp1[l]; d->lpp1[l] = v; s = v; }
+    d->out[l] = s << 4;
+  }
+}
+
+#ifdef YAM_MIX_SSE2
+// SSE2 has no 32-bit multiply keeping the low half, so build one
+static __m128i mix_mullo_sse2(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd  = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+  return _mm_unpacklo_epi32(
+    _mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)),
+    _mm_shuffle_epi32(odd , _MM_SHUFFLE(0,0,2,0))
+  );
+}
+
+static void mix_mono_sse2(sint32 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att) {
+  __m128i vlin = _mm_set1_epi32(lin);
+  __m128i vatt = _mm_cvtsi32_si128(att);
+  uint32 i;
+  for(i = 0; i + 4 <= n; i += 4) {
+    __m128i s = mix_mullo_sse2(_mm_loadu_si128((const __m128i*)(in + i)), vlin);
+    __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+    _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi32(o, _mm_sra_epi32(s, vatt)));
+  }
+  mix_mono_c(out + i, in + i, n - i, lin, att);
+}
+
+static void mix_stereo_sse2(sint32 *out, const sint32 *in, uint32 n, sint32 lin_l, uint32 att_l, sint32 lin_r, uint32 att_r) {
+  __m128i vlin  = _mm_setr_epi32(lin_l, lin_r, lin_l, lin_r);
+  __m128i vattl = _mm_cvtsi32_si128(att_l);
+  __m128i vattr = _mm_cvtsi32_si128(att_r);
+  __m128i left  = _mm_setr_epi32(-1, 0, -1, 0);
+  uint32 i;
+  for(i = 0; i + 4 <= n; i += 4) {
+    __m128i s  = _mm_loadu_si128((const __m128i*)(in + i));
+    __m128i lo = mix_mullo_sse2(_mm_unpacklo_epi32(s, s), vlin);
+    __m128i hi = mix_mullo_sse2(_mm_unpackhi_epi32(s, s), vlin);
+    __m128i *o = (__m128i*)(out + 2 * i);
+    lo = _mm_or_si128(_mm_and_si128(left, _mm_sra_epi32(lo, vattl)), _mm_andnot_si128(left, _mm_sra_epi32(lo, vattr)));
+    hi = _mm_or_si128(_mm_and_si128(left, _mm_sra_epi32(hi, vattl)), _mm_andnot_si128(left, _mm_sra_epi32(hi, vattr)));
+    _mm_storeu_si128(o + 0, _mm_add_epi32(_mm_loadu_si128(o + 0), lo));
+    _mm_storeu_si128(o + 1, _mm_add_epi32(_mm_loadu_si128(o + 1), hi));
+  }
+  mix_stereo_c(out + 2 * i, in + i, n - i, lin_l, att_l, lin_r, att_r);
+}
+
+static void mix_clip_sse2(sint16 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att) {
+  __m128i vlin = _mm_set1_epi32(lin);
+  __m128i vatt = _mm_cvtsi32_si128(att);
+  uint32 i;
+  for(i = 0; i + 8 <= n; i += 8) {
+    __m128i a = _mm_sra_epi32(mix_mullo_sse2(_mm_loadu_si128((const __m128i*)(in + i + 0)), vlin), vatt);
+    __m128i b = _mm_sra_epi32(mix_mullo_sse2(_mm_loadu_si128((const __m128i*)(in + i + 4)), vlin), vatt);
+    _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(a, b));
+  }
+  mix_clip_c(out + i, in + i, n - i, lin, att);
+}
+#endif
+
+#ifdef YAM_MIX_AVX2
+#define YAM_AVX2 __attribute__((target("avx2")))
+
+static YAM_AVX2 void mix_mono_avx2(sint32 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att) {
+  __m256i vlin = _mm256_set1_epi32(lin);
+  __m128i vatt = _mm_cvtsi32_si128(att);
+  uint32 i;
+  for(i = 0; i + 8 <= n; i += 8) {
+    __m256i s = _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)(in + i)), vlin);
+    __m256i o = _mm256_loadu_si256((const __m256i*)(out + i));
+    _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi32(o, _mm256_sra_epi32(s, vatt)));
+  }
+  mix_mono_c(out + i, in + i, n - i, lin, att);
+}
+
+static YAM_AVX2 void mix_stereo_avx2(sint32 *out, const sint32 *in, uint32 n, sint32 lin_l, uint32 att_l, sint32 lin_r, uint32 att_r) {
+  __m256i vlin = _mm256_setr_epi32(lin_l, lin_r, lin_l, lin_r, lin_l, lin_r, lin_l, lin_r);
+  __m256i vatt = _mm256_setr_epi32(att_l, att_r, att_l, att_r, att_l, att_r, att_l, att_r);
+  __m256i dup  = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  uint32 i;
+  for(i = 0; i + 4 <= n; i += 4) {
+    __m256i s = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(in + i))), dup);
+    __m256i *o = (__m256i*)(out + 2 * i);
+    s = _mm256_srav_epi32(_mm256_mullo_epi32(s, vlin), vatt);
+    _mm256_storeu_si256(o, _mm256_add_epi32(_mm256_loadu_si256(o), s));
+  }
+  mix_stereo_c(out + 2 * i, in + i, n - i, lin_l, att_l, lin_r, att_r);
+}
+
+static YAM_AVX2 void mix_clip_avx2(sint16 *out, const sint32 *in, uint32 n, sint32 lin, uint32 att) {
+  __m256i vlin = _mm256_set1_epi32(lin);
+  __m128i vatt = _mm_cvtsi32_si128(att);
+  uint32 i;
+  for(i = 0; i + 16 <= n; i += 16) {
+    __m256i a = _mm256_sra_epi32(_mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)(in + i + 0)), vlin), vatt);
+    __m256i b = _mm256_sra_epi32(_mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)(in + i + 8)), vlin), vatt);
+    // packs works within 128-bit lanes, put the quarters back in order
+    _mm256_storeu_si256((__m256i*)(out + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), _MM_SHUFFLE(3,1,2,0)));
+  }
+  mix_clip_c(out + i, in + i, n - i, lin, att);
+}
+
+//
+// The attenuation and filter shifts differ per lane, which needs the AVX2
+// variable shifts; SSE2 has none, so it uses mix_lanes_c
+//
+static YAM_AVX2 void mix_lanes_avx2(struct YAM_LANEDATA *d) {
+  __m128i zero, frc, att, fv, q, lpp1, lpp2;
+  __m128i f, s, v, lf, audible, lpon;
+  // called once per sample from non-VEX code; a dirty upper half here
+  // made every SSE instruction around it pay for the transition
+  _mm256_zeroupper();
+  zero = _mm_setzero_si128();
+  frc  = _mm_loadu_si128((const __m128i*)(d->frc));
+  att  = _mm_loadu_si128((const __m128i*)(d->att));
+  fv   = _mm_loadu_si128((const __m128i*)(d->lpflevel));
+  q    = _mm_loadu_si128((const __m128i*)(d->q));
+  lpp1 = _mm_loadu_si128((const __m128i*)(d->lpp1));
+  lpp2 = _mm_loadu_si128((const __m128i*)(d->lpp2));
+  // interpolate
+  f = _mm_and_si128(_mm_srai_epi32(frc, 4), _mm_set1_epi32(0x3FFF));
+  s = _mm_add_epi32(
+    _mm_mullo_epi32(_mm_loadu_si128((const __m128i*)(d->next)), f),
+    _mm_mullo_epi32(_mm_loadu_si128((const __m128i*)(d->cur)), _mm_sub_epi32(_mm_set1_epi32(0x4000), f))
+  );
+  s = _mm_srai_epi32(s, 14);
+  // attenuate, silent from 0x3C0 on
+  v = _mm_add_epi32(_mm_xor_si128(_mm_and_si128(att, _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x7F)), _mm_set1_epi32(1));
+  v = _mm_srav_epi32(_mm_mullo_epi32(s, v), _mm_add_epi32(_mm_srai_epi32(att, 6), _mm_set1_epi32(7)));
+  audible = _mm_cmpgt_epi32(_mm_set1_epi32(0x3C0), att);
+  v = _mm_and_si128(v, audible);
+  s = _mm_blendv_epi8(s, v, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(d->voff)), zero));
+  // lowpass
+  lf = _mm_slli_epi32(_mm_or_si128(_mm_and_si128(fv, _mm_set1_epi32(0xFF)), _mm_set1_epi32(0x100)), 4);
+  lf = _mm_srav_epi32(lf, _mm_xor_si128(_mm_srai_epi32(fv, 8), _mm_set1_epi32(0x1F)));
+  v = _mm_add_epi32(_mm_mullo_epi32(lf, s), _mm_mullo_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_set1_epi32(0x2000), lf), q), lpp1));
+  v = _mm_srai_epi32(_mm_sub_epi32(v, _mm_mullo_epi32(q, lpp2)), 13);
+  lpon = _mm_xor_si128(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(d->lpon)), zero), _mm_set1_epi32(-1));
+  _mm_storeu_si128((__m128i*)(d->lpp2), _mm_blendv_epi8(lpp2, lpp1, lpon));
+  _mm_storeu_si128((__m128i*)(d->lpp1), _mm_blendv_epi8(lpp1, v, lpon));
+  s = _mm_blendv_epi8(s, v, lpon);
+  _mm_storeu_si128((__m128i*)(d->out), _mm_slli_epi32(s, 4));
+}
+
+static const struct YAM_MIXER mixer_avx2 = { mix_mono_avx2, mix_stereo_avx2, mix_clip_avx2, mix_lanes_avx2 };
+#endif
+
+#if defined(YAM_MIX_SSE2)
+static struct YAM_MIXER mixer = { mix_mono_sse2, mix_stereo_sse2, mix_clip_sse2, mix_lanes_c };
+#else
+static struct YAM_MIXER mixer = { mix_mono_c, mix_stereo_c, mix_clip_c, mix_lanes_c };
+#endif
+
+//
+// Pick the best kernels this CPU can run
+//
+static void mixer_select(void) {
+#ifdef YAM_MIX_AVX2
+  if(__builtin_cpu_supports("avx2")) { mixer = mixer_avx2; }
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////////////
 
 sint32 EMU_CALL yam_init(void) {
+  mixer_select();
   return 0;
 }
 
@@ -238,6 +523,7 @@ struct YAM_CHAN {
   sint32 adpcmprev;
   sint32 adpcmprev_loopstart;
   uint8 adpcminloop;
+  uint8 adpcmcache; // 1 + decoded loop cache entry in use, or 0 for none
 };
 
 struct MPRO {
@@ -361,6 +647,68 @@ static uint64 mpro_aica_read(struct MPRO *mpro) {
 #define DYNACODE_MAX_SIZE (0x6000)
 #define DYNACODE_SLOP_SIZE (0x80)
 
+//
+// Decoded ADPCM loop cache (AICA only)
+//
+// A forward loop decodes the same way on every pass as long as it's entered
+// with the same predictor state, so it's decoded once into a pool that
+// follows the state structure. Entries are dropped when any page of sound
+// RAM they came from is written.
+//
+#define ADPCMCACHE_ENTRIES (64)
+#define ADPCMCACHE_POOL    (0x40000) // decoded samples
+
+struct YAM_ADPCMCACHE {
+  uint32 sampleaddr;
+  sint32 loopstart;
+  sint32 loopend;
+  sint32 step; // predictor state on entering the loop
+  sint32 prev;
+  uint32 pool; // index of the first decoded sample in the pool
+  uint32 firstbyte; // source bytes
+  uint32 bytes;
+  uint32 gensum; // sum of the page write counters when decoded
+  uint8 valid;
+};
+
+//
+// Queued register write
+//
+// Writes that change the sound are logged with the odometer they happened
+// at rather than flushing on the spot. Drivers tend to write a bunch of
+// registers per tick, and flushing for each would split rendering into a
+// lot of tiny pieces.
+//
+// A channel register write only matters to its own channel, so render
+// applies it partway through, between that channel's samples. Anything
+// else (DSP and common registers, and the few channel registers with
+// effects beyond the channel) ends the render at its sample instead.
+// Either way a write is heard from its own sample on, EFX and DSP writes
+// included; yamtest.c checks that.
+//
+// Channels are rendered one after another, so where a render ends decides
+// which channel gets which numbers from the shared noise generator, and
+// what SCSP modulation reads of the other channels. While anything live
+// uses either, channel writes end the render too, as they did before
+// writes were queued.
+//
+#define WRITEQUEUE_MAX (256)
+#define WRITE_SPLIT    (0xFF)
+
+struct YAM_WRITE {
+  uint32 odometer;
+  uint16 a;
+  uint16 d;
+  uint16 mask;
+  uint8 chan; // channel written, or WRITE_SPLIT
+  uint8 kyonex; // keys every channel on or off as well
+};
+
+struct YAM_ADPCMSAMPLE {
+  sint16 out;
+  uint16 step; // predictor state after this sample
+};
+
 struct YAM_STATE {
   //
   // Misc.
@@ -380,6 +728,9 @@ struct YAM_STATE {
   uint32 randseed;
   uint32 mem_word_address_xor;
   uint32 mem_byte_address_xor;
+  const uint32 *ram_write_gen; // EXTERNALLY-REGISTERED pointer
+  uint32 ram_write_gen_shift;
+  uint32 ram_write_gen_mask;
   //
   // Common regs
   //
@@ -445,6 +796,33 @@ struct YAM_STATE {
   // Channel regs
   //
   struct YAM_CHAN chan[64];
+  uint64 active; // channels whose envlevel isn't 0x1FFF
+  uint8 render_order[64]; // see render_order_build
+  uint8 render_order_valid;
+  //
+  // Channels brought up to date for the status registers, see chan_status
+  // Only good until the next flush
+  //
+  struct YAM_CHAN status[64];
+  uint32 status_odometer[64];
+  uint64 status_valid;
+  //
+  // Queued register writes, oldest first
+  //
+  struct YAM_WRITE writequeue[WRITEQUEUE_MAX];
+  uint32 writequeue_count;
+  uint64 writequeue_chans; // channels they touch (all of them for kyonex)
+  uint8 writequeue_sensitive; // one of them may make a channel split-sensitive
+  //
+  // For yam_get_average_render_span
+  //
+  uint64 render_calls;
+  uint64 render_samples;
+  //
+  // Decoded ADPCM loop cache
+  //
+  struct YAM_ADPCMCACHE adpcmcache[ADPCMCACHE_ENTRIES];
+  uint32 adpcmcache_used; // pool samples in use
   //
   // Buffer for dynarec code
   //
@@ -457,7 +835,10 @@ struct YAM_STATE {
 // Get size
 //
 uint32 EMU_CALL yam_get_state_size(uint8 version) {
-  return sizeof(struct YAM_STATE);
+  uint32 size = sizeof(struct YAM_STATE);
+  // AICA also gets the decoded ADPCM pool
+  if(version == 2) { size += sizeof(struct YAM_ADPCMSAMPLE) * ADPCMCACHE_POOL; }
+  return size;
 }
 
 //
@@ -576,6 +957,20 @@ void EMU_CALL yam_setram(void *state, uint32 *ram, uint32 size, uint8 mbx, uint8
 #endif
 }
 
+static void adpcm_cache_flush(struct YAM_STATE *state);
+
+//
+// Set the per-page RAM write counters (count must be a power of 2)
+// NULL disables the decoded ADPCM loop cache
+//
+void EMU_CALL yam_setramwritegen(void *state, const uint32 *gen, uint32 shift, uint32 count) {
+  if(YAMSTATE->version != 2) { gen = NULL; }
+  YAMSTATE->ram_write_gen = gen;
+  YAMSTATE->ram_write_gen_shift = shift;
+  YAMSTATE->ram_write_gen_mask = count - 1;
+  adpcm_cache_flush(YAMSTATE);
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Set output buffer pointer and begin new execution run
@@ -583,6 +978,7 @@ void EMU_CALL yam_setram(void *state, uint32 *ram, uint32 size, uint8 mbx, uint8
 void EMU_CALL yam_beginbuffer(void *state, sint16 *buf) {
   YAMSTATE->out_buf = buf;
   YAMSTATE->out_pending = 0;
+  YAMSTATE->status_valid = 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -647,28 +1043,43 @@ uint8* EMU_CALL yam_get_interrupt_pending_ptr(void *state) {
 }
 
 //
-// Determine how many samples until the next interrupt
+// Determine how many samples until the next of the given timers expires
 //
-uint32 EMU_CALL yam_get_min_samples_until_interrupt(void *state) {
+static uint32 min_samples_until_timer(struct YAM_STATE *state, uint32 enabled) {
   uint32 min = 0xFFFFFFFF;
   uint32 t, samples;
 
 //return 1;
 
   for(t = 0; t < 3; t++) {
-    if(YAMSTATE->scieb & (1 << (INT_TIMER_A + t))) {
-      samples = 0x100-((uint32)(YAMSTATE->tim[t]));
-      samples <<= YAMSTATE->tctl[t];
-      samples -= (YAMSTATE->odometer) & ((1<<YAMSTATE->tctl[t])-1);
+    if(enabled & (1 << (INT_TIMER_A + t))) {
+      samples = 0x100-((uint32)(state->tim[t]));
+      samples <<= state->tctl[t];
+      samples -= (state->odometer) & ((1<<state->tctl[t])-1);
       if(samples < min) { min = samples; }
     }
   }
-//printf("yam min: ta=%X %02X tb=%X %02X tc=%X %02X min=%u\n",YAMSTATE->tctl[0],YAMSTATE->tim[0],YAMSTATE->tctl[1],YAMSTATE->tim[1],YAMSTATE->tctl[2],YAMSTATE->tim[2],min);
+//printf("yam min: ta=%X %02X tb=%X %02X tc=%X %02X min=%u\n",state->tctl[0],state->tim[0],state->tctl[1],state->tim[1],state->tctl[2],state->tim[2],min);
 // min should never be 1 if the above is correct
 //  if(min < 1) { min = 1; }
   return min;
 }
 
+//
+// Determine how many samples until the next interrupt
+//
+uint32 EMU_CALL yam_get_min_samples_until_interrupt(void *state) {
+  return min_samples_until_timer(YAMSTATE, YAMSTATE->scieb);
+}
+
+//
+// Determine how many samples until the next timer expires, whether or not
+// it's enabled as an interrupt (it sets its pending bit either way)
+//
+uint32 EMU_CALL yam_get_min_samples_until_timer(void *state) {
+  return min_samples_until_timer(YAMSTATE, 0xFFFFFFFF);
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Advance timers and interrupts
@@ -692,10 +1103,11 @@ void EMU_CALL yam_advance(void *state, uint32 samples) {
 //
 // Key on/off
 //
-static void keyon(struct YAM_CHAN *chan) {
+static void keyon(struct YAM_STATE *state, struct YAM_CHAN *chan) {
 //printf("keyon %08X\n",chan);
   // Ignore redundant key-ons
   if(chan->envstate != 3) return;
+  state->active |= ((uint64)1) << (chan - state->chan);
   chan->sampler_dir = 1;
   chan->playpos = 0;
   chan->envlevel = 0x280;
@@ -707,6 +1119,7 @@ static void keyon(struct YAM_CHAN *chan) {
   chan->adpcmprev = 0;
   chan->adpcmprev_loopstart = 0;
   chan->adpcminloop = 0;
+  chan->adpcmcache = 0;
   chan->samplebufcur = 0;
   chan->samplebufnext = 0;
   chan->lp = 0;
@@ -718,48 +1131,42 @@ static void keyoff(struct YAM_CHAN *chan) {
   chan->lpfstate = 3;
 }
 
-/////////////////////////////////////////////////////////////////////////////
 //
-// Estimate play position for a channel
+// What kyonex does to each channel
+//
+static void keyonex(struct YAM_STATE *state, struct YAM_CHAN *chan) {
+  if(chan->kyonb) { keyon(state, chan); }
+  else { keyoff(chan); }
+}
+
+static uint32 chan_kyonex_bit(struct YAM_STATE *state) {
+  return (state->version == 2) ? 0x8000 : 0x1000;
+}
+
+static struct YAM_CHAN *chan_status(struct YAM_STATE *state, uint32 c);
+
 //
-// These are ROUGH approximations, and will not be entirely accurate in the
-// following conditions:
+// Play position as the CPU sees it, for PlayPos and CallAddress
 //
-// - any pitch LFO is applied
-// - bidirectional loop mode
-// - weird values of loopstart or loopend
+// The channel is already caught up, so there's nothing to extrapolate;
+// this only folds positions past the loop end back into the loop and maps
+// backwards loops, as the estimate used to.
 //
-static uint32 calculate_playpos(
-  struct YAM_STATE *state,
-  struct YAM_CHAN *chan
-) {
-  sint32 p, deltap, loopsize;
+static uint32 calculate_playpos(struct YAM_CHAN *chan) {
+  sint32 p, loopsize;
 
   if(!(chan->sampler_dir)) return 0;
 
-  if(state->out_pending > 100) yam_flush(state);
-
   loopsize = chan->loopend - chan->loopstart;
   if(loopsize < 1) { loopsize = 1; }
 
-  { uint32 oct = chan->oct^8;
-    uint32 fns = chan->fns^0x400;
-    uint32 base_phaseinc = fns << oct;
-    // weird ADPCM thing mentioned in official doc
-    if(chan->pcms == 2 && oct >= 0xA) { base_phaseinc <<= 1; }
-    deltap = base_phaseinc * ((uint32)(state->out_pending));
-    deltap &= 0x7FFFFFFF;
-    deltap >>= 18;
-  }
   p = ((uint16)(chan->playpos));
 
   switch(chan->sampler_looptype) {
   case LOOP_NONE:
-    p += deltap;
     if(p >= chan->loopend) p = 0;
     break;
   case LOOP_FORWARDS:
-    p += deltap;
     if(p >= chan->loopstart) {
       p -= chan->loopstart;
       p %= loopsize;
@@ -772,7 +1179,6 @@ static uint32 calculate_playpos(
       p = loopsize - p;
       p += chan->loopstart;
     }
-    p += deltap;
     if(p >= chan->loopstart) {
       p -= chan->loopstart;
       p %= loopsize;
@@ -788,7 +1194,6 @@ static uint32 calculate_playpos(
     if(chan->sampler_dir < 0) {
       p = chan->loopend + loopsize - (p - chan->loopstart);
     }
-    p += deltap;
     if(p >= chan->loopstart) {
       p -= chan->loopstart;
       p %= 2 * loopsize;
@@ -802,6 +1207,22 @@ static uint32 calculate_playpos(
   return p & 0xFFFF;
 }
 
+static void flush_samples(struct YAM_STATE *state, uint32 samples);
+
+//
+// Apply any queued writes before reading back something they may change
+//
+// This only renders up to the last of them. Each write ended a render when
+// it happened before writes were queued, so that adds no render boundary
+// that wasn't there anyway, which matters to channels using noise.
+//
+static void apply_queued_writes(struct YAM_STATE *state) {
+  if(state->writequeue_count) {
+    uint32 base = state->odometer - state->out_pending;
+    flush_samples(state, state->writequeue[state->writequeue_count - 1].odometer - base);
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Channel registers
@@ -809,7 +1230,9 @@ static uint32 calculate_playpos(
 static uint32 chan_scsp_load_reg(struct YAM_STATE *state, uint8 ch, uint8 a) {
   struct YAM_CHAN *chan = state->chan + (((uint32)ch) & 0x1F);
   uint16 d = 0;
-  // don't really need a flush for loading chan regs
+  // don't really need a flush for loading chan regs, unless there are
+  // writes to them still queued
+  if((state->writequeue_chans >> (chan - state->chan)) & 1) { apply_queued_writes(state); }
   switch(a & 0x1E) {
   case 0x00: // PlayControl
     d  = (((uint32)(chan->kyonb           )) & 0x0001) << 11;
@@ -882,7 +1305,6 @@ static void chan_scsp_store_reg(struct YAM_STATE *state, uint8 ch, uint8 a, uint
   struct YAM_CHAN *chan;
   a &= 0x1E;
   if(a >= 0x18) return;
-  yam_flush(YAMSTATE);
   chan = state->chan + (((uint32)ch) & 0x1F);
   switch(a & 0x1E) {
   case 0x00: // PlayControl
@@ -905,13 +1327,7 @@ static void chan_scsp_store_reg(struct YAM_STATE *state, uint8 ch, uint8 a, uint
         int ch;
 //for(ch=0;ch<32;ch++){printf("%d",state->chan[ch].envstate);}printf("\n");
         for(ch = 0; ch < 32; ch++) {
-          if(state->chan[ch].kyonb) {
-//printf("*");
-            keyon(state->chan + ch);
-          } else {
-//printf(".");
-            keyoff(state->chan + ch);
-          }
+          keyonex(state, state->chan + ch);
         }
 //printf("\n");
 //for(ch=0;ch<32;ch++){printf("%d",state->chan[ch].envstate);}printf("\n");
@@ -977,6 +1393,7 @@ static void chan_scsp_store_reg(struct YAM_STATE *state, uint8 ch, uint8 a, uint
       chan->mdxsl |= (d >> 6) & 0x3C;
       chan->mdl = (d >> 12) & 0xF;
     }
+    state->render_order_valid = 0;
     break;
   case 0x10: // SampleRatePitch
     if(mask & 0x00FF) {
@@ -1028,7 +1445,9 @@ static void chan_scsp_store_reg(struct YAM_STATE *state, uint8 ch, uint8 a, uint
 static uint32 chan_aica_load_reg(struct YAM_STATE *state, uint8 ch, uint8 a) {
   struct YAM_CHAN *chan = state->chan + (((uint32)ch) & 0x3F);
   uint16 d = 0;
-  // don't really need a flush for loading chan regs
+  // don't really need a flush for loading chan regs, unless there are
+  // writes to them still queued
+  if((state->writequeue_chans >> (chan - state->chan)) & 1) { apply_queued_writes(state); }
   switch(a & 0x7C) {
   case 0x00: // PlayControl
     d  = (((uint32)(chan->kyonb           )) & 0x0001) << 14;
@@ -1114,7 +1533,6 @@ static void chan_aica_store_reg(struct YAM_STATE *state, uint8 ch, uint8 a, uint
   struct YAM_CHAN *chan;
   a &= 0x7C;
   if(a >= 0x48) return;
-  yam_flush(YAMSTATE);
   chan = state->chan + (((uint32)ch) & 0x3F);
   switch(a) {
   case 0x00: // PlayControl
@@ -1133,8 +1551,7 @@ static void chan_aica_store_reg(struct YAM_STATE *state, uint8 ch, uint8 a, uint
       if(d & 0x8000) { // kyonex
         int ch;
         for(ch = 0; ch < 64; ch++) {
-          if(state->chan[ch].kyonb) { keyon(state->chan + ch); }
-          else { keyoff(state->chan + ch); }
+          keyonex(state, state->chan + ch);
         }
       }
     }
@@ -1253,7 +1670,6 @@ static void coef_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask)
 #ifdef ENABLE_DYNAREC
   sint16 old = state->coef[n];
 #endif
-  yam_flush(state);
   n &= 0x7F;
   state->coef[n] <<= 3;
   state->coef[n] &= ~mask;
@@ -1268,7 +1684,6 @@ static void madrs_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask
 #ifdef ENABLE_DYNAREC
   uint16 old = state->madrs[n];
 #endif
-  yam_flush(state);
   n &= 0x3F;
   state->madrs[n] &= ~mask;
   state->madrs[n] |= d & mask;
@@ -1284,7 +1699,6 @@ static uint32 temp_read(struct YAM_STATE *state, uint32 n) {
 }
 
 static void temp_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask) {
-  yam_flush(state);
   switch(n & 1) {
   case 0: mask &= 0x00FF; break;
   case 1: mask &= 0xFFFF; mask <<= 8; d <<= 8; break;
@@ -1304,7 +1718,6 @@ static uint32 mems_read(struct YAM_STATE *state, uint32 n) {
 }
 
 static void mems_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask) {
-  yam_flush(state);
   switch(n & 1) {
   case 0: mask &= 0x00FF; break;
   case 1: mask &= 0xFFFF; mask <<= 8; d <<= 8; break;
@@ -1330,7 +1743,6 @@ static uint32 efreg_read(struct YAM_STATE *state, uint32 n) {
 }
 
 static void efreg_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask) {
-  yam_flush(state);
   state->efreg[n & 0xF] &= ~mask;
   state->efreg[n & 0xF] |= d & mask;
 }
@@ -1341,7 +1753,6 @@ static uint32 exts_read(struct YAM_STATE *state, uint32 n) {
 }
 
 static void exts_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask) {
-  yam_flush(state);
   state->inputs[0x30 + (n & 1)] >>= 8;
   state->inputs[0x30 + (n & 1)] &= ~mask;
   state->inputs[0x30 + (n & 1)] |= d & mask;
@@ -1349,110 +1760,254 @@ static void exts_write(struct YAM_STATE *state, uint32 n, uint32 d, uint32 mask)
   state->inputs[0x30 + (n & 1)] >>= 8;
 }
 
-static uint32 dsp_scsp_load_reg(struct YAM_STATE *state, uint32 a) {
-  a &= 0xFFE;
-  if(a < 0x700) return 0;
-  if(a < 0x780) return state->coef[(a/2) & 0x3F] << 3;
-  if(a < 0x7C0) return state->madrs[(a/2) & 0x1F];
-  if(a < 0x800) return 0;
-  if(a < 0xC00) {
-    uint8 shift = ((a&6)^6) * 8;
-    uint32 index = ((a-0x800)/8)&0x7F;
-    return (mpro_scsp_read(state->mpro + index) >> shift) & 0xFFFF;
-  }
-  if(a < 0xE00) return temp_read(state, (a/2) & 0xFF);
-  if(a < 0xE80) return mems_read(state, (a/2) & 0x3F);
-  if(a < 0xEC0) return mixs_read(state, (a/2) & 0x1F);
-  if(a < 0xEE0) return efreg_read(state, (a/2) & 0xF);
-  if(a < 0xEE4) return exts_read(state, (a/2) & 1);
+//
+// DSP register kinds common to both chips (everything but MPRO)
+//
+static uint32 dsp_load_reg(struct YAM_STATE *state, const struct YAM_REGDECODE *r) {
+  switch(r->kind) {
+  case REG_COEF:  apply_queued_writes(state); return state->coef[r->slot] << 3;
+  case REG_MADRS: apply_queued_writes(state); return state->madrs[r->slot];
+  case REG_TEMP:  return temp_read(state, r->slot);
+  case REG_MEMS:  return mems_read(state, r->slot);
+  case REG_MIXS:  return mixs_read(state, r->slot);
+  case REG_EFREG: return efreg_read(state, r->slot);
+  case REG_EXTS:  return exts_read(state, r->slot);
+  }
   return 0;
 }
 
-static void dsp_scsp_store_reg(
+static void dsp_store_reg(
+  struct YAM_STATE *state, const struct YAM_REGDECODE *r,
+  uint32 d, uint32 mask
+) {
+  switch(r->kind) {
+  case REG_COEF:  coef_write(state, r->slot, d, mask); break;
+  case REG_MADRS: madrs_write(state, r->slot, d, mask); break;
+  case REG_TEMP:  temp_write(state, r->slot, d, mask); break;
+  case REG_MEMS:  mems_write(state, r->slot, d, mask); break;
+  // you can't write to MIXS, at least not meaningfully
+  case REG_EFREG: efreg_write(state, r->slot, d, mask); break;
+  case REG_EXTS:  exts_write(state, r->slot, d, mask); break;
+  }
+}
+
+static void mpro_scsp_store_reg(
   struct YAM_STATE *state,
-  uint32 a, uint32 d, uint32 mask
+  uint32 index64, uint32 shift64, uint32 d, uint32 mask
 ) {
-  a &= 0xFFE;
-  if(a < 0x700) { return; }
-  if(a < 0x780) { coef_write(state, (a/2) & 0x3F, d, mask); return; }
-  if(a < 0x7C0) { madrs_write(state, (a/2) & 0x1F, d, mask); return; }
-  if(a < 0x800) { return; }
-  if(a < 0xC00) {
-    uint8 shift64 = ((a&6)^6) * 8;
-    uint32 index64 = ((a-0x800)/8)&0x7F;
-    uint64 mask64sh = ((uint64)(mask & 0xFFFF)) << shift64;
-    uint64 dm64sh = ((uint64)(d & mask & 0xFFFF)) << shift64;
-    uint64 oldvalue = mpro_scsp_read(state->mpro + index64);
-    uint64 newvalue = (oldvalue & (~mask64sh)) | dm64sh;
-    if(newvalue != oldvalue) {
-      yam_flush(state);
-      mpro_scsp_write(state->mpro + index64, newvalue);
+  uint64 mask64sh = ((uint64)(mask & 0xFFFF)) << shift64;
+  uint64 dm64sh = ((uint64)(d & mask & 0xFFFF)) << shift64;
+  uint64 oldvalue = mpro_scsp_read(state->mpro + index64);
+  uint64 newvalue = (oldvalue & (~mask64sh)) | dm64sh;
+  if(newvalue != oldvalue) {
+    mpro_scsp_write(state->mpro + index64, newvalue);
+#ifdef ENABLE_DYNAREC
+    state->dsp_dyna_valid = 0;
+#endif
+  }
+}
+
+static void mpro_aica_store_reg(
+  struct YAM_STATE *state,
+  uint32 index64, uint32 shift64, uint32 d, uint32 mask
+) {
+  uint64 mask64sh = ((uint64)(mask & 0xFFFF)) << shift64;
+  uint64 dm64sh = ((uint64)(d & mask & 0xFFFF)) << shift64;
+  uint64 oldvalue = mpro_aica_read(state->mpro + index64);
+  uint64 newvalue = (oldvalue & (~mask64sh)) | dm64sh;
+  if(newvalue != oldvalue) {
+    mpro_aica_write(state->mpro + index64, newvalue);
+#ifdef ENABLE_DYNAREC
+    state->dsp_dyna_valid = 0;
+#endif
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Register writes that affect the sound, applied in order by yam_flush
+//
+static void scsp_store_sound_reg(struct YAM_STATE *state, uint32 a, uint32 d, uint32 mask) {
+  const struct YAM_REGDECODE *r = scsp_regdecode + (a / 2);
+  switch(r->kind) {
+  case REG_SYS:  break;
+  case REG_CHAN: chan_scsp_store_reg(state, r->slot, r->field, d, mask); return;
+  case REG_MPRO: mpro_scsp_store_reg(state, r->slot, r->field, d, mask); return;
+  default:       dsp_store_reg(state, r, d, mask); return;
+  }
+  switch(a) {
+  case 0x400: // MasterVolume
+    if(mask & 0x00FF) {
+      state->mvol   = d & 0xF;
+    }
+    break;
+  case 0x402: // RingBufferAddress
+    { uint32 oldrbp = state->rbp;
+      uint8 oldrbl = state->rbl;
+      if(mask & 0x00FF) {
+        state->rbp = (((uint32)d) & 0x7F) << 13;
+        state->rbl &= 2;
+        state->rbl |= (d >> 7) & 1;
+      }
+      if(mask & 0xFF00) {
+        state->rbl &= 1;
+        state->rbl |= (d >> 7) & 2;
+      }
+      if((oldrbp != state->rbp) || (oldrbl != state->rbl)) {
 #ifdef ENABLE_DYNAREC
-      state->dsp_dyna_valid = 0;
+        state->dsp_dyna_valid = 0;
 #endif
+      }
     }
+    break;
+  }
+}
+
+static void aica_store_sound_reg(struct YAM_STATE *state, uint32 a, uint32 d, uint32 mask) {
+  const struct YAM_REGDECODE *r = aica_regdecode + (a / 4);
+  switch(r->kind) {
+  case REG_SYS:  break;
+  case REG_CHAN: chan_aica_store_reg(state, r->slot, r->field, d, mask); return;
+  case REG_EFX:
+    if(mask & 0x00FF) { state->efpan[r->slot] = d & 0x1F; }
+    if(mask & 0xFF00) { state->efsdl[r->slot] = (d >> 8) & 0x0F; }
     return;
+  case REG_MPRO: mpro_aica_store_reg(state, r->slot, r->field, d, mask); return;
+  default:       dsp_store_reg(state, r, d, mask); return;
+  }
+  switch(a) {
+  case 0x2800: // MasterVolume
+    if(mask & 0x00FF) {
+      state->mvol   = d & 0xF;
+    }
+    if(mask & 0xFF00) {
+      state->mono   = (d >> 15) & 1;
+    }
+    break;
+  case 0x2804: // RingBufferAddress
+    { uint32 oldrbp = state->rbp;
+      uint8 oldrbl = state->rbl;
+      if(mask & 0x00FF) {
+        state->rbp >>= 11;
+        state->rbp &= 0xF00;
+        state->rbp |= d & 0x0FF;
+        state->rbp <<= 11;
+      }
+      if(mask & 0xFF00) {
+        state->rbp >>= 11;
+        state->rbp &= 0x0FF;
+        state->rbp |= d & 0xF00;
+        state->rbp <<= 11;
+        state->rbl = (d >> 13) & 3;
+      }
+      if((oldrbp != state->rbp) || (oldrbl != state->rbl)) {
+#ifdef ENABLE_DYNAREC
+        state->dsp_dyna_valid = 0;
+#endif
+      }
+    }
+    break;
   }
-  if(a < 0xE00) { temp_write(state, (a/2) & 0xFF, d, mask); return; }
-  if(a < 0xE80) { mems_write(state, (a/2) & 0x3F, d, mask); return; }
-  // you can't write to MIXS, at least not meaningfully
-  if(a < 0xEC0) { return; }
-  if(a < 0xEE0) { efreg_write(state, (a/2) & 0xF, d, mask); return; }
-  if(a < 0xEE4) { exts_write(state, (a/2) & 1, d, mask); return; }
 }
 
-static uint32 dsp_aica_load_reg(struct YAM_STATE *state, uint32 a) {
-  a &= 0xFFFC;
-  if(a < 0x3000) return 0;
-  if(a < 0x3200) return state->coef[(a/4) & 0x7F] << 3;
-  if(a < 0x3300) return state->madrs[(a/4) & 0x3F];
-  if(a < 0x3400) return 0;
-  if(a < 0x3C00) {
-    uint8 shift64 = ((a&0xC)^0xC) * 4;
-    uint32 index64 = ((a-0x3400)/16)&0x7F;
-    return (mpro_aica_read(state->mpro + index64) >> shift64) & 0xFFFF;
-  }
-  if(a < 0x4000) return 0;
-  if(a < 0x4400) return temp_read(state, (a/4) & 0xFF);
-  if(a < 0x4500) return mems_read(state, (a/4) & 0x3F);
-  if(a < 0x4580) return mixs_read(state, (a/4) & 0x1F);
-  if(a < 0x45C0) return efreg_read(state, (a/4) & 0xF);
-  if(a < 0x45C8) return exts_read(state, (a/4) & 1);
-  return 0;
+static void apply_write(struct YAM_STATE *state, const struct YAM_WRITE *w) {
+  if(state->version == 2) { aica_store_sound_reg(state, w->a, w->d, w->mask); }
+  else                    { scsp_store_sound_reg(state, w->a, w->d, w->mask); }
 }
 
-static void dsp_aica_store_reg(
+//
+// Apply what a queued write does to one channel: the write itself if it's
+// to that channel, and the key on/off if it's a kyonex
+//
+static void apply_channel_write(
   struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  const struct YAM_WRITE *w
+) {
+  uint32 c = chan - state->chan;
+  if(w->chan == c) {
+    uint32 d = w->d;
+    // The keying of every channel is done separately below
+    if(w->kyonex) { d &= ~chan_kyonex_bit(state); }
+    if(state->version == 2) {
+      chan_aica_store_reg(state, c, aica_regdecode[w->a / 4].field, d, w->mask);
+    } else {
+      chan_scsp_store_reg(state, c, scsp_regdecode[w->a / 2].field, d, w->mask);
+    }
+  }
+  if(w->kyonex) { keyonex(state, chan); }
+}
+
+//
+// Whether a channel's output depends on where renders end (see above)
+//
+static int chan_split_sensitive(struct YAM_STATE *state, struct YAM_CHAN *chan) {
+  if(chan->ssctl == 1) { return 1; }
+  if(chan->alfos && chan->alfows == 3) { return 1; }
+  if(chan->plfos && chan->plfows == 3) { return 1; }
+  if(state->version == 1 && (chan->mdl || chan->mdxsl || chan->mdysl)) { return 1; }
+  return 0;
+}
+
+//
+// Whether channel writes have to end the render: a live channel (or one a
+// queued write touches or keys on) is sensitive, or a queued write may
+// have made one so
+//
+static int queue_needs_split(struct YAM_STATE *state) {
+  uint64 live = state->active | state->writequeue_chans;
+  uint32 c;
+  if(state->writequeue_sensitive) { return 1; }
+  for(c = 0; live; c++, live >>= 1) {
+    if((live & 1) && chan_split_sensitive(state, state->chan + c)) { return 1; }
+  }
+  return 0;
+}
+
+//
+// Whether a channel write may make its channel split-sensitive: noise as
+// the sample source or an LFO waveform, or SCSP modulation
+//
+static int write_may_sensitize(struct YAM_STATE *state, uint32 field, uint32 d, uint32 mask) {
+  d &= mask;
+  if(field == 0x00) { return (d & ((state->version == 2) ? 0x0400 : 0x0080)) != 0; }
+  if(field == ((state->version == 2) ? 0x1C : 0x12)) {
+    return ((d & 0x0018) == 0x0018) || ((d & 0x0300) == 0x0300);
+  }
+  if(state->version == 1 && field == 0x0E) { return d != 0; }
+  return 0;
+}
+
+//
+// Log a write to be applied at the current odometer
+//
+static void queue_write(
+  struct YAM_STATE *state, const struct YAM_REGDECODE *r,
   uint32 a, uint32 d, uint32 mask
 ) {
-  a &= 0xFFFC;
-  if(a < 0x3000) { return; }
-  if(a < 0x3200) { coef_write(state, (a/4) & 0x7F, d, mask); return; }
-  if(a < 0x3300) { madrs_write(state, (a/4) & 0x3F, d, mask); return; }
-  if(a < 0x3400) { return; }
-  if(a < 0x3C00) {
-    uint8 shift64 = ((a&0xC)^0xC) * 4;
-    uint32 index64 = ((a-0x3400)/16)&0x7F;
-    uint64 mask64sh = ((uint64)(mask & 0xFFFF)) << shift64;
-    uint64 dm64sh = ((uint64)(d & mask & 0xFFFF)) << shift64;
-    uint64 oldvalue = mpro_aica_read(state->mpro + index64);
-    uint64 newvalue = (oldvalue & (~mask64sh)) | dm64sh;
-    if(newvalue != oldvalue) {
-      yam_flush(state);
-      mpro_aica_write(state->mpro + index64, newvalue);
-#ifdef ENABLE_DYNAREC
-      state->dsp_dyna_valid = 0;
-#endif
+  struct YAM_WRITE *w;
+  if(state->writequeue_count >= WRITEQUEUE_MAX) { apply_queued_writes(state); }
+  w = state->writequeue + state->writequeue_count;
+  w->odometer = state->odometer;
+  w->a = a;
+  w->d = d;
+  w->mask = mask;
+  w->chan = WRITE_SPLIT;
+  w->kyonex = 0;
+  if(r->kind == REG_CHAN) {
+    w->chan = r->slot;
+    if(r->field == 0x00 && (d & chan_kyonex_bit(state))) { w->kyonex = 1; }
+    // SCSP modulation changes the render order, and the send levels of
+    // the first 18 channels are also the DSP output levels
+    if(state->version == 1 && (r->field == 0x0E || r->field == 0x16)) {
+      w->chan = WRITE_SPLIT;
     }
-    return;
+    if(w->kyonex) { state->writequeue_chans = ~((uint64)0); }
+    else { state->writequeue_chans |= ((uint64)1) << r->slot; }
+    if(write_may_sensitize(state, r->field, d, mask)) { state->writequeue_sensitive = 1; }
+    if(queue_needs_split(state)) { w->chan = WRITE_SPLIT; }
   }
-  if(a < 0x4000) { return; }
-  if(a < 0x4400) { temp_write(state, (a/4) & 0xFF, d, mask); return; }
-  if(a < 0x4500) { mems_write(state, (a/4) & 0x3F, d, mask); return; }
-  // you can't write to MIXS, at least not meaningfully
-  if(a < 0x4580) { return; }
-  if(a < 0x45C0) { efreg_write(state, (a/4) & 0xF, d, mask); return; }
-  if(a < 0x45C8) { exts_write(state, (a/4) & 1, d, mask); return; }
+  state->writequeue_count++;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -1460,14 +2015,21 @@ static void dsp_aica_store_reg(
 // Externally-accessible load/store register
 //
 uint32 EMU_CALL yam_scsp_load_reg(void *state, uint32 a, uint32 mask) {
+  const struct YAM_REGDECODE *r;
   uint32 d = 0;
   a &= 0xFFE;
-  if(a <  0x400) return chan_scsp_load_reg(YAMSTATE, a>>5, a&0x1E) & mask;
-  if(a >= 0x700) return dsp_scsp_load_reg(YAMSTATE, a) & mask;
-  if(a >= 0x600) return YAMSTATE->ringbuf[(YAMSTATE->bufptr-64+(a-0x600)/2)&(32*RINGMAX-1)] & mask;
+  r = scsp_regdecode + (a / 2);
+  switch(r->kind) {
+  case REG_SYS:  break;
+  case REG_CHAN: return chan_scsp_load_reg(YAMSTATE, r->slot, r->field) & mask;
+  case REG_RING: apply_queued_writes(YAMSTATE); return YAMSTATE->ringbuf[(YAMSTATE->bufptr-64+r->slot)&(32*RINGMAX-1)] & mask;
+  case REG_MPRO: apply_queued_writes(YAMSTATE); return (mpro_scsp_read(YAMSTATE->mpro + r->slot) >> r->field) & 0xFFFF & mask;
+  default:       return dsp_load_reg(YAMSTATE, r) & mask;
+  }
   switch(a) {
   case 0x400: d = 0x0010; break; // MasterVolume (actually returns the LSI version)
   case 0x402: // RingBufferAddress
+    apply_queued_writes(YAMSTATE);
     d  = (((uint32)(YAMSTATE->rbl)) & 3) << 7;
     d |= ((YAMSTATE->rbp >> 13) & 0x7F);
     break;
@@ -1475,10 +2037,9 @@ uint32 EMU_CALL yam_scsp_load_reg(void *state, uint32 a, uint32 mask) {
   case 0x406: d = 0; break; // MIDI output, unimplemented
   case 0x408: // CallAddress (playpos in increments of 4K)
     { int c = (YAMSTATE->mslc) & 0x1F;
+      struct YAM_CHAN *status = chan_status(YAMSTATE, c);
 
-      if(YAMSTATE->out_pending > 0) yam_flush(YAMSTATE);
-
-      d = calculate_playpos(YAMSTATE, YAMSTATE->chan + c);
+      d = calculate_playpos(status);
       d &= 0xF000; d >>= 5;
 
 //
@@ -1613,44 +2174,22 @@ uint32 EMU_CALL yam_scsp_load_reg(void *state, uint32 a, uint32 mask) {
 }
 
 void EMU_CALL yam_scsp_store_reg(void *state, uint32 a, uint32 d, uint32 mask, uint8 *breakcpu) {
+  const struct YAM_REGDECODE *r;
   a &= 0xFFE;
   d &= 0xFFFF & mask;
   mask &= 0xFFFF;
-  if(a <  0x400) { chan_scsp_store_reg(YAMSTATE, a>>5, a&0x1E, d, mask); return; }
-  if(a >= 0x700) { dsp_scsp_store_reg(YAMSTATE, a, d, mask); return; }
-  if(a >= 0x600) { uint32 offset = (YAMSTATE->bufptr-64+(a-0x600)/2)&(32*RINGMAX-1); YAMSTATE->ringbuf[offset] = (d & mask) | (YAMSTATE->ringbuf[offset] & ~mask); return; }
+  r = scsp_regdecode + (a / 2);
+  switch(r->kind) {
+  case REG_SYS:  break;
+  case REG_NONE: return;
+  case REG_MIXS: return;
+  case REG_RING: { uint32 offset; apply_queued_writes(YAMSTATE); offset = (YAMSTATE->bufptr-64+r->slot)&(32*RINGMAX-1); YAMSTATE->ringbuf[offset] = (d & mask) | (YAMSTATE->ringbuf[offset] & ~mask); } return;
+  default:       queue_write(YAMSTATE, r, a, d, mask); return;
+  }
   switch(a) {
   case 0x400: // MasterVolume
-    yam_flush(YAMSTATE);
-    if(mask & 0x00FF) {
-      YAMSTATE->mvol   = d & 0xF;
-    }
-    break;
   case 0x402: // RingBufferAddress
-    { uint32 oldrbp = YAMSTATE->rbp;
-      uint8 oldrbl = YAMSTATE->rbl;
-      if(mask & 0x00FF) {
-        YAMSTATE->rbp = (((uint32)d) & 0x7F) << 13;
-        YAMSTATE->rbl &= 2;
-        YAMSTATE->rbl |= (d >> 7) & 1;
-      }
-      if(mask & 0xFF00) {
-        YAMSTATE->rbl &= 1;
-        YAMSTATE->rbl |= (d >> 7) & 2;
-      }
-      if((oldrbp != YAMSTATE->rbp) || (oldrbl != YAMSTATE->rbl)) {
-        uint32 newrbp = YAMSTATE->rbp;
-        uint8 newrbl = YAMSTATE->rbl;
-        YAMSTATE->rbp = oldrbp;
-        YAMSTATE->rbl = oldrbl;
-        yam_flush(YAMSTATE);
-#ifdef ENABLE_DYNAREC
-        YAMSTATE->dsp_dyna_valid = 0;
-#endif
-        YAMSTATE->rbp = newrbp;
-        YAMSTATE->rbl = newrbl;
-      }
-    }
+    queue_write(YAMSTATE, r, a, d, mask);
     break;
   case 0x408: // ChnInfoReq
     if(mask & 0xFF00) {
@@ -1720,40 +2259,52 @@ void EMU_CALL yam_scsp_store_reg(void *state, uint32 a, uint32 d, uint32 mask, u
 }
 
 uint32 EMU_CALL yam_aica_load_reg(void *state, uint32 a, uint32 mask) {
+  const struct YAM_REGDECODE *r;
   uint32 d = 0;
   a &= 0xFFFC;
-  if(a <  0x2000) return chan_aica_load_reg(YAMSTATE, a>>7, a&0x7C) & mask;
-  if(a >= 0x3000) return dsp_aica_load_reg(YAMSTATE, a) & mask;
-  if(a <  0x2048) {
+  r = aica_regdecode + (a / 4);
+  switch(r->kind) {
+  case REG_SYS:  break;
+  case REG_CHAN: return chan_aica_load_reg(YAMSTATE, r->slot, r->field) & mask;
+  case REG_EFX:
+    apply_queued_writes(YAMSTATE);
     d =
-      ((((uint32)(YAMSTATE->efsdl[(a - 0x2000) / 4])) & 0x0F) << 8) |
-      ((((uint32)(YAMSTATE->efpan[(a - 0x2000) / 4])) & 0x1F) << 0);
+      ((((uint32)(YAMSTATE->efsdl[r->slot])) & 0x0F) << 8) |
+      ((((uint32)(YAMSTATE->efpan[r->slot])) & 0x1F) << 0);
     return d & mask;
+  case REG_MPRO: apply_queued_writes(YAMSTATE); return (mpro_aica_read(YAMSTATE->mpro + r->slot) >> r->field) & 0xFFFF & mask;
+  default:       return dsp_load_reg(YAMSTATE, r) & mask;
   }
   switch(a) {
   case 0x2800: d = 0x0010; break; // MasterVolume (actually returns the LSI version)
   case 0x2804: // RingBufferAddress
+    apply_queued_writes(YAMSTATE);
     d  = (((uint32)(YAMSTATE->rbl)) & 3) << 13;
     d |= ((YAMSTATE->rbp >> 11) & 0xFFF);
     break;
   case 0x2808: d = (1<<11) | (1 << 8); break; // MIDIInput, unimplemented
   case 0x280C: d = 0; break; // ChnInfoReq, always seems to return 0 when read
   case 0x2810: // PlayStatus
-//    if(YAMSTATE->out_pending > 100) yam_flush(YAMSTATE);
-    if(YAMSTATE->out_pending > 0) yam_flush(YAMSTATE);
     { int c = (YAMSTATE->mslc) & 0x3F;
-      d  = (((uint32)(YAMSTATE->chan[c].lp      )) & 1) << 15;
+      struct YAM_CHAN *status = chan_status(YAMSTATE, c);
+      d  = (((uint32)(status->lp      )) & 1) << 15;
       if(YAMSTATE->afsel == 0) {
-        YAMSTATE->chan[c].lp = 0;
-        d |= (((uint32)(YAMSTATE->chan[c].envstate)) & 3) << 13;
-        d |= (YAMSTATE->chan[c].envlevel) & 0x1FFF;
+        d |= (((uint32)(status->envstate)) & 3) << 13;
+        d |= (status->envlevel) & 0x1FFF;
+        // Clearing lp has to happen at this point in time
+        if(status->lp) {
+          yam_flush(YAMSTATE);
+          YAMSTATE->chan[c].lp = 0;
+        }
       } else {
-        d |= (((uint32)(YAMSTATE->chan[c].lpfstate)) & 3) << 13;
-        d |= (YAMSTATE->chan[c].lpflevel) & 0x1FFF;
+        d |= (((uint32)(status->lpfstate)) & 3) << 13;
+        d |= (status->lpflevel) & 0x1FFF;
       }
     }
     break;
-  case 0x2814: d = calculate_playpos(YAMSTATE, YAMSTATE->chan + ((YAMSTATE->mslc) & 0x3F)); break;
+  case 0x2814: // PlayPos
+    d = calculate_playpos(chan_status(YAMSTATE, (YAMSTATE->mslc) & 0x3F));
+    break;
   case 0x2880: d = YAMSTATE->mrwinh & 0xF; break;
   case 0x2884: d = 0; break;
   case 0x2888: d = 0; break;
@@ -1789,54 +2340,20 @@ uint32 EMU_CALL yam_aica_load_reg(void *state, uint32 a, uint32 mask) {
 }
 
 void EMU_CALL yam_aica_store_reg(void *state, uint32 a, uint32 d, uint32 mask, uint8 *breakcpu) {
+  const struct YAM_REGDECODE *r;
   a &= 0xFFFC;
   d &= 0xFFFF & mask;
-  if(a <  0x2000) { chan_aica_store_reg(YAMSTATE, a>>7, a&0x7C, d, mask); return; }
-  if(a >= 0x3000) { dsp_aica_store_reg(YAMSTATE, a, d, mask); return; }
-  if(a <  0x2048) {
-    if(mask & 0x00FF) { YAMSTATE->efpan[(a - 0x2000) / 4] = d & 0x1F; }
-    if(mask & 0xFF00) { YAMSTATE->efsdl[(a - 0x2000) / 4] = (d >> 8) & 0x0F; }
-    return;
+  r = aica_regdecode + (a / 4);
+  switch(r->kind) {
+  case REG_SYS:  break;
+  case REG_NONE: return;
+  case REG_MIXS: return;
+  default:       queue_write(YAMSTATE, r, a, d, mask); return;
   }
   switch(a) {
   case 0x2800: // MasterVolume
-    yam_flush(YAMSTATE);
-    if(mask & 0x00FF) {
-      YAMSTATE->mvol   = d & 0xF;
-    }
-    if(mask & 0xFF00) {
-      YAMSTATE->mono   = (d >> 15) & 1;
-    }
-    break;
   case 0x2804: // RingBufferAddress
-    { uint32 oldrbp = YAMSTATE->rbp;
-      uint8 oldrbl = YAMSTATE->rbl;
-      if(mask & 0x00FF) {
-        YAMSTATE->rbp >>= 11;
-        YAMSTATE->rbp &= 0xF00;
-        YAMSTATE->rbp |= d & 0x0FF;
-        YAMSTATE->rbp <<= 11;
-      }
-      if(mask & 0xFF00) {
-        YAMSTATE->rbp >>= 11;
-        YAMSTATE->rbp &= 0x0FF;
-        YAMSTATE->rbp |= d & 0xF00;
-        YAMSTATE->rbp <<= 11;
-        YAMSTATE->rbl = (d >> 13) & 3;
-      }
-      if((oldrbp != YAMSTATE->rbp) || (oldrbl != YAMSTATE->rbl)) {
-        uint32 newrbp = YAMSTATE->rbp;
-        uint8 newrbl = YAMSTATE->rbl;
-        YAMSTATE->rbp = oldrbp;
-        YAMSTATE->rbl = oldrbl;
-        yam_flush(YAMSTATE);
-#ifdef ENABLE_DYNAREC
-        YAMSTATE->dsp_dyna_valid = 0;
-#endif
-        YAMSTATE->rbp = newrbp;
-        YAMSTATE->rbl = newrbl;
-      }
-    }
+    queue_write(YAMSTATE, r, a, d, mask);
     break;
   case 0x2808: // MIDIInput, unimplemented
     break;
@@ -1952,25 +2469,241 @@ static uint32 env_adjustrate(struct YAM_CHAN *chan, uint32 rate) {
 }
 
 //
-// Determine whether a step is going to occur here
+// Number of samples from the given odometer until the next step occurs
+// (0 if it occurs here), or 0xFFFFFFFF if it never will
 //
-static int env_needstep(uint32 effrate, uint32 odometer) {
+static uint32 env_samples_until_step(uint32 effrate, uint32 odometer) {
   uint32 shift;
   uint32 pattern;
-  uint32 bitplace;
-  if(effrate <= 0x01) return 0;
-  if(effrate >= 0x30) return ((odometer & 1) == 0);
+  uint32 d;
+  if(effrate <= 0x01) return 0xFFFFFFFF;
+  if(effrate >= 0x30) return odometer & 1;
   shift = 12 - ((effrate - 1) >> 2);
   pattern = (effrate - 1) & 3;
-  if(odometer & ((1<<shift)-1)) return 0;
-  bitplace = (odometer >> shift) & 7;
-  return (0xFFFDDDD5 >> (pattern * 8 + bitplace)) & 1;
+  // steps can only land on multiples of 1<<shift
+  d = (0 - odometer) & ((1<<shift)-1);
+  for(;;) {
+    uint32 bitplace = ((odometer + d) >> shift) & 7;
+    if((0xFFFDDDD5 >> (pattern * 8 + bitplace)) & 1) return d;
+    d += 1 << shift;
+  }
   // 11010101 0x01 each bit is 4096 samples
   // 11011101 0x02
   // 11111101 0x03
   // 11111111 0x04
 }
 
+//
+// Samples left until the amplitude and filter envelopes step next.
+// Valid for one generate call; the rates depend on registers.
+//
+struct YAM_ENVWAIT {
+  uint32 amp;
+  uint32 lpf;
+};
+
+static uint32 env_amp_wait(struct YAM_CHAN *chan, uint32 odometer) {
+  return env_samples_until_step(env_adjustrate(chan, chan->ar[chan->envstate]), odometer);
+}
+
+static uint32 env_lpf_wait(struct YAM_CHAN *chan, uint32 odometer) {
+  return env_samples_until_step(env_adjustrate(chan, chan->fr[chan->lpfstate]), odometer);
+}
+
+static void envwait_init(struct YAM_ENVWAIT *wait, struct YAM_CHAN *chan, uint32 odometer) {
+  wait->amp = env_amp_wait(chan, odometer);
+  wait->lpf = env_lpf_wait(chan, odometer);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// ADPCM decoding
+//
+
+//
+// Decode one 4-bit sample, advancing the predictor state
+//
+static EMU_INLINE sint32 adpcm_decode(sint32 *step, sint32 *prev, uint32 s) {
+  sint32 out = ((*step) * adpcmdiff[s & 7]) / 8;
+  if(out > ( 0x7FFF)) { out =  0x7FFF; }
+  out*=1-((s >> 2) & 2);
+  out+=(*prev);
+  if(out > ( 0x7FFF)) { out = ( 0x7FFF); /* logf("<adpcmoverflow>"); */ }
+  if(out < (-0x8000)) { out = (-0x8000); /* logf("<adpcmunderflow>"); */ }
+  *step = ((*step) * adpcmscale[s & 7]) >> 8;
+  if((*step) > 0x6000) { *step = 0x6000; }
+  if((*step) < 0x007F) { *step = 0x007F; }
+  *prev = out;
+  return out;
+}
+
+#define ADPCMPOOL(state) ((struct YAM_ADPCMSAMPLE*)(((uint8*)(state)) + sizeof(struct YAM_STATE)))
+
+static uint32 adpcm_cache_gensum(struct YAM_STATE *state, const struct YAM_ADPCMCACHE *e) {
+  uint32 shift = state->ram_write_gen_shift;
+  uint32 first = e->firstbyte >> shift;
+  uint32 last = (e->firstbyte + e->bytes - 1) >> shift;
+  uint32 mask = (state->ram_mask >> shift) & state->ram_write_gen_mask;
+  uint32 sum = 0;
+  for(; first <= last; first++) { sum += state->ram_write_gen[first & mask]; }
+  return sum;
+}
+
+//
+// Whether the DSP may write to an entry's source bytes
+// (it writes within 64K words of RBP)
+//
+static int adpcm_cache_dsp_overlap(struct YAM_STATE *state, const struct YAM_ADPCMCACHE *e) {
+  if(!(state->dsp_emulation_enabled)) { return 0; }
+  if(((state->rbp - e->firstbyte) & state->ram_mask) < e->bytes) { return 1; }
+  if(((e->firstbyte - state->rbp) & state->ram_mask) < 0x20000) { return 1; }
+  return 0;
+}
+
+static void adpcm_cache_drop(struct YAM_STATE *state, uint32 n) {
+  uint32 i;
+  state->adpcmcache[n].valid = 0;
+  for(i = 0; i < 64; i++) {
+    if(state->chan[i].adpcmcache == n + 1) { state->chan[i].adpcmcache = 0; }
+  }
+}
+
+static void adpcm_cache_flush(struct YAM_STATE *state) {
+  uint32 i;
+  for(i = 0; i < ADPCMCACHE_ENTRIES; i++) { state->adpcmcache[i].valid = 0; }
+  for(i = 0; i < 64; i++) { state->chan[i].adpcmcache = 0; }
+  state->adpcmcache_used = 0;
+}
+
+//
+// Make room by dropping the entries no channel is using and packing the
+// rest together; returns nonzero if there is now room for n samples
+//
+static int adpcm_cache_compact(struct YAM_STATE *state, uint32 n) {
+  uint8 inuse[ADPCMCACHE_ENTRIES];
+  uint32 i, pos = 0;
+  int slot = 0;
+  memset(inuse, 0, sizeof(inuse));
+  for(i = 0; i < 64; i++) {
+    if(state->chan[i].adpcmcache) { inuse[state->chan[i].adpcmcache - 1] = 1; }
+  }
+  for(i = 0; i < ADPCMCACHE_ENTRIES; i++) {
+    if(!inuse[i]) { state->adpcmcache[i].valid = 0; slot = 1; }
+  }
+  // move the survivors down in pool order
+  for(;;) {
+    struct YAM_ADPCMCACHE *e = NULL;
+    uint32 len;
+    for(i = 0; i < ADPCMCACHE_ENTRIES; i++) {
+      struct YAM_ADPCMCACHE *c = state->adpcmcache + i;
+      if(c->valid && c->pool >= pos && (!e || c->pool < e->pool)) { e = c; }
+    }
+    if(!e) break;
+    len = e->loopend - e->loopstart;
+    if(e->pool != pos) {
+      memmove(ADPCMPOOL(state) + pos, ADPCMPOOL(state) + e->pool, len * sizeof(struct YAM_ADPCMSAMPLE));
+      e->pool = pos;
+    }
+    pos += len;
+  }
+  state->adpcmcache_used = pos;
+  return slot && (pos + n) <= ADPCMCACHE_POOL;
+}
+
+//
+// Drop entries whose source was written since they were decoded
+// RAM only changes between renders, so once per render is enough
+//
+static void adpcm_cache_validate(struct YAM_STATE *state) {
+  uint32 i;
+  if(!(state->adpcmcache_used)) { return; }
+  for(i = 0; i < ADPCMCACHE_ENTRIES; i++) {
+    struct YAM_ADPCMCACHE *e = state->adpcmcache + i;
+    if(!(e->valid)) { continue; }
+    if(adpcm_cache_gensum(state, e) != e->gensum || adpcm_cache_dsp_overlap(state, e)) {
+      adpcm_cache_drop(state, i);
+    }
+  }
+}
+
+//
+// Find or decode the loop a channel is entering; it must be at the loop
+// start and playing forwards
+//
+static void adpcm_cache_attach(struct YAM_STATE *state, struct YAM_CHAN *chan) {
+  struct YAM_ADPCMCACHE *e;
+  struct YAM_ADPCMSAMPLE *d;
+  uint32 i, n;
+  sint32 step, prev;
+  chan->adpcmcache = 0;
+  if(chan->sampler_looptype != LOOP_FORWARDS) { return; }
+  if(chan->loopend <= chan->loopstart) { return; }
+  n = chan->loopend - chan->loopstart;
+  if(n > ADPCMCACHE_POOL) { return; }
+  for(i = 0; i < ADPCMCACHE_ENTRIES; i++) {
+    e = state->adpcmcache + i;
+    if(
+      e->valid &&
+      e->sampleaddr == chan->sampleaddr &&
+      e->loopstart == chan->loopstart &&
+      e->loopend == chan->loopend &&
+      e->step == chan->adpcmstep &&
+      e->prev == chan->adpcmprev
+    ) {
+      chan->adpcmcache = i + 1;
+      return;
+    }
+  }
+  // Out of room: evict what's idle, or do without
+  for(i = 0; i < ADPCMCACHE_ENTRIES; i++) { if(!(state->adpcmcache[i].valid)) break; }
+  if(i == ADPCMCACHE_ENTRIES || (state->adpcmcache_used + n) > ADPCMCACHE_POOL) {
+    if(!adpcm_cache_compact(state, n)) { return; }
+    for(i = 0; i < ADPCMCACHE_ENTRIES; i++) { if(!(state->adpcmcache[i].valid)) break; }
+  }
+  e = state->adpcmcache + i;
+  e->sampleaddr = chan->sampleaddr;
+  e->loopstart = chan->loopstart;
+  e->loopend = chan->loopend;
+  e->step = chan->adpcmstep;
+  e->prev = chan->adpcmprev;
+  e->firstbyte = chan->sampleaddr + (chan->loopstart >> 1);
+  e->bytes = ((chan->loopend - 1) >> 1) - (chan->loopstart >> 1) + 1;
+  if(adpcm_cache_dsp_overlap(state, e)) { return; }
+  e->pool = state->adpcmcache_used;
+  e->gensum = adpcm_cache_gensum(state, e);
+  e->valid = 1;
+  state->adpcmcache_used += n;
+  // Decode the loop body
+  d = ADPCMPOOL(state) + e->pool;
+  step = e->step;
+  prev = e->prev;
+  for(i = 0; i < n; i++) {
+    uint32 pos = chan->loopstart + i;
+    uint32 s = *(uint8*)(((uint8*)(state->ram_ptr)) + (((chan->sampleaddr + (pos >> 1)) ^ (state->mem_byte_address_xor)) & (state->ram_mask)));
+    s >>= 4 * (pos & 1);
+    d[i].out = adpcm_decode(&step, &prev, s & 0xF);
+    d[i].step = step;
+  }
+  chan->adpcmcache = e - state->adpcmcache + 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Read a PCM sample (pcms 0 or 1) at the given position, before SSCTL
+//
+static EMU_INLINE sint32 pcm_sample_at(struct YAM_STATE *state, struct YAM_CHAN *chan, uint32 pos) {
+  sint32 s;
+  if(chan->pcms == 0) { // 16-bit signed LSB-first
+    s = *(sint16*)(((sint8*)(state->ram_ptr)) + (((chan->sampleaddr + 2 * pos) ^ (state->mem_word_address_xor))  & (state->ram_mask)));
+    s ^= chan->sampler_invert;
+  } else { // 8-bit signed
+    s = *(sint8*)(((sint8*)(state->ram_ptr)) + (((chan->sampleaddr + pos) ^ (state->mem_byte_address_xor)) & (state->ram_mask)));
+    s ^= chan->sampler_invert >> 8;
+    s <<= 8;
+  }
+  return s;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Read next sample
@@ -2012,36 +2745,39 @@ static void readnextsample(
       chan->sampler_dir = 1;
       break;
     }
+    // Forward ADPCM loops can come out of the decoded cache
+    if(chan->pcms == 2 && state->ram_write_gen) { adpcm_cache_attach(state, chan); }
   }
   //
   // Obtain sample
   //
   switch(chan->pcms) {
   case 0: // 16-bit signed LSB-first
-    s = *(sint16*)(((sint8*)(state->ram_ptr)) + (((chan->sampleaddr + 2 * (chan->playpos + sample_offset)) ^ (state->mem_word_address_xor))  & (state->ram_mask)));
-    s ^= chan->sampler_invert;
-    break;
   case 1: // 8-bit signed
-    s = *(sint8*)(((sint8*)(state->ram_ptr)) + (((chan->sampleaddr + chan->playpos + sample_offset) ^ (state->mem_byte_address_xor)) & (state->ram_mask)));
-    s ^= chan->sampler_invert >> 8;
-    s <<= 8;
+    s = pcm_sample_at(state, chan, chan->playpos + sample_offset);
     break;
   case 2: // 4-bit ADPCM
+    if(chan->adpcmcache) {
+      const struct YAM_ADPCMCACHE *e = state->adpcmcache + chan->adpcmcache - 1;
+      uint32 i = chan->playpos - chan->loopstart;
+      if(
+        advance && chan->sampler_dir == 1 &&
+        e->sampleaddr == chan->sampleaddr &&
+        e->loopstart == chan->loopstart &&
+        e->loopend == chan->loopend &&
+        i < (uint32)(chan->loopend - chan->loopstart)
+      ) {
+        const struct YAM_ADPCMSAMPLE *d = ADPCMPOOL(state) + e->pool + i;
+        s = d->out;
+        chan->adpcmprev = s;
+        chan->adpcmstep = d->step;
+        break;
+      }
+      chan->adpcmcache = 0;
+    }
     s = *(uint8*)(((uint8*)(state->ram_ptr)) + (((chan->sampleaddr + (chan->playpos >> 1)) ^ (state->mem_byte_address_xor)) & (state->ram_mask)));
     s >>= 4 * ((chan->playpos & 1) ^ 0);
-    s &= 0xF;
-    { sint32 out = (chan->adpcmstep * adpcmdiff[s & 7]) / 8;
-      if(out > ( 0x7FFF)) { out =  0x7FFF; }
-      out*=1-((s >> 2) & 2);
-      out+=chan->adpcmprev;
-      if(out > ( 0x7FFF)) { out = ( 0x7FFF); /* logf("<adpcmoverflow>"); */ }
-      if(out < (-0x8000)) { out = (-0x8000); /* logf("<adpcmunderflow>"); */ }
-      chan->adpcmstep = (chan->adpcmstep * adpcmscale[s & 7]) >> 8;
-      if(chan->adpcmstep > 0x6000) { chan->adpcmstep = 0x6000; }
-      if(chan->adpcmstep < 0x007F) { chan->adpcmstep = 0x007F; }
-      chan->adpcmprev = out;
-      s = out;
-    }
+    s = adpcm_decode(&(chan->adpcmstep), &(chan->adpcmprev), s & 0xF);
     break;
   }
   switch(chan->ssctl) {
@@ -2087,36 +2823,456 @@ done:
   chan->samplebufnext = s;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// Skip ahead over source samples
+//
+// When the phase jumps over several source samples, only the last two are
+// ever seen by the interpolator. The rest only have to move playpos along,
+// which can be done in one go as long as none of them would start at the
+// loop start or end at the loop end.
+//
+// Returns how many readnextsample calls (up to max) can be skipped.
+// Only for PCM without noise: ADPCM must decode every sample, and noise
+// must draw a random number for each.
+//
+static uint32 skippable_samples(struct YAM_CHAN *chan, uint32 max) {
+  uint32 tostart, toend;
+  if(!(chan->sampler_dir)) { return max; } // stopped; nothing moves
+  if(chan->sampler_dir > 0) {
+    tostart = (chan->loopstart - chan->playpos) & 0xFFFF;
+    toend   = (chan->loopend   - chan->playpos) & 0xFFFF;
+  } else {
+    tostart = (chan->playpos - chan->loopstart) & 0xFFFF;
+    toend   = (chan->playpos - chan->loopend  ) & 0xFFFF;
+  }
+  if(!toend) { toend = 0x10000; }
+  if(max > tostart) { max = tostart; }
+  if(max > toend - 1) { max = toend - 1; }
+  return max;
+}
+
+//
+// Does what n calls to readnextsample would
+//
+static void fetch_samples(struct YAM_STATE *state, struct YAM_CHAN *chan, uint32 n) {
+  if(chan->pcms < 2 && chan->ssctl != 1) {
+    while(n > 2) {
+      uint32 m = skippable_samples(chan, n - 2);
+      if(m) {
+        chan->playpos = (chan->playpos + m * ((sint32)(chan->sampler_dir))) & 0xFFFF;
+        n -= m;
+      } else {
+        readnextsample(state, chan, 0, 1);
+        n--;
+      }
+    }
+  }
+  while(n--) { readnextsample(state, chan, 0, 1); }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Per-sample channel state machine
+//
+
+//
+// Channel features the generate kernels are specialized for
+//
+#define GEN_SCSP  (1) // SCSP: ring modulation and ring buffer
+#define GEN_LPF   (2) // lowpass filter
+#define GEN_ALFO  (4) // LFO amplitude modulation
+#define GEN_PLFO  (8) // LFO pitch modulation
+#define GEN_KINDS (16)
+
+//
+// The kernels rely on this to fold away the features they don't have
+//
+#ifdef __GNUC__
+#define GEN_INLINE __attribute__((always_inline)) EMU_INLINE
+#elif defined(_MSC_VER)
+#define GEN_INLINE __forceinline
+#else
+#define GEN_INLINE EMU_INLINE
+#endif
+
+static uint32 generate_features(struct YAM_STATE *state, struct YAM_CHAN *chan) {
+  uint32 features = 0;
+  if(state->version == 1) { features |= GEN_SCSP; }
+  if(!(chan->lpoff)) { features |= GEN_LPF; }
+  if(chan->alfos) { features |= GEN_ALFO; }
+  if(chan->plfos) { features |= GEN_PLFO; }
+  return features;
+}
+
+//
+// LFO amplitude modulation, added to the attenuation
+//
+static EMU_INLINE uint32 lfo_attenuation(struct YAM_STATE *state, struct YAM_CHAN *chan) {
+  uint32 att_wave_y = 0;
+  switch(chan->alfows) {
+  case 0: // sawtooth
+    att_wave_y = ((uint32)(chan->lfophase)) >> 24;
+    break;
+  case 1: // square
+    att_wave_y = (((sint32)(chan->lfophase)) >> 31) & 0xFF;
+    break;
+  case 2: // triangle
+    att_wave_y = (chan->lfophase >> 23) & 0xFF;
+    if(chan->lfophase & 0x80000000) { att_wave_y ^= 0xFF; }
+    break;
+  case 3: // noise
+    att_wave_y = yamrand16(state) & 0xFF;
+    break;
+  }
+  return att_wave_y >> (7 - (chan->alfos));
+}
+
+//
+// Phase increment before LFO pitch shifting
+//
+static uint32 base_phase_increment(struct YAM_CHAN *chan) {
+  uint32 oct = chan->oct^8;
+  uint32 fns = chan->fns^0x400;
+  uint32 base_phaseinc = fns << oct;
+  // weird ADPCM thing mentioned in official doc
+  if(chan->pcms == 2 && oct >= 0xA) { base_phaseinc <<= 1; }
+  return base_phaseinc;
+}
+
+//
+// Advance the filter envelope by one sample
+//
+static GEN_INLINE void advance_lpf_envelope(
+  struct YAM_CHAN *chan,
+  uint32 odometer,
+  struct YAM_ENVWAIT *wait
+) {
+  if(wait->lpf) {
+    wait->lpf--;
+  } else {
+    uint32 effectiverate = env_adjustrate(chan, chan->fr[chan->lpfstate]);
+    uint32 d = envdecayvalue[effectiverate][odometer&3];
+    uint32 target = chan->flv[chan->lpfstate+1];
+    if(chan->lpflevel < target) {
+      uint32 maxd = target - chan->lpflevel;
+      if(d > maxd) { d = maxd; }
+      chan->lpflevel += d;
+    } else if(chan->lpflevel > target) {
+      uint32 maxd = chan->lpflevel - target;
+      if(d > maxd) { d = maxd; }
+      chan->lpflevel -= d;
+    } else {
+      if(chan->lpfstate < 3) { chan->lpfstate++; }
+    }
+    wait->lpf = env_lpf_wait(chan, odometer + 1);
+  }
+}
+
+//
+// Advance the sample phase by one sample, reading new sample data if needed
+//
+static GEN_INLINE void advance_phase(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  uint32 features,
+  uint32 base_phaseinc,
+  uint32 odometer,
+  struct YAM_ENVWAIT *wait
+) {
+  uint32 realphaseinc = base_phaseinc;
+  //
+  // LFO pitch shifting
+  //
+  if(features & GEN_PLFO) {
+    uint32 pitch_wave_y = 0;
+    switch(chan->plfows) {
+    case 0: // sawtooth
+      pitch_wave_y = chan->lfophase ^ 0x80000000;
+      break;
+    case 1: // square
+      pitch_wave_y = (chan->lfophase & 0x80000000) ? 0 : 0xFFFFFFFF;
+      break;
+    case 2: // triangle
+      pitch_wave_y = (chan->lfophase << 1) + 0x80000000;
+      if(chan->lfophase >= 0x40000000 && chan->lfophase < 0xC0000000) {
+        pitch_wave_y = ~pitch_wave_y;
+      }
+      break;
+    case 3: // noise
+      pitch_wave_y = yamrand16(state) << 16;
+      break;
+    }
+    { uint32 maxvary = base_phaseinc >> (10-(chan->plfos));
+      uint32 scaled_pitch_wave_y =
+        (((uint64)(maxvary*2)) * ((uint64)pitch_wave_y)) >> 32;
+      realphaseinc = base_phaseinc + scaled_pitch_wave_y - maxvary;
+    }
+  }
+  //
+  // Advance phase, and read new sample data if necessary
+  //
+  chan->frcphase += realphaseinc;
+  if(chan->frcphase >= 0x40000) {
+    uint8 envstate = chan->envstate;
+    fetch_samples(state, chan, chan->frcphase >> 18);
+    chan->frcphase &= 0x3FFFF;
+    // reaching the loop start can link attack to decay
+    if(chan->envstate != envstate) { wait->amp = env_amp_wait(chan, odometer + 1); }
+  }
+}
+
+//
+// Advance the LFO, both envelopes and the sample phase by one sample
+// features must be what generate_features gives for the channel
+//
+// The envelopes are only looked at when their wait runs out, instead of
+// checking the step pattern every sample.
+//
+static GEN_INLINE void advance_channel(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  uint32 features,
+  uint32 base_phaseinc,
+  uint32 lfophaseinc,
+  uint32 odometer,
+  struct YAM_ENVWAIT *wait
+) {
+  //
+  // Advance LFO phase
+  //
+  chan->lfophase += lfophaseinc;
+  //
+  // Advance amplitude envelope
+  //
+  if(wait->amp) {
+    wait->amp--;
+  } else {
+    uint32 effectiverate = env_adjustrate(chan, chan->ar[chan->envstate]);
+    switch(chan->envstate) {
+    case 0: // attack
+      chan->envlevel -= (chan->envlevel >> envattackshift[effectiverate][odometer&3]) + 1;
+      if(chan->envlevel == 0) { chan->envstate = 1; }
+      break;
+    case 1: // decay
+      chan->envlevel += envdecayvalue[effectiverate][odometer&3];
+      if((chan->envlevel >> 5) >= chan->dl) { chan->envstate = 2; }
+      break;
+    case 2: // sustain
+    case 3: // release
+      chan->envlevel += envdecayvalue[effectiverate][odometer&3];
+      break;
+    }
+    wait->amp = env_amp_wait(chan, odometer + 1);
+  }
+  //
+  // Advance filter envelope
+  //
+  advance_lpf_envelope(chan, odometer, wait);
+  //
+  // Advance the sample phase
+  //
+  advance_phase(state, chan, features, base_phaseinc, odometer, wait);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Steady spans
+//
+// With no LFO and the filter off, the attenuation can only change when the
+// amplitude envelope steps, or when the loop start links attack to decay.
+// Until then the voice is just the interpolated sample times a constant
+// gain: the interpolated samples are collected first, and scaled afterwards
+// in one pass. For PCM the collecting can skip the state machine too.
+//
+#define STEADY_MIN (8) // shorter spans go through the general path
+
+static EMU_INLINE int channel_is_steady(
+  struct YAM_CHAN *chan,
+  uint32 features,
+  struct YAM_ENVWAIT *wait
+) {
+  if(features & (GEN_LPF | GEN_ALFO | GEN_PLFO)) { return 0; }
+  if(wait->amp < STEADY_MIN) { return 0; }
+  if((features & GEN_SCSP) && (chan->mdl!=0 || chan->mdxsl!=0 || chan->mdysl!=0)) { return 0; }
+  return 1;
+}
+
+//
+// Interpolate n samples of a PCM channel straight out of sample RAM
+//
+// This is only possible while none of the reads reach the loop start or
+// end, so the span is cut short to stay clear of them. Source sample k is
+// what the k-th read from here on would give, with 0 and 1 being the
+// samples already in the channel. n must not be more than either envelope
+// wait. Without a buffer, the channel is just moved to the end of the span.
+// Returns the number of samples done, or 0 if the span would be too short.
+//
+static EMU_INLINE sint32 span_source(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  uint32 k
+) {
+  if(k < 2) { return k ? chan->samplebufnext : chan->samplebufcur; }
+  if(!(chan->sampler_dir) || chan->ssctl) { return 0; }
+  return pcm_sample_at(state, chan, (chan->playpos + (k - 2) * ((sint32)(chan->sampler_dir))) & 0xFFFF);
+}
+
+static EMU_INLINE uint32 interpolate_pcm_span(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  sint32 *buf,
+  uint32 base_phaseinc,
+  uint32 lfophaseinc,
+  uint32 n,
+  struct YAM_ENVWAIT *wait
+) {
+  uint32 reads, frc, i, m;
+  sint32 cur, next;
+  { uint64 maxphase = (((uint64)(skippable_samples(chan, 0x10000))) << 18) + 0x3FFFF - chan->frcphase;
+    if(base_phaseinc && n > maxphase / base_phaseinc) { n = (uint32)(maxphase / base_phaseinc); }
+  }
+  if(n < STEADY_MIN) { return 0; }
+  reads = (uint32)((chan->frcphase + ((uint64)base_phaseinc) * n) >> 18);
+  if(buf) {
+    //
+    // Interpolate
+    //
+    frc = chan->frcphase;
+    m = 0;
+    cur = chan->samplebufcur;
+    next = chan->samplebufnext;
+    for(i = 0; i < n; i++) {
+      sint32 f = (frc >> 4) & 0x3FFF;
+      buf[i] = ((next * f) + (cur * (0x4000-f))) >> 14;
+      frc += base_phaseinc;
+      if(frc >= 0x40000) {
+        m += frc >> 18;
+        frc &= 0x3FFFF;
+        cur = span_source(state, chan, m);
+        next = span_source(state, chan, m + 1);
+      }
+    }
+  } else {
+    frc = (uint32)((chan->frcphase + ((uint64)base_phaseinc) * n) & 0x3FFFF);
+    cur = span_source(state, chan, reads);
+    next = span_source(state, chan, reads + 1);
+  }
+  //
+  // Leave the channel where the reads would have
+  //
+  chan->frcphase = frc;
+  chan->playpos = (chan->playpos + reads * ((sint32)(chan->sampler_dir))) & 0xFFFF;
+  chan->samplebufcur = cur;
+  chan->samplebufnext = next;
+  chan->lfophase += lfophaseinc * n;
+  wait->amp -= n;
+  wait->lpf -= n;
+  return n;
+}
+
+//
+// Generate up to n samples, n no more than the amplitude envelope wait
+// Returns the number of samples actually generated; without a buffer this
+// can be 0, since only PCM spans are any faster than the general path then
+//
+static GEN_INLINE uint32 generate_steady_span(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  sint32 *buf,
+  uint32 features,
+  uint32 base_phaseinc,
+  uint32 lfophaseinc,
+  uint32 odometer,
+  uint32 n,
+  struct YAM_ENVWAIT *wait
+) {
+  uint32 i = 0;
+  uint8 envstate = chan->envstate;
+  // voff is the same as a gain of 1
+  sint32 linearvol = 0x80;
+  uint32 shift = 7;
+  if(!(chan->voff)) {
+    uint32 attenuation;
+    attenuation = ((uint32)(chan->tl)) << 2;
+    attenuation += ((uint32)(chan->envlevel)) & ((uint32)(chan->envlevelmask[chan->envstate]));
+    if(attenuation >= 0x3C0) {
+      linearvol = 0;
+    } else {
+      linearvol = ((attenuation & 0x3F) ^ 0x7F) + 1;
+      shift = 7 + (attenuation >> 6);
+    }
+  }
+  //
+  // PCM without noise doesn't need the state machine at all
+  //
+  if(chan->pcms < 2 && chan->ssctl != 1) {
+    i = interpolate_pcm_span(state, chan, buf, base_phaseinc, lfophaseinc, (n < wait->lpf) ? n : wait->lpf, wait);
+    // Too close to a loop boundary; step past it and try again
+    if(!i && n > STEADY_MIN) { n = STEADY_MIN; }
+  }
+  if(!buf) { return i; }
+  if(!i) {
+    while(i < n) {
+      sint32 f = ((chan->frcphase) >> 4) & 0x3FFF;
+      buf[i] = ((chan->samplebufnext * f) + (chan->samplebufcur * (0x4000-f))) >> 14;
+      // the LFO still runs, and the loop start can reset it
+      chan->lfophase += lfophaseinc;
+      wait->amp--;
+      advance_lpf_envelope(chan, odometer + i, wait);
+      advance_phase(state, chan, features, base_phaseinc, odometer + i, wait);
+      i++;
+      if(chan->envstate != envstate) { break; }
+    }
+  }
+  //
+  // Apply the gain
+  //
+  for(n = 0; n < i; n++) {
+    buf[n] = ((buf[n] * linearvol) >> shift) << 4;
+  }
+  // Store in ring modulation buffer, if we're SCSP and it's enabled
+  if((features & GEN_SCSP) && !chan->stwinh) {
+    uint32 bufptr = state->bufptr;
+    for(n = 0; n < i; n++) {
+      state->ringbuf[bufptr] = buf[n] >> 4;
+      bufptr = (bufptr + 32) & (32*RINGMAX-1);
+    }
+  }
+  return i;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // Generate samples
 // Samples are returned in 20-bit format
 // Returns the number of samples actually generated
 //
-static uint32 generate_samples(
+// This is instantiated once per combination of GEN_ features below, so the
+// per-sample tests for them fold away
+//
+static GEN_INLINE uint32 generate_samples_kernel(
   struct YAM_STATE *state,
   struct YAM_CHAN *chan,
   sint32 *buf,
   uint32 odometer,
-  uint32 samples
+  uint32 samples,
+  uint32 features
 ) {
   uint32 g;
   uint32 base_phaseinc;
   uint32 lfophaseinc = lfophaseinctable[chan->lfof];
   uint32 bufptrsave = state->bufptr;
+  struct YAM_ENVWAIT wait;
 
 //gfreq[samples]++;
 
 //printf("generate_samples(%08X,%08X,%u)\n",chan,buf,samples);
 
-  { uint32 oct = chan->oct^8;
-    uint32 fns = chan->fns^0x400;
-    base_phaseinc = fns << oct;
-    // weird ADPCM thing mentioned in official doc
-    if(chan->pcms == 2 && oct >= 0xA) { base_phaseinc <<= 1; }
-  }
+  base_phaseinc = base_phase_increment(chan);
+  envwait_init(&wait, chan, odometer);
 
-  for(g = 0; g < samples; g++) {
+  for(g = 0; g < samples; ) {
 //buf[g]=g*100;continue;
     //
     // If the amp envelope is inactive, quit
@@ -2126,12 +3282,26 @@ static uint32 generate_samples(
       break;
     }
     //
+    // If the gain can't change for a while, do the whole stretch at once
+    //
+    if(channel_is_steady(chan, features, &wait)) {
+      uint32 n = samples - g;
+      if(n > wait.amp) { n = wait.amp; }
+      n = generate_steady_span(state, chan, buf ? buf + g : NULL, features, base_phaseinc, lfophaseinc, odometer, n, &wait);
+      if(n) {
+        state->bufptr = (state->bufptr + 32 * n) & (32*RINGMAX-1);
+        odometer += n;
+        g += n;
+        continue;
+      }
+    }
+    //
     // If we must generate a sample, generate it
     //
     if(buf) {
       sint32 s, s_cur, s_next, f;
       // Apply SCSP ring modulation, if necessary
-      if(state->version==1 && (chan->mdl!=0 || chan->mdxsl!=0 || chan->mdysl!=0)) {
+      if((features & GEN_SCSP) && (chan->mdl!=0 || chan->mdxsl!=0 || chan->mdysl!=0)) {
         sint32 smp=(state->ringbuf[(state->bufptr-64+chan->mdxsl)&(32*RINGMAX-1)]+state->ringbuf[(state->bufptr-64+chan->mdysl)&(32*RINGMAX-1)])/2;
         smp<<=0xA; // associate cycle with 1024
         smp>>=0x1A-chan->mdl; // ex. for MDL=0xF, sample range corresponds to +/- 64 pi (32=2^5 cycles) so shift by 11 (16-5 == 0x1A-0xF)
@@ -2151,25 +3321,7 @@ static uint32 generate_samples(
         attenuation = ((uint32)(chan->tl)) << 2;
         attenuation += ((uint32)(chan->envlevel)) & ((uint32)(chan->envlevelmask[chan->envstate]));
         // LFO amplitude modulation
-        if(chan->alfos) {
-          uint32 att_wave_y = 0;
-          switch(chan->alfows) {
-          case 0: // sawtooth
-            att_wave_y = ((uint32)(chan->lfophase)) >> 24;
-            break;
-          case 1: // square
-            att_wave_y = (((sint32)(chan->lfophase)) >> 31) & 0xFF;
-            break;
-          case 2: // triangle
-            att_wave_y = (chan->lfophase >> 23) & 0xFF;
-            if(chan->lfophase & 0x80000000) { att_wave_y ^= 0xFF; }
-            break;
-          case 3: // noise
-            att_wave_y = yamrand16(state) & 0xFF;
-            break;
-          }
-          attenuation += (att_wave_y >> (7 - (chan->alfos)));
-        }
+        if(features & GEN_ALFO) { attenuation += lfo_attenuation(state, chan); }
         if(attenuation >= 0x3C0) {
           s = 0;
         } else {
@@ -2179,11 +3331,11 @@ static uint32 generate_samples(
         }
       }
       // Store in ring modulation buffer, if we're SCSP and it's enabled
-      if(state->version == 1 && !chan->stwinh) {
+      if((features & GEN_SCSP) && !chan->stwinh) {
         state->ringbuf[state->bufptr] = s;
       }
       // Apply filter, if we want it
-      if(!(chan->lpoff)) {
+      if(features & GEN_LPF) {
         uint32 fv = chan->lpflevel;
         uint32 qv = chan->q & 0x1F;
         sint32 f = (((fv & 0xFF) | 0x100) << 4) >> ((fv >> 8) ^ 0x1F);
@@ -2202,105 +3354,260 @@ static uint32 generate_samples(
     // Now we need to advance the channel state machine, regardless of
     // whether we're generating output or not
     //
-    //
-    // Advance LFO phase
-    //
-    chan->lfophase += lfophaseinc;
-    //
-    // Advance amplitude envelope
-    //
-    { uint32 effectiverate = env_adjustrate(chan, chan->ar[chan->envstate]);
-      if(env_needstep(effectiverate, odometer)) {
-        switch(chan->envstate) {
-        case 0: // attack
-          chan->envlevel -= (chan->envlevel >> envattackshift[effectiverate][odometer&3]) + 1;
-          if(chan->envlevel == 0) { chan->envstate = 1; }
-          break;
-        case 1: // decay
-          chan->envlevel += envdecayvalue[effectiverate][odometer&3];
-          if((chan->envlevel >> 5) >= chan->dl) { chan->envstate = 2; }
-          break;
-        case 2: // sustain
-        case 3: // release
-          chan->envlevel += envdecayvalue[effectiverate][odometer&3];
-          break;
-        }
+    advance_channel(state, chan, features, base_phaseinc, lfophaseinc, odometer, &wait);
+    // Advance our temporary odometer copy
+    odometer++;
+    // Done with this sample!
+    g++;
+  }
+  state->bufptr = bufptrsave;
+  return g;
+}
+
+#define GENERATE_KERNEL(n) \
+static uint32 generate_samples_##n( \
+  struct YAM_STATE *state, struct YAM_CHAN *chan, sint32 *buf, uint32 odometer, uint32 samples \
+) { return generate_samples_kernel(state, chan, buf, odometer, samples, n); }
+
+GENERATE_KERNEL(0)
+GENERATE_KERNEL(1)
+GENERATE_KERNEL(2)
+GENERATE_KERNEL(3)
+GENERATE_KERNEL(4)
+GENERATE_KERNEL(5)
+GENERATE_KERNEL(6)
+GENERATE_KERNEL(7)
+GENERATE_KERNEL(8)
+GENERATE_KERNEL(9)
+GENERATE_KERNEL(10)
+GENERATE_KERNEL(11)
+GENERATE_KERNEL(12)
+GENERATE_KERNEL(13)
+GENERATE_KERNEL(14)
+GENERATE_KERNEL(15)
+
+static uint32 (* const generate_kernels[GEN_KINDS])(
+  struct YAM_STATE *state, struct YAM_CHAN *chan, sint32 *buf, uint32 odometer, uint32 samples
+) = {
+  generate_samples_0 , generate_samples_1 , generate_samples_2 , generate_samples_3 ,
+  generate_samples_4 , generate_samples_5 , generate_samples_6 , generate_samples_7 ,
+  generate_samples_8 , generate_samples_9 , generate_samples_10, generate_samples_11,
+  generate_samples_12, generate_samples_13, generate_samples_14, generate_samples_15
+};
+
+//
+// Pick the kernel for the channel's current features; they can only change
+// through register writes, which happen between spans
+//
+static uint32 generate_samples(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  sint32 *buf,
+  uint32 odometer,
+  uint32 samples
+) {
+  return generate_kernels[generate_features(state, chan)](state, chan, buf, odometer, samples);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Channel state as of the current odometer, for the status registers
+//
+// The pending samples haven't been rendered yet, so the channel itself is
+// behind. Instead of flushing everything, a copy of it is run through them
+// without output, in the same steps yam_flush will use; the channel is
+// left for the next render. The copy is kept until the next flush, so
+// polling only ever runs it over the samples since the last poll.
+//
+// Queued writes to the channel are applied first, which renders up to the
+// last of them. Pitch LFO noise, which depends on the draws of every other
+// channel, makes it a real flush after all.
+//
+static struct YAM_CHAN *chan_status(struct YAM_STATE *state, uint32 c) {
+  struct YAM_CHAN *chan = state->chan + c;
+  struct YAM_CHAN *status = state->status + c;
+  uint32 base;
+  uint32 odometer;
+  uint32 randseed;
+  const uint32 *ram_write_gen = state->ram_write_gen;
+  if((state->writequeue_chans >> c) & 1) { apply_queued_writes(state); }
+  if(state->out_pending && chan->plfos && chan->plfows == 3) { yam_flush(state); }
+  // Where the next flush will start
+  base = state->odometer - state->out_pending;
+  if(!((state->status_valid >> c) & 1)) {
+    *status = *chan;
+    // Only positions matter here, so leave the ADPCM cache alone
+    status->adpcmcache = 0;
+    state->status_odometer[c] = base;
+    state->status_valid |= ((uint64)1) << c;
+  }
+  randseed = state->randseed;
+  state->ram_write_gen = NULL;
+  odometer = state->status_odometer[c];
+  while(odometer != state->odometer) {
+    uint32 start = base;
+    uint32 n = state->odometer - odometer;
+    uint32 into, i;
+    // Renders are RENDERMAX from the start of the flush or the last write
+    // that ended one, and stop at the next such write
+    for(i = 0; i < state->writequeue_count; i++) {
+      uint32 t = state->writequeue[i].odometer;
+      if(state->writequeue[i].chan != WRITE_SPLIT) { continue; }
+      if(((sint32)(t - base)) <= 0) { continue; }
+      if(t - base > odometer - base) {
+        if(n > t - odometer) { n = t - odometer; }
+        break;
       }
+      start = t;
+    }
+    into = (odometer - start) % RENDERMAX;
+    if(n > RENDERMAX - into) { n = RENDERMAX - into; }
+    if(status->envlevel == 0x1FFF) { break; }
+    // Same as render_and_add_channel at the start of each render
+    if(!into && status->envlevel >= 0x3C0) { status->envlevel = 0x1FFF; status->lp = 1; break; }
+    generate_samples(state, status, NULL, odometer, n);
+    odometer += n;
+  }
+  state->status_odometer[c] = state->odometer;
+  state->ram_write_gen = ram_write_gen;
+  state->randseed = randseed;
+  return status;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Generate samples for up to YAM_LANES AICA channels at once
+//
+// The output math (interpolation, attenuation, lowpass) runs on
+// structure-of-arrays copies of the hot channel fields, one lane per
+// channel, through the lanes kernel: AVX2 when the CPU has it, plain C
+// otherwise. The state machines are still advanced one channel at a time,
+// in advance_channel.
+//
+// Channels that use the noise generator must not go through here, since
+// interleaving them would change the order of the random numbers.
+// Fills in the number of samples actually generated for each channel.
+//
+static void generate_samples_lanes(
+  struct YAM_STATE *state,
+  struct YAM_CHAN **chan,
+  uint32 nlanes,
+  sint32 (*buf)[RENDERMAX],
+  uint32 *rendersamples,
+  uint32 odometer,
+  uint32 samples
+) {
+  uint32 g, l;
+  uint32 live = 0;
+  uint32 base_phaseinc[YAM_LANES];
+  uint32 lfophaseinc[YAM_LANES];
+  struct YAM_ENVWAIT wait[YAM_LANES];
+  uint32 features[YAM_LANES];
+  struct YAM_LANEDATA d;
+
+  for(l = 0; l < YAM_LANES; l++) {
+    struct YAM_CHAN *c;
+    if(l >= nlanes) {
+      // unused lane: computes silence and keeps no state
+      d.cur[l] = d.next[l] = d.frc[l] = d.att[l] = d.lpflevel[l] = d.q[l] = 0;
+      d.lpp1[l] = d.lpp2[l] = d.voff[l] = d.lpon[l] = 0;
+      continue;
     }
+    c = chan[l];
+    live |= 1 << l;
+    rendersamples[l] = samples;
+    base_phaseinc[l] = base_phase_increment(c);
+    lfophaseinc[l] = lfophaseinctable[c->lfof];
+    envwait_init(wait + l, c, odometer);
+    features[l] = generate_features(state, c);
+    d.q[l] = qtable[c->q & 0x1F];
+    d.lpp1[l] = c->lpp1;
+    d.lpp2[l] = c->lpp2;
+    d.voff[l] = c->voff;
+    d.lpon[l] = !(c->lpoff);
+  }
+
+  for(g = 0; g < samples; g++) {
     //
-    // Advance filter envelope
-    //
-    { uint32 effectiverate = env_adjustrate(chan, chan->fr[chan->lpfstate]);
-      if(env_needstep(effectiverate, odometer)) {
-        uint32 d = envdecayvalue[effectiverate][odometer&3];
-        uint32 target = chan->flv[chan->lpfstate+1];
-        if(chan->lpflevel < target) {
-          uint32 maxd = target - chan->lpflevel;
-          if(d > maxd) { d = maxd; }
-          chan->lpflevel += d;
-        } else if(chan->lpflevel > target) {
-          uint32 maxd = chan->lpflevel - target;
-          if(d > maxd) { d = maxd; }
-          chan->lpflevel -= d;
-        } else {
-          if(chan->lpfstate < 3) { chan->lpfstate++; }
-        }
-      }
+    // Gather the state each lane's sample depends on
+    //
+    for(l = 0; l < nlanes; l++) {
+      struct YAM_CHAN *c = chan[l];
+      if(!(live & (1 << l))) { continue; }
+      d.cur[l] = c->samplebufcur;
+      d.next[l] = c->samplebufnext;
+      d.frc[l] = c->frcphase;
+      d.att[l] = (((uint32)(c->tl)) << 2) + (c->envlevel & c->envlevelmask[c->envstate]);
+      if(c->alfos) { d.att[l] += lfo_attenuation(state, c); }
+      d.lpflevel[l] = c->lpflevel;
     }
     //
-    // Advance the sample phase
+    // Interpolate, attenuate and filter all lanes
     //
-    { uint32 realphaseinc = base_phaseinc;
-      //
-      // LFO pitch shifting
-      //
-      if(chan->plfos) {
-        uint32 pitch_wave_y = 0;
-        switch(chan->plfows) {
-        case 0: // sawtooth
-          pitch_wave_y = chan->lfophase ^ 0x80000000;
-          break;
-        case 1: // square
-          pitch_wave_y = (chan->lfophase & 0x80000000) ? 0 : 0xFFFFFFFF;
-          break;
-        case 2: // triangle
-          pitch_wave_y = (chan->lfophase << 1) + 0x80000000;
-          if(chan->lfophase >= 0x40000000 && chan->lfophase < 0xC0000000) {
-            pitch_wave_y = ~pitch_wave_y;
-          }
-          break;
-        case 3: // noise
-          pitch_wave_y = yamrand16(state) << 16;
-          break;
-        }
-        { uint32 maxvary = base_phaseinc >> (10-(chan->plfos));
-          uint32 scaled_pitch_wave_y =
-            (((uint64)(maxvary*2)) * ((uint64)pitch_wave_y)) >> 32;
-          realphaseinc = base_phaseinc + scaled_pitch_wave_y - maxvary;
-        }
-      }
-      //
-      // Advance phase, and read new sample data if necessary
-      //
-      chan->frcphase += realphaseinc;
-      while(chan->frcphase >= 0x40000) {
-        chan->frcphase -= 0x40000;
-        readnextsample(state, chan, 0, 1);
+    mixer.lanes(&d);
+    for(l = 0; l < nlanes; l++) { buf[l][g] = d.out[l]; }
+    //
+    // Advance each live channel, and retire the ones that went silent
+    //
+    for(l = 0; l < nlanes; l++) {
+      struct YAM_CHAN *c = chan[l];
+      if(!(live & (1 << l))) { continue; }
+      advance_channel(state, c, features[l], base_phaseinc[l], lfophaseinc[l], odometer, wait + l);
+      if(c->envlevel >= 0x3C0 && (g + 1) < samples) {
+        c->envlevel = 0x1FFF;
+        c->lpp1 = d.lpp1[l];
+        c->lpp2 = d.lpp2[l];
+        rendersamples[l] = g + 1;
+        live &= ~(1 << l);
+        d.lpon[l] = 0;
       }
     }
-    // Advance our temporary odometer copy
     odometer++;
-    // Done with this sample!
   }
-  state->bufptr = bufptrsave;
-  return g;
+
+  for(l = 0; l < nlanes; l++) {
+    if(live & (1 << l)) {
+      chan[l]->lpp1 = d.lpp1[l];
+      chan[l]->lpp2 = d.lpp2[l];
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// Add a channel's generated samples to the given outputs
+//
+static void add_channel_output(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  const sint32 *localbuf,
+  uint32 rendersamples,
+  sint32 *directout,
+  sint32 *fxout
+) {
+  if(directout && chan->disdl) {
+    uint8 att_l, att_r;
+    sint32 lin_l, lin_r;
+    convert_stereo_send_level(
+      chan->disdl,
+      (state->mono) ? 0 : (chan->dipan),
+      &att_l, &att_r, &lin_l, &lin_r
+    );
+    mixer.stereo(directout, localbuf, rendersamples, lin_l, att_l, lin_r, att_r);
+  }
+  if(fxout && chan->dsplevel) {
+    uint32 att = (chan->dsplevel) ^ 0xF;
+    sint32 lin = 4 - (att & 1);
+    att >>= 1; att += 2;
+    mixer.mono(fxout, localbuf, rendersamples, lin, att);
+  }
 }
 
 /////////////////////////////////////////////////////////////////////////////
 //
 // Render a single channel and add it to the given outputs
 //
-// directout or fxout may be NULL
+// directout (interleaved stereo) or fxout (one bus) may be NULL
 //
 static void render_and_add_channel(
   struct YAM_STATE *state,
@@ -2310,7 +3617,6 @@ static void render_and_add_channel(
   uint32 odometer,
   uint32 samples
 ) {
-  uint32 i;
   sint32 localbuf[RENDERMAX];
   uint32 rendersamples;
 
@@ -2331,30 +3637,99 @@ static void render_and_add_channel(
   );
 
   // Add to output
-  if(directout) {
-    uint8 att_l, att_r;
-    sint32 lin_l, lin_r;
-    convert_stereo_send_level(
-      chan->disdl,
-      (state->mono) ? 0 : (chan->dipan),
-      &att_l, &att_r, &lin_l, &lin_r
-    );
-    for(i = 0; i < rendersamples; i++) {
-      directout[0] += (localbuf[i]*lin_l) >> att_l;
-      directout[1] += (localbuf[i]*lin_r) >> att_r;
-      directout += 2;
-    }
+  add_channel_output(state, chan, localbuf, rendersamples, directout, fxout);
+}
+
+//
+// Whether a channel can be rendered through generate_samples_lanes
+// (AICA only, audible, no noise, and not steady for the whole span)
+//
+static int channel_fits_lanes(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  sint32 *directout,
+  sint32 *fxout,
+  uint32 odometer,
+  uint32 samples
+) {
+  if(state->version != 2) { return 0; }
+  if(chan->envlevel >= 0x3C0) { return 0; }
+  if(!(directout && chan->disdl) && !(fxout && chan->dsplevel)) { return 0; }
+  if(chan->ssctl == 1) { return 0; }
+  if(chan->alfos && chan->alfows == 3) { return 0; }
+  if(chan->plfos && chan->plfows == 3) { return 0; }
+  // Steady PCM voices are cheaper on their own, see generate_steady_span
+  if(
+    !(generate_features(state, chan) & (GEN_LPF | GEN_ALFO | GEN_PLFO)) &&
+    chan->pcms < 2 &&
+    env_amp_wait(chan, odometer) >= samples
+  ) { return 0; }
+  return 1;
+}
+
+//
+// Render up to YAM_LANES channels side by side and add them to the outputs
+//
+static void render_and_add_lanes(
+  struct YAM_STATE *state,
+  struct YAM_CHAN **chan,
+  uint32 nlanes,
+  sint32 *directout,
+  sint32 **fxout,
+  uint32 odometer,
+  uint32 samples
+) {
+  sint32 localbuf[YAM_LANES][RENDERMAX];
+  uint32 rendersamples[YAM_LANES];
+  uint32 l;
+
+  generate_samples_lanes(state, chan, nlanes, localbuf, rendersamples, odometer, samples);
+
+  for(l = 0; l < nlanes; l++) {
+    add_channel_output(state, chan[l], localbuf[l], rendersamples[l], directout, fxout[l]);
   }
-  if(fxout) {
-    uint32 att = (chan->dsplevel) ^ 0xF;
-    sint32 lin = 4 - (att & 1);
-    att >>= 1; att += 2;
-    for(i = 0; i < rendersamples; i++) {
-      fxout[0] += (localbuf[i]*lin) >> att;
-      fxout += 16;
+}
+
+//
+// Render a channel in pieces, applying the queued writes that touch it
+// at their samples along the way
+//
+// fxbus is all 16 buses, or NULL; the channel's bus may change midway
+//
+static void render_and_add_channel_writes(
+  struct YAM_STATE *state,
+  struct YAM_CHAN *chan,
+  sint32 *directout,
+  sint32 *fxbus,
+  const struct YAM_WRITE *writes,
+  uint32 nwrites,
+  uint32 bufptr,
+  uint32 odometer,
+  uint32 samples
+) {
+  uint32 c = chan - state->chan;
+  uint32 done = 0;
+  uint32 w;
+  for(w = 0; w <= nwrites; w++) {
+    uint32 until = samples;
+    if(w < nwrites) {
+      if(writes[w].chan != c && !writes[w].kyonex) { continue; }
+      until = writes[w].odometer - odometer;
+    }
+    if(until > done) {
+      state->bufptr = (bufptr + 32 * done) & (32*RINGMAX-1);
+      render_and_add_channel(
+        state,
+        chan,
+        directout ? (directout + 2 * done) : NULL,
+        fxbus ? (fxbus + chan->dspchan * RENDERMAX + done) : NULL,
+        odometer + done,
+        until - done
+      );
+      done = until;
     }
+    if(w < nwrites) { apply_channel_write(state, chan, writes + w); }
   }
-
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -2900,12 +4275,12 @@ static void render_effects(
   //
   // For every sample:
   //
-  for(i = 0; i < samples; i++, fxbus += 16, out += 2) {
+  for(i = 0; i < samples; i++, out += 2) {
     //
     // Clip and copy fxbus inputs (20-bit, pre-promote to 24-bit)
     //
     for(j = 0; j < 16; j++) {
-      sint32 t = fxbus[j];
+      sint32 t = fxbus[j * RENDERMAX + i];
       if(t < (-0x80000)) t = (-0x80000);
       if(t > ( 0x7FFFF)) t = ( 0x7FFFF);
       state->inputs[0x20 + j] = t << 4;
@@ -2943,18 +4318,61 @@ int __cdecl render_priority_compare(const void * a, const void * b) {
   struct render_priority *_b = (struct render_priority *) b;
   return _b->priority_level - _a->priority_level;
 }
-static void render(struct YAM_STATE *state, uint32 odometer, uint32 samples) {
-  uint32 i, j;
+
+//
+// Figure out if any channels need to be rendered before others
+// Only depends on MDXSL/MDYSL, so it's kept until one of those is written
+//
+static void render_order_build(struct YAM_STATE *state) {
+  uint32 i;
   struct render_priority priority_list[64];
+  uint32 nchannels = ((state->version) == 1) ? 32 : 64;
+  for(i = 0; i < nchannels; i++) {
+    priority_list[i].channel_number = i;
+    priority_list[i].priority_level = 0;
+  }
+  if (state->version == 1) {
+    for(i = 0; i < nchannels; i++) {
+      struct YAM_CHAN *chan = state->chan + i;
+      sint32 priority_level = priority_list[i].priority_level + 1;
+      if (chan->mdxsl) priority_list[(i+chan->mdxsl)&31].priority_level = priority_level;
+      if (chan->mdysl) priority_list[(i+chan->mdysl)&31].priority_level = priority_level;
+    }
+    qsort(&priority_list, nchannels, sizeof(*priority_list), render_priority_compare);
+  }
+  for(i = 0; i < nchannels; i++) {
+    state->render_order[i] = priority_list[i].channel_number;
+  }
+  state->render_order_valid = 1;
+}
+
+//
+// writes are queued channel writes that fall inside this render
+//
+static void render(
+  struct YAM_STATE *state,
+  uint32 odometer,
+  uint32 samples,
+  const struct YAM_WRITE *writes,
+  uint32 nwrites
+) {
+  uint32 i, j;
   sint32 outbuf[2*RENDERMAX];
-  sint32 fxbus[16*RENDERMAX];
+  sint32 fxbus[16*RENDERMAX]; // one RENDERMAX run per bus
   sint32 *directout;
 //  sint32 *fxout;
   sint16 *buf;
   uint32 nchannels;
   uint32 bufptr_base;
+  struct YAM_CHAN *lanechan[YAM_LANES];
+  sint32 *lanefx[YAM_LANES];
+  uint32 nlanes = 0;
+  uint64 written = 0;
   int wantreverb = 0;
   if(!samples) return;
+  state->render_calls++;
+  state->render_samples += samples;
+  if(state->ram_write_gen) { adpcm_cache_validate(state); }
   buf = YAMSTATE->out_buf;
   directout = (buf && (state->dry_out_enabled)) ? outbuf : NULL;
   nchannels = ((YAMSTATE->version) == 1) ? 32 : 64;
@@ -2987,23 +4405,14 @@ fclose(f);
   }
   if(buf) {
     memset(outbuf, 0, 4*2*samples);
-    if(wantreverb) memset(fxbus, 0, 4*16*samples);
-  }
-  //
-  // Figure out if any channels need to be rendered before others
-  //
-  for(i = 0; i < nchannels; i++) {
-    priority_list[i].channel_number = i;
-    priority_list[i].priority_level = 0;
-  }
-  if (state->version == 1) {
-    for(i = 0; i < nchannels; i++) {
-      struct YAM_CHAN *chan = state->chan + i;
-      sint32 priority_level = priority_list[i].priority_level + 1;
-      if (chan->mdxsl) priority_list[(i+chan->mdxsl)&31].priority_level = priority_level;
-      if (chan->mdysl) priority_list[(i+chan->mdysl)&31].priority_level = priority_level;
+    if(wantreverb) {
+      for(i = 0; i < 16; i++) { memset(fxbus + i * RENDERMAX, 0, 4*samples); }
     }
-    qsort(&priority_list, nchannels, sizeof(*priority_list), render_priority_compare);
+  }
+  if(!(state->render_order_valid)) { render_order_build(state); }
+  for(i = 0; i < nwrites; i++) {
+    if(writes[i].kyonex) { written = ~((uint64)0); }
+    else { written |= ((uint64)1) << writes[i].chan; }
   }
   bufptr_base = state->bufptr;
   //
@@ -3011,14 +4420,38 @@ fclose(f);
   //
   for(i = 0; i < nchannels; i++) {
     struct YAM_CHAN *chan;
-    j = priority_list[i].channel_number;
+    sint32 *fxout;
+    j = state->render_order[i];
+    // Silent channels don't do anything, unless a write keys them on
+    if(!(((state->active | written) >> j) & 1)) { continue; }
     chan = state->chan + j;
+    if((written >> j) & 1) {
+      render_and_add_channel_writes(
+        state, chan, directout, wantreverb ? fxbus : NULL,
+        writes, nwrites, bufptr_base + j, odometer, samples
+      );
+      continue;
+    }
     state->bufptr = bufptr_base + j;
+    fxout = wantreverb ? (fxbus + chan->dspchan * RENDERMAX) : NULL;
 // is 11
-    render_and_add_channel(state, chan, directout,
-      wantreverb ? (fxbus + chan->dspchan) : NULL,
-      odometer, samples
-    );
+    // Batch up channels the multi-voice generator can take
+    if(channel_fits_lanes(state, chan, directout, fxout, odometer, samples)) {
+      lanechan[nlanes] = chan;
+      lanefx[nlanes] = fxout;
+      if(++nlanes == YAM_LANES) {
+        render_and_add_lanes(state, lanechan, nlanes, directout, lanefx, odometer, samples);
+        nlanes = 0;
+      }
+      continue;
+    }
+    render_and_add_channel(state, chan, directout, fxout, odometer, samples);
+  }
+  if(nlanes) {
+    render_and_add_lanes(state, lanechan, nlanes, directout, lanefx, odometer, samples);
+  }
+  for(i = 0; i < nchannels; i++) {
+    if(state->chan[i].envlevel == 0x1FFF) { state->active &= ~(((uint64)1) << i); }
   }
   state->bufptr = (bufptr_base + (32*samples)) & (32*RINGMAX-1);
   //
@@ -3032,19 +4465,46 @@ fclose(f);
     uint32 att = state->mvol ^ 0xF;
     sint32 lin = 4 - (att & 1);
     att >>= 1; att += 2; att += 4;
-    for(i = 0; i < samples; i++) {
-      sint32 l = outbuf[2 * i + 0];
-      sint32 r = outbuf[2 * i + 1];
-      l *= lin; l >>= att;
-      r *= lin; r >>= att;
-      if(l < (-0x8000)) l = (-0x8000);
-      if(r < (-0x8000)) r = (-0x8000);
-      if(l > ( 0x7FFF)) l = ( 0x7FFF);
-      if(r > ( 0x7FFF)) r = ( 0x7FFF);
-      buf[2 * i + 0] = l;
-      buf[2 * i + 1] = r;
+    mixer.clip(buf, outbuf, 2 * samples, lin, att);
+  }
+}
+
+//
+// Render the first 'samples' pending samples, applying the queued writes
+// due by then; every queued write must be due by then
+//
+static void flush_samples(struct YAM_STATE *state, uint32 samples) {
+  uint32 w = 0;
+  uint32 end = state->odometer - state->out_pending + samples;
+  state->status_valid = 0;
+
+  for(;;) {
+    uint32 odometer = state->odometer - state->out_pending;
+    uint32 n = end - odometer;
+    uint32 nwrites = 0;
+    // Apply the writes that are due
+    for(; w < state->writequeue_count; w++) {
+      uint32 until = state->writequeue[w].odometer - odometer;
+      if(((sint32)until) > 0) { break; }
+      apply_write(state, state->writequeue + w);
     }
+    if(n < 1) { break; }
+    if(n > RENDERMAX) { n = RENDERMAX; }
+    // Channel writes are done inside the render; anything else ends it
+    for(; w + nwrites < state->writequeue_count; nwrites++) {
+      const struct YAM_WRITE *next = state->writequeue + w + nwrites;
+      uint32 until = next->odometer - odometer;
+      if(until >= n) { break; }
+      if(next->chan == WRITE_SPLIT) { n = until; break; }
+    }
+    render(state, odometer, n, state->writequeue + w, nwrites);
+    w += nwrites;
+    state->out_pending -= n;
+    if(state->out_buf) { state->out_buf += 2 * n; }
   }
+  state->writequeue_count = 0;
+  state->writequeue_chans = 0;
+  state->writequeue_sensitive = 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -3054,15 +4514,16 @@ fclose(f);
 void EMU_CALL yam_flush(void *state) {
 //  return;
 //printf("yam_flush(%up)",YAMSTATE->out_pending);
+  flush_samples(YAMSTATE, YAMSTATE->out_pending);
+}
 
-  for(;;) {
-    uint32 n = YAMSTATE->out_pending;
-    if(n < 1) { break; }
-    if(n > RENDERMAX) { n = RENDERMAX; }
-    render(YAMSTATE, YAMSTATE->odometer - YAMSTATE->out_pending, n);
-    YAMSTATE->out_pending -= n;
-    if(YAMSTATE->out_buf) { YAMSTATE->out_buf += 2 * n; }
-  }
+/////////////////////////////////////////////////////////////////////////////
+//
+// Average number of samples per render since the state was cleared
+//
+uint32 EMU_CALL yam_get_average_render_span(void *state) {
+  if(!(YAMSTATE->render_calls)) { return 0; }
+  return (uint32)((YAMSTATE->render_samples) / (YAMSTATE->render_calls));
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -27,9 +27,17 @@ void   EMU_CALL yam_enable_dsp(void *state, uint8 enable);
 void   EMU_CALL yam_enable_dsp_dynarec(void *state, uint8 enable);
 
 void   EMU_CALL yam_setram(void *state, uint32 *ram, uint32 size, uint8 mbx, uint8 mwx);
+
+// Per-page RAM write counters, gen[(offset >> shift) & (count - 1)], which
+// must change whenever that page is written by anything but the yam itself.
+// Enables caching of decoded ADPCM loops (AICA only); NULL disables it.
+void   EMU_CALL yam_setramwritegen(void *state, const uint32 *gen, uint32 shift, uint32 count);
 void   EMU_CALL yam_beginbuffer(void *state, sint16 *buf);
 void   EMU_CALL yam_advance(void *state, uint32 samples);
 void   EMU_CALL yam_flush(void *state);
+// Average samples per internal render since the state was cleared (renders
+// are at most 200 samples, fewer when a flush or register write ends one)
+uint32 EMU_CALL yam_get_average_render_span(void *state);
 
 uint32 EMU_CALL yam_aica_load_reg(void *state, uint32 a, uint32 mask);
 void   EMU_CALL yam_aica_store_reg(void *state, uint32 a, uint32 d, uint32 mask, uint8 *breakcpu);
@@ -39,6 +47,7 @@ void   EMU_CALL yam_scsp_store_reg(void *state, uint32 a, uint32 d, uint32 mask,
 
 uint8* EMU_CALL yam_get_interrupt_pending_ptr(void *state);
 uint32 EMU_CALL yam_get_min_samples_until_interrupt(void *state);
+uint32 EMU_CALL yam_get_min_samples_until_timer(void *state);
 
 void   EMU_CALL yam_prepare_dynacode(void *state);
 void   EMU_CALL yam_unprepare_dynacode(void *state);
@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// yammake - Generates the SCSP/AICA register decode tables
+//
+// Usage: yammake [output path]
+//
+// Writes yamtables.h, which is included by yam.c.
+//
+// There is one entry per register word, giving the kind of register and,
+// depending on the kind, the channel/index and field. They used to be filled
+// in by yam_init(); having them as const data means there is nothing left
+// to do at library start-up.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FILENAME_OUTPUT "yamtables.h"
+
+//
+// Register kinds, the REG_ names yam.c defines
+//
+enum {
+  REG_NONE, REG_SYS, REG_CHAN, REG_EFX, REG_RING, REG_COEF, REG_MADRS,
+  REG_MPRO, REG_TEMP, REG_MEMS, REG_MIXS, REG_EFREG, REG_EXTS, REG_KINDS
+};
+
+static const char *kindname[REG_KINDS] = {
+  "REG_NONE", "REG_SYS", "REG_CHAN", "REG_EFX", "REG_RING", "REG_COEF", "REG_MADRS",
+  "REG_MPRO", "REG_TEMP", "REG_MEMS", "REG_MIXS", "REG_EFREG", "REG_EXTS"
+};
+
+struct REGDECODE {
+  int kind;
+  int slot;
+  int field;
+};
+
+static struct REGDECODE scsp_regdecode[0x1000 / 2];
+static struct REGDECODE aica_regdecode[0x10000 / 4];
+
+static void regdecode_set(struct REGDECODE *r, int kind, int slot, int field) {
+  r->kind  = kind;
+  r->slot  = slot;
+  r->field = field;
+}
+
+static void regdecode_build(void) {
+  int a;
+  for(a = 0; a < 0x1000; a += 2) {
+    struct REGDECODE *r = scsp_regdecode + (a / 2);
+    if(a < 0x400) {
+      if((a & 0x1E) < 0x18) { regdecode_set(r, REG_CHAN, a >> 5, a & 0x1E); }
+      else                  { regdecode_set(r, REG_NONE, 0, 0); }
+    }
+    else if(a < 0x600) { regdecode_set(r, REG_SYS  , 0, 0); }
+    else if(a < 0x700) { regdecode_set(r, REG_RING , (a - 0x600) / 2, 0); }
+    else if(a < 0x780) { regdecode_set(r, REG_COEF , (a/2) & 0x3F, 0); }
+    else if(a < 0x7C0) { regdecode_set(r, REG_MADRS, (a/2) & 0x1F, 0); }
+    else if(a < 0x800) { regdecode_set(r, REG_NONE , 0, 0); }
+    else if(a < 0xC00) { regdecode_set(r, REG_MPRO , ((a-0x800)/8) & 0x7F, ((a&6)^6) * 8); }
+    else if(a < 0xE00) { regdecode_set(r, REG_TEMP , (a/2) & 0xFF, 0); }
+    else if(a < 0xE80) { regdecode_set(r, REG_MEMS , (a/2) & 0x3F, 0); }
+    else if(a < 0xEC0) { regdecode_set(r, REG_MIXS , (a/2) & 0x1F, 0); }
+    else if(a < 0xEE0) { regdecode_set(r, REG_EFREG, (a/2) & 0xF, 0); }
+    else if(a < 0xEE4) { regdecode_set(r, REG_EXTS , (a/2) & 1, 0); }
+    else               { regdecode_set(r, REG_NONE , 0, 0); }
+  }
+  for(a = 0; a < 0x10000; a += 4) {
+    struct REGDECODE *r = aica_regdecode + (a / 4);
+    if(a < 0x2000) {
+      if((a & 0x7C) < 0x48) { regdecode_set(r, REG_CHAN, a >> 7, a & 0x7C); }
+      else                  { regdecode_set(r, REG_NONE, 0, 0); }
+    }
+    else if(a < 0x2048) { regdecode_set(r, REG_EFX  , (a - 0x2000) / 4, 0); }
+    else if(a < 0x3000) { regdecode_set(r, REG_SYS  , 0, 0); }
+    else if(a < 0x3200) { regdecode_set(r, REG_COEF , (a/4) & 0x7F, 0); }
+    else if(a < 0x3300) { regdecode_set(r, REG_MADRS, (a/4) & 0x3F, 0); }
+    else if(a < 0x3400) { regdecode_set(r, REG_NONE , 0, 0); }
+    else if(a < 0x3C00) { regdecode_set(r, REG_MPRO , ((a-0x3400)/16) & 0x7F, ((a&0xC)^0xC) * 4); }
+    else if(a < 0x4000) { regdecode_set(r, REG_NONE , 0, 0); }
+    else if(a < 0x4400) { regdecode_set(r, REG_TEMP , (a/4) & 0xFF, 0); }
+    else if(a < 0x4500) { regdecode_set(r, REG_MEMS , (a/4) & 0x3F, 0); }
+    else if(a < 0x4580) { regdecode_set(r, REG_MIXS , (a/4) & 0x1F, 0); }
+    else if(a < 0x45C0) { regdecode_set(r, REG_EFREG, (a/4) & 0xF, 0); }
+    else if(a < 0x45C8) { regdecode_set(r, REG_EXTS , (a/4) & 1, 0); }
+    else                { regdecode_set(r, REG_NONE , 0, 0); }
+  }
+}
+
+//
+// Eight entries per line, each line starting with the address of its first.
+// Every member of YAM_REGDECODE gets a value, reserved included, so the
+// tables stay clean under -Wextra.
+//
+static void write_table(FILE *f, const char *name, const struct REGDECODE *t, int n, int stride) {
+  int i;
+  fprintf(f, "static const struct YAM_REGDECODE %s[0x%X / %d] = {\n", name, n * stride, stride);
+  for(i = 0; i < n; i++) {
+    if(!(i & 7)) fprintf(f, "/* %04X */ ", i * stride);
+    fprintf(f, "{%s,%d,%d,0}", kindname[t[i].kind], t[i].slot, t[i].field);
+    fprintf(f, "%s", (i + 1 < n) ? "," : "");
+    fprintf(f, "%s", ((i & 7) == 7 || i + 1 == n) ? "\n" : "");
+  }
+  fprintf(f, "};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+  char filename[1024];
+  FILE *f;
+
+  regdecode_build();
+
+  sprintf(filename, "%s%s%s",
+    (argc > 1) ? argv[1] : "",
+    ((argc > 1) && argv[1][0] && argv[1][strlen(argv[1]) - 1] != '/') ? "/" : "",
+    FILENAME_OUTPUT
+  );
+  f = fopen(filename, "wt");
+  if(!f) { perror(filename); return 1; }
+
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// yamtables - SCSP/AICA register decode tables\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// GENERATED BY yammake.c - DO NOT EDIT\n");
+  fprintf(f, "// Included by yam.c\n");
+  fprintf(f, "//\n");
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n\n");
+
+  write_table(f, "scsp_regdecode", scsp_regdecode, 0x1000 / 2, 2);
+  write_table(f, "aica_regdecode", aica_regdecode, 0x10000 / 4, 4);
+
+  fprintf(f, "/////////////////////////////////////////////////////////////////////////////\n");
+  fclose(f);
+  return 0;
+}
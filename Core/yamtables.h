@@ -0,0 +1,2320 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// yamtables - SCSP/AICA register decode tables
+//
+// GENERATED BY yammake.c - DO NOT EDIT
+// Included by yam.c
+//
+/////////////////////////////////////////////////////////////////////////////
+
+static const struct YAM_REGDECODE scsp_regdecode[0x1000 / 2] = {
+/* 0000 */ {REG_CHAN,0,0,0},{REG_CHAN,0,2,0},{REG_CHAN,0,4,0},{REG_CHAN,0,6,0},{REG_CHAN,0,8,0},{REG_CHAN,0,10,0},{REG_CHAN,0,12,0},{REG_CHAN,0,14,0},
+/* 0010 */ {REG_CHAN,0,16,0},{REG_CHAN,0,18,0},{REG_CHAN,0,20,0},{REG_CHAN,0,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0020 */ {REG_CHAN,1,0,0},{REG_CHAN,1,2,0},{REG_CHAN,1,4,0},{REG_CHAN,1,6,0},{REG_CHAN,1,8,0},{REG_CHAN,1,10,0},{REG_CHAN,1,12,0},{REG_CHAN,1,14,0},
+/* 0030 */ {REG_CHAN,1,16,0},{REG_CHAN,1,18,0},{REG_CHAN,1,20,0},{REG_CHAN,1,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0040 */ {REG_CHAN,2,0,0},{REG_CHAN,2,2,0},{REG_CHAN,2,4,0},{REG_CHAN,2,6,0},{REG_CHAN,2,8,0},{REG_CHAN,2,10,0},{REG_CHAN,2,12,0},{REG_CHAN,2,14,0},
+/* 0050 */ {REG_CHAN,2,16,0},{REG_CHAN,2,18,0},{REG_CHAN,2,20,0},{REG_CHAN,2,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0060 */ {REG_CHAN,3,0,0},{REG_CHAN,3,2,0},{REG_CHAN,3,4,0},{REG_CHAN,3,6,0},{REG_CHAN,3,8,0},{REG_CHAN,3,10,0},{REG_CHAN,3,12,0},{REG_CHAN,3,14,0},
+/* 0070 */ {REG_CHAN,3,16,0},{REG_CHAN,3,18,0},{REG_CHAN,3,20,0},{REG_CHAN,3,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0080 */ {REG_CHAN,4,0,0},{REG_CHAN,4,2,0},{REG_CHAN,4,4,0},{REG_CHAN,4,6,0},{REG_CHAN,4,8,0},{REG_CHAN,4,10,0},{REG_CHAN,4,12,0},{REG_CHAN,4,14,0},
+/* 0090 */ {REG_CHAN,4,16,0},{REG_CHAN,4,18,0},{REG_CHAN,4,20,0},{REG_CHAN,4,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 00A0 */ {REG_CHAN,5,0,0},{REG_CHAN,5,2,0},{REG_CHAN,5,4,0},{REG_CHAN,5,6,0},{REG_CHAN,5,8,0},{REG_CHAN,5,10,0},{REG_CHAN,5,12,0},{REG_CHAN,5,14,0},
+/* 00B0 */ {REG_CHAN,5,16,0},{REG_CHAN,5,18,0},{REG_CHAN,5,20,0},{REG_CHAN,5,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 00C0 */ {REG_CHAN,6,0,0},{REG_CHAN,6,2,0},{REG_CHAN,6,4,0},{REG_CHAN,6,6,0},{REG_CHAN,6,8,0},{REG_CHAN,6,10,0},{REG_CHAN,6,12,0},{REG_CHAN,6,14,0},
+/* 00D0 */ {REG_CHAN,6,16,0},{REG_CHAN,6,18,0},{REG_CHAN,6,20,0},{REG_CHAN,6,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 00E0 */ {REG_CHAN,7,0,0},{REG_CHAN,7,2,0},{REG_CHAN,7,4,0},{REG_CHAN,7,6,0},{REG_CHAN,7,8,0},{REG_CHAN,7,10,0},{REG_CHAN,7,12,0},{REG_CHAN,7,14,0},
+/* 00F0 */ {REG_CHAN,7,16,0},{REG_CHAN,7,18,0},{REG_CHAN,7,20,0},{REG_CHAN,7,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0100 */ {REG_CHAN,8,0,0},{REG_CHAN,8,2,0},{REG_CHAN,8,4,0},{REG_CHAN,8,6,0},{REG_CHAN,8,8,0},{REG_CHAN,8,10,0},{REG_CHAN,8,12,0},{REG_CHAN,8,14,0},
+/* 0110 */ {REG_CHAN,8,16,0},{REG_CHAN,8,18,0},{REG_CHAN,8,20,0},{REG_CHAN,8,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0120 */ {REG_CHAN,9,0,0},{REG_CHAN,9,2,0},{REG_CHAN,9,4,0},{REG_CHAN,9,6,0},{REG_CHAN,9,8,0},{REG_CHAN,9,10,0},{REG_CHAN,9,12,0},{REG_CHAN,9,14,0},
+/* 0130 */ {REG_CHAN,9,16,0},{REG_CHAN,9,18,0},{REG_CHAN,9,20,0},{REG_CHAN,9,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0140 */ {REG_CHAN,10,0,0},{REG_CHAN,10,2,0},{REG_CHAN,10,4,0},{REG_CHAN,10,6,0},{REG_CHAN,10,8,0},{REG_CHAN,10,10,0},{REG_CHAN,10,12,0},{REG_CHAN,10,14,0},
+/* 0150 */ {REG_CHAN,10,16,0},{REG_CHAN,10,18,0},{REG_CHAN,10,20,0},{REG_CHAN,10,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0160 */ {REG_CHAN,11,0,0},{REG_CHAN,11,2,0},{REG_CHAN,11,4,0},{REG_CHAN,11,6,0},{REG_CHAN,11,8,0},{REG_CHAN,11,10,0},{REG_CHAN,11,12,0},{REG_CHAN,11,14,0},
+/* 0170 */ {REG_CHAN,11,16,0},{REG_CHAN,11,18,0},{REG_CHAN,11,20,0},{REG_CHAN,11,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0180 */ {REG_CHAN,12,0,0},{REG_CHAN,12,2,0},{REG_CHAN,12,4,0},{REG_CHAN,12,6,0},{REG_CHAN,12,8,0},{REG_CHAN,12,10,0},{REG_CHAN,12,12,0},{REG_CHAN,12,14,0},
+/* 0190 */ {REG_CHAN,12,16,0},{REG_CHAN,12,18,0},{REG_CHAN,12,20,0},{REG_CHAN,12,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 01A0 */ {REG_CHAN,13,0,0},{REG_CHAN,13,2,0},{REG_CHAN,13,4,0},{REG_CHAN,13,6,0},{REG_CHAN,13,8,0},{REG_CHAN,13,10,0},{REG_CHAN,13,12,0},{REG_CHAN,13,14,0},
+/* 01B0 */ {REG_CHAN,13,16,0},{REG_CHAN,13,18,0},{REG_CHAN,13,20,0},{REG_CHAN,13,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 01C0 */ {REG_CHAN,14,0,0},{REG_CHAN,14,2,0},{REG_CHAN,14,4,0},{REG_CHAN,14,6,0},{REG_CHAN,14,8,0},{REG_CHAN,14,10,0},{REG_CHAN,14,12,0},{REG_CHAN,14,14,0},
+/* 01D0 */ {REG_CHAN,14,16,0},{REG_CHAN,14,18,0},{REG_CHAN,14,20,0},{REG_CHAN,14,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 01E0 */ {REG_CHAN,15,0,0},{REG_CHAN,15,2,0},{REG_CHAN,15,4,0},{REG_CHAN,15,6,0},{REG_CHAN,15,8,0},{REG_CHAN,15,10,0},{REG_CHAN,15,12,0},{REG_CHAN,15,14,0},
+/* 01F0 */ {REG_CHAN,15,16,0},{REG_CHAN,15,18,0},{REG_CHAN,15,20,0},{REG_CHAN,15,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0200 */ {REG_CHAN,16,0,0},{REG_CHAN,16,2,0},{REG_CHAN,16,4,0},{REG_CHAN,16,6,0},{REG_CHAN,16,8,0},{REG_CHAN,16,10,0},{REG_CHAN,16,12,0},{REG_CHAN,16,14,0},
+/* 0210 */ {REG_CHAN,16,16,0},{REG_CHAN,16,18,0},{REG_CHAN,16,20,0},{REG_CHAN,16,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0220 */ {REG_CHAN,17,0,0},{REG_CHAN,17,2,0},{REG_CHAN,17,4,0},{REG_CHAN,17,6,0},{REG_CHAN,17,8,0},{REG_CHAN,17,10,0},{REG_CHAN,17,12,0},{REG_CHAN,17,14,0},
+/* 0230 */ {REG_CHAN,17,16,0},{REG_CHAN,17,18,0},{REG_CHAN,17,20,0},{REG_CHAN,17,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0240 */ {REG_CHAN,18,0,0},{REG_CHAN,18,2,0},{REG_CHAN,18,4,0},{REG_CHAN,18,6,0},{REG_CHAN,18,8,0},{REG_CHAN,18,10,0},{REG_CHAN,18,12,0},{REG_CHAN,18,14,0},
+/* 0250 */ {REG_CHAN,18,16,0},{REG_CHAN,18,18,0},{REG_CHAN,18,20,0},{REG_CHAN,18,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0260 */ {REG_CHAN,19,0,0},{REG_CHAN,19,2,0},{REG_CHAN,19,4,0},{REG_CHAN,19,6,0},{REG_CHAN,19,8,0},{REG_CHAN,19,10,0},{REG_CHAN,19,12,0},{REG_CHAN,19,14,0},
+/* 0270 */ {REG_CHAN,19,16,0},{REG_CHAN,19,18,0},{REG_CHAN,19,20,0},{REG_CHAN,19,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0280 */ {REG_CHAN,20,0,0},{REG_CHAN,20,2,0},{REG_CHAN,20,4,0},{REG_CHAN,20,6,0},{REG_CHAN,20,8,0},{REG_CHAN,20,10,0},{REG_CHAN,20,12,0},{REG_CHAN,20,14,0},
+/* 0290 */ {REG_CHAN,20,16,0},{REG_CHAN,20,18,0},{REG_CHAN,20,20,0},{REG_CHAN,20,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 02A0 */ {REG_CHAN,21,0,0},{REG_CHAN,21,2,0},{REG_CHAN,21,4,0},{REG_CHAN,21,6,0},{REG_CHAN,21,8,0},{REG_CHAN,21,10,0},{REG_CHAN,21,12,0},{REG_CHAN,21,14,0},
+/* 02B0 */ {REG_CHAN,21,16,0},{REG_CHAN,21,18,0},{REG_CHAN,21,20,0},{REG_CHAN,21,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 02C0 */ {REG_CHAN,22,0,0},{REG_CHAN,22,2,0},{REG_CHAN,22,4,0},{REG_CHAN,22,6,0},{REG_CHAN,22,8,0},{REG_CHAN,22,10,0},{REG_CHAN,22,12,0},{REG_CHAN,22,14,0},
+/* 02D0 */ {REG_CHAN,22,16,0},{REG_CHAN,22,18,0},{REG_CHAN,22,20,0},{REG_CHAN,22,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 02E0 */ {REG_CHAN,23,0,0},{REG_CHAN,23,2,0},{REG_CHAN,23,4,0},{REG_CHAN,23,6,0},{REG_CHAN,23,8,0},{REG_CHAN,23,10,0},{REG_CHAN,23,12,0},{REG_CHAN,23,14,0},
+/* 02F0 */ {REG_CHAN,23,16,0},{REG_CHAN,23,18,0},{REG_CHAN,23,20,0},{REG_CHAN,23,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0300 */ {REG_CHAN,24,0,0},{REG_CHAN,24,2,0},{REG_CHAN,24,4,0},{REG_CHAN,24,6,0},{REG_CHAN,24,8,0},{REG_CHAN,24,10,0},{REG_CHAN,24,12,0},{REG_CHAN,24,14,0},
+/* 0310 */ {REG_CHAN,24,16,0},{REG_CHAN,24,18,0},{REG_CHAN,24,20,0},{REG_CHAN,24,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0320 */ {REG_CHAN,25,0,0},{REG_CHAN,25,2,0},{REG_CHAN,25,4,0},{REG_CHAN,25,6,0},{REG_CHAN,25,8,0},{REG_CHAN,25,10,0},{REG_CHAN,25,12,0},{REG_CHAN,25,14,0},
+/* 0330 */ {REG_CHAN,25,16,0},{REG_CHAN,25,18,0},{REG_CHAN,25,20,0},{REG_CHAN,25,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0340 */ {REG_CHAN,26,0,0},{REG_CHAN,26,2,0},{REG_CHAN,26,4,0},{REG_CHAN,26,6,0},{REG_CHAN,26,8,0},{REG_CHAN,26,10,0},{REG_CHAN,26,12,0},{REG_CHAN,26,14,0},
+/* 0350 */ {REG_CHAN,26,16,0},{REG_CHAN,26,18,0},{REG_CHAN,26,20,0},{REG_CHAN,26,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0360 */ {REG_CHAN,27,0,0},{REG_CHAN,27,2,0},{REG_CHAN,27,4,0},{REG_CHAN,27,6,0},{REG_CHAN,27,8,0},{REG_CHAN,27,10,0},{REG_CHAN,27,12,0},{REG_CHAN,27,14,0},
+/* 0370 */ {REG_CHAN,27,16,0},{REG_CHAN,27,18,0},{REG_CHAN,27,20,0},{REG_CHAN,27,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0380 */ {REG_CHAN,28,0,0},{REG_CHAN,28,2,0},{REG_CHAN,28,4,0},{REG_CHAN,28,6,0},{REG_CHAN,28,8,0},{REG_CHAN,28,10,0},{REG_CHAN,28,12,0},{REG_CHAN,28,14,0},
+/* 0390 */ {REG_CHAN,28,16,0},{REG_CHAN,28,18,0},{REG_CHAN,28,20,0},{REG_CHAN,28,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 03A0 */ {REG_CHAN,29,0,0},{REG_CHAN,29,2,0},{REG_CHAN,29,4,0},{REG_CHAN,29,6,0},{REG_CHAN,29,8,0},{REG_CHAN,29,10,0},{REG_CHAN,29,12,0},{REG_CHAN,29,14,0},
+/* 03B0 */ {REG_CHAN,29,16,0},{REG_CHAN,29,18,0},{REG_CHAN,29,20,0},{REG_CHAN,29,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 03C0 */ {REG_CHAN,30,0,0},{REG_CHAN,30,2,0},{REG_CHAN,30,4,0},{REG_CHAN,30,6,0},{REG_CHAN,30,8,0},{REG_CHAN,30,10,0},{REG_CHAN,30,12,0},{REG_CHAN,30,14,0},
+/* 03D0 */ {REG_CHAN,30,16,0},{REG_CHAN,30,18,0},{REG_CHAN,30,20,0},{REG_CHAN,30,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 03E0 */ {REG_CHAN,31,0,0},{REG_CHAN,31,2,0},{REG_CHAN,31,4,0},{REG_CHAN,31,6,0},{REG_CHAN,31,8,0},{REG_CHAN,31,10,0},{REG_CHAN,31,12,0},{REG_CHAN,31,14,0},
+/* 03F0 */ {REG_CHAN,31,16,0},{REG_CHAN,31,18,0},{REG_CHAN,31,20,0},{REG_CHAN,31,22,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0400 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0410 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0420 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0430 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0440 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0450 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0460 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0470 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0480 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0490 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 04A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 04B0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 04C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 04D0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 04E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 04F0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0500 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0510 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0520 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0530 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0540 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0550 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0560 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0570 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0580 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0590 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 05A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 05B0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 05C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 05D0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 05E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 05F0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 0600 */ {REG_RING,0,0,0},{REG_RING,1,0,0},{REG_RING,2,0,0},{REG_RING,3,0,0},{REG_RING,4,0,0},{REG_RING,5,0,0},{REG_RING,6,0,0},{REG_RING,7,0,0},
+/* 0610 */ {REG_RING,8,0,0},{REG_RING,9,0,0},{REG_RING,10,0,0},{REG_RING,11,0,0},{REG_RING,12,0,0},{REG_RING,13,0,0},{REG_RING,14,0,0},{REG_RING,15,0,0},
+/* 0620 */ {REG_RING,16,0,0},{REG_RING,17,0,0},{REG_RING,18,0,0},{REG_RING,19,0,0},{REG_RING,20,0,0},{REG_RING,21,0,0},{REG_RING,22,0,0},{REG_RING,23,0,0},
+/* 0630 */ {REG_RING,24,0,0},{REG_RING,25,0,0},{REG_RING,26,0,0},{REG_RING,27,0,0},{REG_RING,28,0,0},{REG_RING,29,0,0},{REG_RING,30,0,0},{REG_RING,31,0,0},
+/* 0640 */ {REG_RING,32,0,0},{REG_RING,33,0,0},{REG_RING,34,0,0},{REG_RING,35,0,0},{REG_RING,36,0,0},{REG_RING,37,0,0},{REG_RING,38,0,0},{REG_RING,39,0,0},
+/* 0650 */ {REG_RING,40,0,0},{REG_RING,41,0,0},{REG_RING,42,0,0},{REG_RING,43,0,0},{REG_RING,44,0,0},{REG_RING,45,0,0},{REG_RING,46,0,0},{REG_RING,47,0,0},
+/* 0660 */ {REG_RING,48,0,0},{REG_RING,49,0,0},{REG_RING,50,0,0},{REG_RING,51,0,0},{REG_RING,52,0,0},{REG_RING,53,0,0},{REG_RING,54,0,0},{REG_RING,55,0,0},
+/* 0670 */ {REG_RING,56,0,0},{REG_RING,57,0,0},{REG_RING,58,0,0},{REG_RING,59,0,0},{REG_RING,60,0,0},{REG_RING,61,0,0},{REG_RING,62,0,0},{REG_RING,63,0,0},
+/* 0680 */ {REG_RING,64,0,0},{REG_RING,65,0,0},{REG_RING,66,0,0},{REG_RING,67,0,0},{REG_RING,68,0,0},{REG_RING,69,0,0},{REG_RING,70,0,0},{REG_RING,71,0,0},
+/* 0690 */ {REG_RING,72,0,0},{REG_RING,73,0,0},{REG_RING,74,0,0},{REG_RING,75,0,0},{REG_RING,76,0,0},{REG_RING,77,0,0},{REG_RING,78,0,0},{REG_RING,79,0,0},
+/* 06A0 */ {REG_RING,80,0,0},{REG_RING,81,0,0},{REG_RING,82,0,0},{REG_RING,83,0,0},{REG_RING,84,0,0},{REG_RING,85,0,0},{REG_RING,86,0,0},{REG_RING,87,0,0},
+/* 06B0 */ {REG_RING,88,0,0},{REG_RING,89,0,0},{REG_RING,90,0,0},{REG_RING,91,0,0},{REG_RING,92,0,0},{REG_RING,93,0,0},{REG_RING,94,0,0},{REG_RING,95,0,0},
+/* 06C0 */ {REG_RING,96,0,0},{REG_RING,97,0,0},{REG_RING,98,0,0},{REG_RING,99,0,0},{REG_RING,100,0,0},{REG_RING,101,0,0},{REG_RING,102,0,0},{REG_RING,103,0,0},
+/* 06D0 */ {REG_RING,104,0,0},{REG_RING,105,0,0},{REG_RING,106,0,0},{REG_RING,107,0,0},{REG_RING,108,0,0},{REG_RING,109,0,0},{REG_RING,110,0,0},{REG_RING,111,0,0},
+/* 06E0 */ {REG_RING,112,0,0},{REG_RING,113,0,0},{REG_RING,114,0,0},{REG_RING,115,0,0},{REG_RING,116,0,0},{REG_RING,117,0,0},{REG_RING,118,0,0},{REG_RING,119,0,0},
+/* 06F0 */ {REG_RING,120,0,0},{REG_RING,121,0,0},{REG_RING,122,0,0},{REG_RING,123,0,0},{REG_RING,124,0,0},{REG_RING,125,0,0},{REG_RING,126,0,0},{REG_RING,127,0,0},
+/* 0700 */ {REG_COEF,0,0,0},{REG_COEF,1,0,0},{REG_COEF,2,0,0},{REG_COEF,3,0,0},{REG_COEF,4,0,0},{REG_COEF,5,0,0},{REG_COEF,6,0,0},{REG_COEF,7,0,0},
+/* 0710 */ {REG_COEF,8,0,0},{REG_COEF,9,0,0},{REG_COEF,10,0,0},{REG_COEF,11,0,0},{REG_COEF,12,0,0},{REG_COEF,13,0,0},{REG_COEF,14,0,0},{REG_COEF,15,0,0},
+/* 0720 */ {REG_COEF,16,0,0},{REG_COEF,17,0,0},{REG_COEF,18,0,0},{REG_COEF,19,0,0},{REG_COEF,20,0,0},{REG_COEF,21,0,0},{REG_COEF,22,0,0},{REG_COEF,23,0,0},
+/* 0730 */ {REG_COEF,24,0,0},{REG_COEF,25,0,0},{REG_COEF,26,0,0},{REG_COEF,27,0,0},{REG_COEF,28,0,0},{REG_COEF,29,0,0},{REG_COEF,30,0,0},{REG_COEF,31,0,0},
+/* 0740 */ {REG_COEF,32,0,0},{REG_COEF,33,0,0},{REG_COEF,34,0,0},{REG_COEF,35,0,0},{REG_COEF,36,0,0},{REG_COEF,37,0,0},{REG_COEF,38,0,0},{REG_COEF,39,0,0},
+/* 0750 */ {REG_COEF,40,0,0},{REG_COEF,41,0,0},{REG_COEF,42,0,0},{REG_COEF,43,0,0},{REG_COEF,44,0,0},{REG_COEF,45,0,0},{REG_COEF,46,0,0},{REG_COEF,47,0,0},
+/* 0760 */ {REG_COEF,48,0,0},{REG_COEF,49,0,0},{REG_COEF,50,0,0},{REG_COEF,51,0,0},{REG_COEF,52,0,0},{REG_COEF,53,0,0},{REG_COEF,54,0,0},{REG_COEF,55,0,0},
+/* 0770 */ {REG_COEF,56,0,0},{REG_COEF,57,0,0},{REG_COEF,58,0,0},{REG_COEF,59,0,0},{REG_COEF,60,0,0},{REG_COEF,61,0,0},{REG_COEF,62,0,0},{REG_COEF,63,0,0},
+/* 0780 */ {REG_MADRS,0,0,0},{REG_MADRS,1,0,0},{REG_MADRS,2,0,0},{REG_MADRS,3,0,0},{REG_MADRS,4,0,0},{REG_MADRS,5,0,0},{REG_MADRS,6,0,0},{REG_MADRS,7,0,0},
+/* 0790 */ {REG_MADRS,8,0,0},{REG_MADRS,9,0,0},{REG_MADRS,10,0,0},{REG_MADRS,11,0,0},{REG_MADRS,12,0,0},{REG_MADRS,13,0,0},{REG_MADRS,14,0,0},{REG_MADRS,15,0,0},
+/* 07A0 */ {REG_MADRS,16,0,0},{REG_MADRS,17,0,0},{REG_MADRS,18,0,0},{REG_MADRS,19,0,0},{REG_MADRS,20,0,0},{REG_MADRS,21,0,0},{REG_MADRS,22,0,0},{REG_MADRS,23,0,0},
+/* 07B0 */ {REG_MADRS,24,0,0},{REG_MADRS,25,0,0},{REG_MADRS,26,0,0},{REG_MADRS,27,0,0},{REG_MADRS,28,0,0},{REG_MADRS,29,0,0},{REG_MADRS,30,0,0},{REG_MADRS,31,0,0},
+/* 07C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 07D0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 07E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 07F0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0800 */ {REG_MPRO,0,48,0},{REG_MPRO,0,32,0},{REG_MPRO,0,16,0},{REG_MPRO,0,0,0},{REG_MPRO,1,48,0},{REG_MPRO,1,32,0},{REG_MPRO,1,16,0},{REG_MPRO,1,0,0},
+/* 0810 */ {REG_MPRO,2,48,0},{REG_MPRO,2,32,0},{REG_MPRO,2,16,0},{REG_MPRO,2,0,0},{REG_MPRO,3,48,0},{REG_MPRO,3,32,0},{REG_MPRO,3,16,0},{REG_MPRO,3,0,0},
+/* 0820 */ {REG_MPRO,4,48,0},{REG_MPRO,4,32,0},{REG_MPRO,4,16,0},{REG_MPRO,4,0,0},{REG_MPRO,5,48,0},{REG_MPRO,5,32,0},{REG_MPRO,5,16,0},{REG_MPRO,5,0,0},
+/* 0830 */ {REG_MPRO,6,48,0},{REG_MPRO,6,32,0},{REG_MPRO,6,16,0},{REG_MPRO,6,0,0},{REG_MPRO,7,48,0},{REG_MPRO,7,32,0},{REG_MPRO,7,16,0},{REG_MPRO,7,0,0},
+/* 0840 */ {REG_MPRO,8,48,0},{REG_MPRO,8,32,0},{REG_MPRO,8,16,0},{REG_MPRO,8,0,0},{REG_MPRO,9,48,0},{REG_MPRO,9,32,0},{REG_MPRO,9,16,0},{REG_MPRO,9,0,0},
+/* 0850 */ {REG_MPRO,10,48,0},{REG_MPRO,10,32,0},{REG_MPRO,10,16,0},{REG_MPRO,10,0,0},{REG_MPRO,11,48,0},{REG_MPRO,11,32,0},{REG_MPRO,11,16,0},{REG_MPRO,11,0,0},
+/* 0860 */ {REG_MPRO,12,48,0},{REG_MPRO,12,32,0},{REG_MPRO,12,16,0},{REG_MPRO,12,0,0},{REG_MPRO,13,48,0},{REG_MPRO,13,32,0},{REG_MPRO,13,16,0},{REG_MPRO,13,0,0},
+/* 0870 */ {REG_MPRO,14,48,0},{REG_MPRO,14,32,0},{REG_MPRO,14,16,0},{REG_MPRO,14,0,0},{REG_MPRO,15,48,0},{REG_MPRO,15,32,0},{REG_MPRO,15,16,0},{REG_MPRO,15,0,0},
+/* 0880 */ {REG_MPRO,16,48,0},{REG_MPRO,16,32,0},{REG_MPRO,16,16,0},{REG_MPRO,16,0,0},{REG_MPRO,17,48,0},{REG_MPRO,17,32,0},{REG_MPRO,17,16,0},{REG_MPRO,17,0,0},
+/* 0890 */ {REG_MPRO,18,48,0},{REG_MPRO,18,32,0},{REG_MPRO,18,16,0},{REG_MPRO,18,0,0},{REG_MPRO,19,48,0},{REG_MPRO,19,32,0},{REG_MPRO,19,16,0},{REG_MPRO,19,0,0},
+/* 08A0 */ {REG_MPRO,20,48,0},{REG_MPRO,20,32,0},{REG_MPRO,20,16,0},{REG_MPRO,20,0,0},{REG_MPRO,21,48,0},{REG_MPRO,21,32,0},{REG_MPRO,21,16,0},{REG_MPRO,21,0,0},
+/* 08B0 */ {REG_MPRO,22,48,0},{REG_MPRO,22,32,0},{REG_MPRO,22,16,0},{REG_MPRO,22,0,0},{REG_MPRO,23,48,0},{REG_MPRO,23,32,0},{REG_MPRO,23,16,0},{REG_MPRO,23,0,0},
+/* 08C0 */ {REG_MPRO,24,48,0},{REG_MPRO,24,32,0},{REG_MPRO,24,16,0},{REG_MPRO,24,0,0},{REG_MPRO,25,48,0},{REG_MPRO,25,32,0},{REG_MPRO,25,16,0},{REG_MPRO,25,0,0},
+/* 08D0 */ {REG_MPRO,26,48,0},{REG_MPRO,26,32,0},{REG_MPRO,26,16,0},{REG_MPRO,26,0,0},{REG_MPRO,27,48,0},{REG_MPRO,27,32,0},{REG_MPRO,27,16,0},{REG_MPRO,27,0,0},
+/* 08E0 */ {REG_MPRO,28,48,0},{REG_MPRO,28,32,0},{REG_MPRO,28,16,0},{REG_MPRO,28,0,0},{REG_MPRO,29,48,0},{REG_MPRO,29,32,0},{REG_MPRO,29,16,0},{REG_MPRO,29,0,0},
+/* 08F0 */ {REG_MPRO,30,48,0},{REG_MPRO,30,32,0},{REG_MPRO,30,16,0},{REG_MPRO,30,0,0},{REG_MPRO,31,48,0},{REG_MPRO,31,32,0},{REG_MPRO,31,16,0},{REG_MPRO,31,0,0},
+/* 0900 */ {REG_MPRO,32,48,0},{REG_MPRO,32,32,0},{REG_MPRO,32,16,0},{REG_MPRO,32,0,0},{REG_MPRO,33,48,0},{REG_MPRO,33,32,0},{REG_MPRO,33,16,0},{REG_MPRO,33,0,0},
+/* 0910 */ {REG_MPRO,34,48,0},{REG_MPRO,34,32,0},{REG_MPRO,34,16,0},{REG_MPRO,34,0,0},{REG_MPRO,35,48,0},{REG_MPRO,35,32,0},{REG_MPRO,35,16,0},{REG_MPRO,35,0,0},
+/* 0920 */ {REG_MPRO,36,48,0},{REG_MPRO,36,32,0},{REG_MPRO,36,16,0},{REG_MPRO,36,0,0},{REG_MPRO,37,48,0},{REG_MPRO,37,32,0},{REG_MPRO,37,16,0},{REG_MPRO,37,0,0},
+/* 0930 */ {REG_MPRO,38,48,0},{REG_MPRO,38,32,0},{REG_MPRO,38,16,0},{REG_MPRO,38,0,0},{REG_MPRO,39,48,0},{REG_MPRO,39,32,0},{REG_MPRO,39,16,0},{REG_MPRO,39,0,0},
+/* 0940 */ {REG_MPRO,40,48,0},{REG_MPRO,40,32,0},{REG_MPRO,40,16,0},{REG_MPRO,40,0,0},{REG_MPRO,41,48,0},{REG_MPRO,41,32,0},{REG_MPRO,41,16,0},{REG_MPRO,41,0,0},
+/* 0950 */ {REG_MPRO,42,48,0},{REG_MPRO,42,32,0},{REG_MPRO,42,16,0},{REG_MPRO,42,0,0},{REG_MPRO,43,48,0},{REG_MPRO,43,32,0},{REG_MPRO,43,16,0},{REG_MPRO,43,0,0},
+/* 0960 */ {REG_MPRO,44,48,0},{REG_MPRO,44,32,0},{REG_MPRO,44,16,0},{REG_MPRO,44,0,0},{REG_MPRO,45,48,0},{REG_MPRO,45,32,0},{REG_MPRO,45,16,0},{REG_MPRO,45,0,0},
+/* 0970 */ {REG_MPRO,46,48,0},{REG_MPRO,46,32,0},{REG_MPRO,46,16,0},{REG_MPRO,46,0,0},{REG_MPRO,47,48,0},{REG_MPRO,47,32,0},{REG_MPRO,47,16,0},{REG_MPRO,47,0,0},
+/* 0980 */ {REG_MPRO,48,48,0},{REG_MPRO,48,32,0},{REG_MPRO,48,16,0},{REG_MPRO,48,0,0},{REG_MPRO,49,48,0},{REG_MPRO,49,32,0},{REG_MPRO,49,16,0},{REG_MPRO,49,0,0},
+/* 0990 */ {REG_MPRO,50,48,0},{REG_MPRO,50,32,0},{REG_MPRO,50,16,0},{REG_MPRO,50,0,0},{REG_MPRO,51,48,0},{REG_MPRO,51,32,0},{REG_MPRO,51,16,0},{REG_MPRO,51,0,0},
+/* 09A0 */ {REG_MPRO,52,48,0},{REG_MPRO,52,32,0},{REG_MPRO,52,16,0},{REG_MPRO,52,0,0},{REG_MPRO,53,48,0},{REG_MPRO,53,32,0},{REG_MPRO,53,16,0},{REG_MPRO,53,0,0},
+/* 09B0 */ {REG_MPRO,54,48,0},{REG_MPRO,54,32,0},{REG_MPRO,54,16,0},{REG_MPRO,54,0,0},{REG_MPRO,55,48,0},{REG_MPRO,55,32,0},{REG_MPRO,55,16,0},{REG_MPRO,55,0,0},
+/* 09C0 */ {REG_MPRO,56,48,0},{REG_MPRO,56,32,0},{REG_MPRO,56,16,0},{REG_MPRO,56,0,0},{REG_MPRO,57,48,0},{REG_MPRO,57,32,0},{REG_MPRO,57,16,0},{REG_MPRO,57,0,0},
+/* 09D0 */ {REG_MPRO,58,48,0},{REG_MPRO,58,32,0},{REG_MPRO,58,16,0},{REG_MPRO,58,0,0},{REG_MPRO,59,48,0},{REG_MPRO,59,32,0},{REG_MPRO,59,16,0},{REG_MPRO,59,0,0},
+/* 09E0 */ {REG_MPRO,60,48,0},{REG_MPRO,60,32,0},{REG_MPRO,60,16,0},{REG_MPRO,60,0,0},{REG_MPRO,61,48,0},{REG_MPRO,61,32,0},{REG_MPRO,61,16,0},{REG_MPRO,61,0,0},
+/* 09F0 */ {REG_MPRO,62,48,0},{REG_MPRO,62,32,0},{REG_MPRO,62,16,0},{REG_MPRO,62,0,0},{REG_MPRO,63,48,0},{REG_MPRO,63,32,0},{REG_MPRO,63,16,0},{REG_MPRO,63,0,0},
+/* 0A00 */ {REG_MPRO,64,48,0},{REG_MPRO,64,32,0},{REG_MPRO,64,16,0},{REG_MPRO,64,0,0},{REG_MPRO,65,48,0},{REG_MPRO,65,32,0},{REG_MPRO,65,16,0},{REG_MPRO,65,0,0},
+/* 0A10 */ {REG_MPRO,66,48,0},{REG_MPRO,66,32,0},{REG_MPRO,66,16,0},{REG_MPRO,66,0,0},{REG_MPRO,67,48,0},{REG_MPRO,67,32,0},{REG_MPRO,67,16,0},{REG_MPRO,67,0,0},
+/* 0A20 */ {REG_MPRO,68,48,0},{REG_MPRO,68,32,0},{REG_MPRO,68,16,0},{REG_MPRO,68,0,0},{REG_MPRO,69,48,0},{REG_MPRO,69,32,0},{REG_MPRO,69,16,0},{REG_MPRO,69,0,0},
+/* 0A30 */ {REG_MPRO,70,48,0},{REG_MPRO,70,32,0},{REG_MPRO,70,16,0},{REG_MPRO,70,0,0},{REG_MPRO,71,48,0},{REG_MPRO,71,32,0},{REG_MPRO,71,16,0},{REG_MPRO,71,0,0},
+/* 0A40 */ {REG_MPRO,72,48,0},{REG_MPRO,72,32,0},{REG_MPRO,72,16,0},{REG_MPRO,72,0,0},{REG_MPRO,73,48,0},{REG_MPRO,73,32,0},{REG_MPRO,73,16,0},{REG_MPRO,73,0,0},
+/* 0A50 */ {REG_MPRO,74,48,0},{REG_MPRO,74,32,0},{REG_MPRO,74,16,0},{REG_MPRO,74,0,0},{REG_MPRO,75,48,0},{REG_MPRO,75,32,0},{REG_MPRO,75,16,0},{REG_MPRO,75,0,0},
+/* 0A60 */ {REG_MPRO,76,48,0},{REG_MPRO,76,32,0},{REG_MPRO,76,16,0},{REG_MPRO,76,0,0},{REG_MPRO,77,48,0},{REG_MPRO,77,32,0},{REG_MPRO,77,16,0},{REG_MPRO,77,0,0},
+/* 0A70 */ {REG_MPRO,78,48,0},{REG_MPRO,78,32,0},{REG_MPRO,78,16,0},{REG_MPRO,78,0,0},{REG_MPRO,79,48,0},{REG_MPRO,79,32,0},{REG_MPRO,79,16,0},{REG_MPRO,79,0,0},
+/* 0A80 */ {REG_MPRO,80,48,0},{REG_MPRO,80,32,0},{REG_MPRO,80,16,0},{REG_MPRO,80,0,0},{REG_MPRO,81,48,0},{REG_MPRO,81,32,0},{REG_MPRO,81,16,0},{REG_MPRO,81,0,0},
+/* 0A90 */ {REG_MPRO,82,48,0},{REG_MPRO,82,32,0},{REG_MPRO,82,16,0},{REG_MPRO,82,0,0},{REG_MPRO,83,48,0},{REG_MPRO,83,32,0},{REG_MPRO,83,16,0},{REG_MPRO,83,0,0},
+/* 0AA0 */ {REG_MPRO,84,48,0},{REG_MPRO,84,32,0},{REG_MPRO,84,16,0},{REG_MPRO,84,0,0},{REG_MPRO,85,48,0},{REG_MPRO,85,32,0},{REG_MPRO,85,16,0},{REG_MPRO,85,0,0},
+/* 0AB0 */ {REG_MPRO,86,48,0},{REG_MPRO,86,32,0},{REG_MPRO,86,16,0},{REG_MPRO,86,0,0},{REG_MPRO,87,48,0},{REG_MPRO,87,32,0},{REG_MPRO,87,16,0},{REG_MPRO,87,0,0},
+/* 0AC0 */ {REG_MPRO,88,48,0},{REG_MPRO,88,32,0},{REG_MPRO,88,16,0},{REG_MPRO,88,0,0},{REG_MPRO,89,48,0},{REG_MPRO,89,32,0},{REG_MPRO,89,16,0},{REG_MPRO,89,0,0},
+/* 0AD0 */ {REG_MPRO,90,48,0},{REG_MPRO,90,32,0},{REG_MPRO,90,16,0},{REG_MPRO,90,0,0},{REG_MPRO,91,48,0},{REG_MPRO,91,32,0},{REG_MPRO,91,16,0},{REG_MPRO,91,0,0},
+/* 0AE0 */ {REG_MPRO,92,48,0},{REG_MPRO,92,32,0},{REG_MPRO,92,16,0},{REG_MPRO,92,0,0},{REG_MPRO,93,48,0},{REG_MPRO,93,32,0},{REG_MPRO,93,16,0},{REG_MPRO,93,0,0},
+/* 0AF0 */ {REG_MPRO,94,48,0},{REG_MPRO,94,32,0},{REG_MPRO,94,16,0},{REG_MPRO,94,0,0},{REG_MPRO,95,48,0},{REG_MPRO,95,32,0},{REG_MPRO,95,16,0},{REG_MPRO,95,0,0},
+/* 0B00 */ {REG_MPRO,96,48,0},{REG_MPRO,96,32,0},{REG_MPRO,96,16,0},{REG_MPRO,96,0,0},{REG_MPRO,97,48,0},{REG_MPRO,97,32,0},{REG_MPRO,97,16,0},{REG_MPRO,97,0,0},
+/* 0B10 */ {REG_MPRO,98,48,0},{REG_MPRO,98,32,0},{REG_MPRO,98,16,0},{REG_MPRO,98,0,0},{REG_MPRO,99,48,0},{REG_MPRO,99,32,0},{REG_MPRO,99,16,0},{REG_MPRO,99,0,0},
+/* 0B20 */ {REG_MPRO,100,48,0},{REG_MPRO,100,32,0},{REG_MPRO,100,16,0},{REG_MPRO,100,0,0},{REG_MPRO,101,48,0},{REG_MPRO,101,32,0},{REG_MPRO,101,16,0},{REG_MPRO,101,0,0},
+/* 0B30 */ {REG_MPRO,102,48,0},{REG_MPRO,102,32,0},{REG_MPRO,102,16,0},{REG_MPRO,102,0,0},{REG_MPRO,103,48,0},{REG_MPRO,103,32,0},{REG_MPRO,103,16,0},{REG_MPRO,103,0,0},
+/* 0B40 */ {REG_MPRO,104,48,0},{REG_MPRO,104,32,0},{REG_MPRO,104,16,0},{REG_MPRO,104,0,0},{REG_MPRO,105,48,0},{REG_MPRO,105,32,0},{REG_MPRO,105,16,0},{REG_MPRO,105,0,0},
+/* 0B50 */ {REG_MPRO,106,48,0},{REG_MPRO,106,32,0},{REG_MPRO,106,16,0},{REG_MPRO,106,0,0},{REG_MPRO,107,48,0},{REG_MPRO,107,32,0},{REG_MPRO,107,16,0},{REG_MPRO,107,0,0},
+/* 0B60 */ {REG_MPRO,108,48,0},{REG_MPRO,108,32,0},{REG_MPRO,108,16,0},{REG_MPRO,108,0,0},{REG_MPRO,109,48,0},{REG_MPRO,109,32,0},{REG_MPRO,109,16,0},{REG_MPRO,109,0,0},
+/* 0B70 */ {REG_MPRO,110,48,0},{REG_MPRO,110,32,0},{REG_MPRO,110,16,0},{REG_MPRO,110,0,0},{REG_MPRO,111,48,0},{REG_MPRO,111,32,0},{REG_MPRO,111,16,0},{REG_MPRO,111,0,0},
+/* 0B80 */ {REG_MPRO,112,48,0},{REG_MPRO,112,32,0},{REG_MPRO,112,16,0},{REG_MPRO,112,0,0},{REG_MPRO,113,48,0},{REG_MPRO,113,32,0},{REG_MPRO,113,16,0},{REG_MPRO,113,0,0},
+/* 0B90 */ {REG_MPRO,114,48,0},{REG_MPRO,114,32,0},{REG_MPRO,114,16,0},{REG_MPRO,114,0,0},{REG_MPRO,115,48,0},{REG_MPRO,115,32,0},{REG_MPRO,115,16,0},{REG_MPRO,115,0,0},
+/* 0BA0 */ {REG_MPRO,116,48,0},{REG_MPRO,116,32,0},{REG_MPRO,116,16,0},{REG_MPRO,116,0,0},{REG_MPRO,117,48,0},{REG_MPRO,117,32,0},{REG_MPRO,117,16,0},{REG_MPRO,117,0,0},
+/* 0BB0 */ {REG_MPRO,118,48,0},{REG_MPRO,118,32,0},{REG_MPRO,118,16,0},{REG_MPRO,118,0,0},{REG_MPRO,119,48,0},{REG_MPRO,119,32,0},{REG_MPRO,119,16,0},{REG_MPRO,119,0,0},
+/* 0BC0 */ {REG_MPRO,120,48,0},{REG_MPRO,120,32,0},{REG_MPRO,120,16,0},{REG_MPRO,120,0,0},{REG_MPRO,121,48,0},{REG_MPRO,121,32,0},{REG_MPRO,121,16,0},{REG_MPRO,121,0,0},
+/* 0BD0 */ {REG_MPRO,122,48,0},{REG_MPRO,122,32,0},{REG_MPRO,122,16,0},{REG_MPRO,122,0,0},{REG_MPRO,123,48,0},{REG_MPRO,123,32,0},{REG_MPRO,123,16,0},{REG_MPRO,123,0,0},
+/* 0BE0 */ {REG_MPRO,124,48,0},{REG_MPRO,124,32,0},{REG_MPRO,124,16,0},{REG_MPRO,124,0,0},{REG_MPRO,125,48,0},{REG_MPRO,125,32,0},{REG_MPRO,125,16,0},{REG_MPRO,125,0,0},
+/* 0BF0 */ {REG_MPRO,126,48,0},{REG_MPRO,126,32,0},{REG_MPRO,126,16,0},{REG_MPRO,126,0,0},{REG_MPRO,127,48,0},{REG_MPRO,127,32,0},{REG_MPRO,127,16,0},{REG_MPRO,127,0,0},
+/* 0C00 */ {REG_TEMP,0,0,0},{REG_TEMP,1,0,0},{REG_TEMP,2,0,0},{REG_TEMP,3,0,0},{REG_TEMP,4,0,0},{REG_TEMP,5,0,0},{REG_TEMP,6,0,0},{REG_TEMP,7,0,0},
+/* 0C10 */ {REG_TEMP,8,0,0},{REG_TEMP,9,0,0},{REG_TEMP,10,0,0},{REG_TEMP,11,0,0},{REG_TEMP,12,0,0},{REG_TEMP,13,0,0},{REG_TEMP,14,0,0},{REG_TEMP,15,0,0},
+/* 0C20 */ {REG_TEMP,16,0,0},{REG_TEMP,17,0,0},{REG_TEMP,18,0,0},{REG_TEMP,19,0,0},{REG_TEMP,20,0,0},{REG_TEMP,21,0,0},{REG_TEMP,22,0,0},{REG_TEMP,23,0,0},
+/* 0C30 */ {REG_TEMP,24,0,0},{REG_TEMP,25,0,0},{REG_TEMP,26,0,0},{REG_TEMP,27,0,0},{REG_TEMP,28,0,0},{REG_TEMP,29,0,0},{REG_TEMP,30,0,0},{REG_TEMP,31,0,0},
+/* 0C40 */ {REG_TEMP,32,0,0},{REG_TEMP,33,0,0},{REG_TEMP,34,0,0},{REG_TEMP,35,0,0},{REG_TEMP,36,0,0},{REG_TEMP,37,0,0},{REG_TEMP,38,0,0},{REG_TEMP,39,0,0},
+/* 0C50 */ {REG_TEMP,40,0,0},{REG_TEMP,41,0,0},{REG_TEMP,42,0,0},{REG_TEMP,43,0,0},{REG_TEMP,44,0,0},{REG_TEMP,45,0,0},{REG_TEMP,46,0,0},{REG_TEMP,47,0,0},
+/* 0C60 */ {REG_TEMP,48,0,0},{REG_TEMP,49,0,0},{REG_TEMP,50,0,0},{REG_TEMP,51,0,0},{REG_TEMP,52,0,0},{REG_TEMP,53,0,0},{REG_TEMP,54,0,0},{REG_TEMP,55,0,0},
+/* 0C70 */ {REG_TEMP,56,0,0},{REG_TEMP,57,0,0},{REG_TEMP,58,0,0},{REG_TEMP,59,0,0},{REG_TEMP,60,0,0},{REG_TEMP,61,0,0},{REG_TEMP,62,0,0},{REG_TEMP,63,0,0},
+/* 0C80 */ {REG_TEMP,64,0,0},{REG_TEMP,65,0,0},{REG_TEMP,66,0,0},{REG_TEMP,67,0,0},{REG_TEMP,68,0,0},{REG_TEMP,69,0,0},{REG_TEMP,70,0,0},{REG_TEMP,71,0,0},
+/* 0C90 */ {REG_TEMP,72,0,0},{REG_TEMP,73,0,0},{REG_TEMP,74,0,0},{REG_TEMP,75,0,0},{REG_TEMP,76,0,0},{REG_TEMP,77,0,0},{REG_TEMP,78,0,0},{REG_TEMP,79,0,0},
+/* 0CA0 */ {REG_TEMP,80,0,0},{REG_TEMP,81,0,0},{REG_TEMP,82,0,0},{REG_TEMP,83,0,0},{REG_TEMP,84,0,0},{REG_TEMP,85,0,0},{REG_TEMP,86,0,0},{REG_TEMP,87,0,0},
+/* 0CB0 */ {REG_TEMP,88,0,0},{REG_TEMP,89,0,0},{REG_TEMP,90,0,0},{REG_TEMP,91,0,0},{REG_TEMP,92,0,0},{REG_TEMP,93,0,0},{REG_TEMP,94,0,0},{REG_TEMP,95,0,0},
+/* 0CC0 */ {REG_TEMP,96,0,0},{REG_TEMP,97,0,0},{REG_TEMP,98,0,0},{REG_TEMP,99,0,0},{REG_TEMP,100,0,0},{REG_TEMP,101,0,0},{REG_TEMP,102,0,0},{REG_TEMP,103,0,0},
+/* 0CD0 */ {REG_TEMP,104,0,0},{REG_TEMP,105,0,0},{REG_TEMP,106,0,0},{REG_TEMP,107,0,0},{REG_TEMP,108,0,0},{REG_TEMP,109,0,0},{REG_TEMP,110,0,0},{REG_TEMP,111,0,0},
+/* 0CE0 */ {REG_TEMP,112,0,0},{REG_TEMP,113,0,0},{REG_TEMP,114,0,0},{REG_TEMP,115,0,0},{REG_TEMP,116,0,0},{REG_TEMP,117,0,0},{REG_TEMP,118,0,0},{REG_TEMP,119,0,0},
+/* 0CF0 */ {REG_TEMP,120,0,0},{REG_TEMP,121,0,0},{REG_TEMP,122,0,0},{REG_TEMP,123,0,0},{REG_TEMP,124,0,0},{REG_TEMP,125,0,0},{REG_TEMP,126,0,0},{REG_TEMP,127,0,0},
+/* 0D00 */ {REG_TEMP,128,0,0},{REG_TEMP,129,0,0},{REG_TEMP,130,0,0},{REG_TEMP,131,0,0},{REG_TEMP,132,0,0},{REG_TEMP,133,0,0},{REG_TEMP,134,0,0},{REG_TEMP,135,0,0},
+/* 0D10 */ {REG_TEMP,136,0,0},{REG_TEMP,137,0,0},{REG_TEMP,138,0,0},{REG_TEMP,139,0,0},{REG_TEMP,140,0,0},{REG_TEMP,141,0,0},{REG_TEMP,142,0,0},{REG_TEMP,143,0,0},
+/* 0D20 */ {REG_TEMP,144,0,0},{REG_TEMP,145,0,0},{REG_TEMP,146,0,0},{REG_TEMP,147,0,0},{REG_TEMP,148,0,0},{REG_TEMP,149,0,0},{REG_TEMP,150,0,0},{REG_TEMP,151,0,0},
+/* 0D30 */ {REG_TEMP,152,0,0},{REG_TEMP,153,0,0},{REG_TEMP,154,0,0},{REG_TEMP,155,0,0},{REG_TEMP,156,0,0},{REG_TEMP,157,0,0},{REG_TEMP,158,0,0},{REG_TEMP,159,0,0},
+/* 0D40 */ {REG_TEMP,160,0,0},{REG_TEMP,161,0,0},{REG_TEMP,162,0,0},{REG_TEMP,163,0,0},{REG_TEMP,164,0,0},{REG_TEMP,165,0,0},{REG_TEMP,166,0,0},{REG_TEMP,167,0,0},
+/* 0D50 */ {REG_TEMP,168,0,0},{REG_TEMP,169,0,0},{REG_TEMP,170,0,0},{REG_TEMP,171,0,0},{REG_TEMP,172,0,0},{REG_TEMP,173,0,0},{REG_TEMP,174,0,0},{REG_TEMP,175,0,0},
+/* 0D60 */ {REG_TEMP,176,0,0},{REG_TEMP,177,0,0},{REG_TEMP,178,0,0},{REG_TEMP,179,0,0},{REG_TEMP,180,0,0},{REG_TEMP,181,0,0},{REG_TEMP,182,0,0},{REG_TEMP,183,0,0},
+/* 0D70 */ {REG_TEMP,184,0,0},{REG_TEMP,185,0,0},{REG_TEMP,186,0,0},{REG_TEMP,187,0,0},{REG_TEMP,188,0,0},{REG_TEMP,189,0,0},{REG_TEMP,190,0,0},{REG_TEMP,191,0,0},
+/* 0D80 */ {REG_TEMP,192,0,0},{REG_TEMP,193,0,0},{REG_TEMP,194,0,0},{REG_TEMP,195,0,0},{REG_TEMP,196,0,0},{REG_TEMP,197,0,0},{REG_TEMP,198,0,0},{REG_TEMP,199,0,0},
+/* 0D90 */ {REG_TEMP,200,0,0},{REG_TEMP,201,0,0},{REG_TEMP,202,0,0},{REG_TEMP,203,0,0},{REG_TEMP,204,0,0},{REG_TEMP,205,0,0},{REG_TEMP,206,0,0},{REG_TEMP,207,0,0},
+/* 0DA0 */ {REG_TEMP,208,0,0},{REG_TEMP,209,0,0},{REG_TEMP,210,0,0},{REG_TEMP,211,0,0},{REG_TEMP,212,0,0},{REG_TEMP,213,0,0},{REG_TEMP,214,0,0},{REG_TEMP,215,0,0},
+/* 0DB0 */ {REG_TEMP,216,0,0},{REG_TEMP,217,0,0},{REG_TEMP,218,0,0},{REG_TEMP,219,0,0},{REG_TEMP,220,0,0},{REG_TEMP,221,0,0},{REG_TEMP,222,0,0},{REG_TEMP,223,0,0},
+/* 0DC0 */ {REG_TEMP,224,0,0},{REG_TEMP,225,0,0},{REG_TEMP,226,0,0},{REG_TEMP,227,0,0},{REG_TEMP,228,0,0},{REG_TEMP,229,0,0},{REG_TEMP,230,0,0},{REG_TEMP,231,0,0},
+/* 0DD0 */ {REG_TEMP,232,0,0},{REG_TEMP,233,0,0},{REG_TEMP,234,0,0},{REG_TEMP,235,0,0},{REG_TEMP,236,0,0},{REG_TEMP,237,0,0},{REG_TEMP,238,0,0},{REG_TEMP,239,0,0},
+/* 0DE0 */ {REG_TEMP,240,0,0},{REG_TEMP,241,0,0},{REG_TEMP,242,0,0},{REG_TEMP,243,0,0},{REG_TEMP,244,0,0},{REG_TEMP,245,0,0},{REG_TEMP,246,0,0},{REG_TEMP,247,0,0},
+/* 0DF0 */ {REG_TEMP,248,0,0},{REG_TEMP,249,0,0},{REG_TEMP,250,0,0},{REG_TEMP,251,0,0},{REG_TEMP,252,0,0},{REG_TEMP,253,0,0},{REG_TEMP,254,0,0},{REG_TEMP,255,0,0},
+/* 0E00 */ {REG_MEMS,0,0,0},{REG_MEMS,1,0,0},{REG_MEMS,2,0,0},{REG_MEMS,3,0,0},{REG_MEMS,4,0,0},{REG_MEMS,5,0,0},{REG_MEMS,6,0,0},{REG_MEMS,7,0,0},
+/* 0E10 */ {REG_MEMS,8,0,0},{REG_MEMS,9,0,0},{REG_MEMS,10,0,0},{REG_MEMS,11,0,0},{REG_MEMS,12,0,0},{REG_MEMS,13,0,0},{REG_MEMS,14,0,0},{REG_MEMS,15,0,0},
+/* 0E20 */ {REG_MEMS,16,0,0},{REG_MEMS,17,0,0},{REG_MEMS,18,0,0},{REG_MEMS,19,0,0},{REG_MEMS,20,0,0},{REG_MEMS,21,0,0},{REG_MEMS,22,0,0},{REG_MEMS,23,0,0},
+/* 0E30 */ {REG_MEMS,24,0,0},{REG_MEMS,25,0,0},{REG_MEMS,26,0,0},{REG_MEMS,27,0,0},{REG_MEMS,28,0,0},{REG_MEMS,29,0,0},{REG_MEMS,30,0,0},{REG_MEMS,31,0,0},
+/* 0E40 */ {REG_MEMS,32,0,0},{REG_MEMS,33,0,0},{REG_MEMS,34,0,0},{REG_MEMS,35,0,0},{REG_MEMS,36,0,0},{REG_MEMS,37,0,0},{REG_MEMS,38,0,0},{REG_MEMS,39,0,0},
+/* 0E50 */ {REG_MEMS,40,0,0},{REG_MEMS,41,0,0},{REG_MEMS,42,0,0},{REG_MEMS,43,0,0},{REG_MEMS,44,0,0},{REG_MEMS,45,0,0},{REG_MEMS,46,0,0},{REG_MEMS,47,0,0},
+/* 0E60 */ {REG_MEMS,48,0,0},{REG_MEMS,49,0,0},{REG_MEMS,50,0,0},{REG_MEMS,51,0,0},{REG_MEMS,52,0,0},{REG_MEMS,53,0,0},{REG_MEMS,54,0,0},{REG_MEMS,55,0,0},
+/* 0E70 */ {REG_MEMS,56,0,0},{REG_MEMS,57,0,0},{REG_MEMS,58,0,0},{REG_MEMS,59,0,0},{REG_MEMS,60,0,0},{REG_MEMS,61,0,0},{REG_MEMS,62,0,0},{REG_MEMS,63,0,0},
+/* 0E80 */ {REG_MIXS,0,0,0},{REG_MIXS,1,0,0},{REG_MIXS,2,0,0},{REG_MIXS,3,0,0},{REG_MIXS,4,0,0},{REG_MIXS,5,0,0},{REG_MIXS,6,0,0},{REG_MIXS,7,0,0},
+/* 0E90 */ {REG_MIXS,8,0,0},{REG_MIXS,9,0,0},{REG_MIXS,10,0,0},{REG_MIXS,11,0,0},{REG_MIXS,12,0,0},{REG_MIXS,13,0,0},{REG_MIXS,14,0,0},{REG_MIXS,15,0,0},
+/* 0EA0 */ {REG_MIXS,16,0,0},{REG_MIXS,17,0,0},{REG_MIXS,18,0,0},{REG_MIXS,19,0,0},{REG_MIXS,20,0,0},{REG_MIXS,21,0,0},{REG_MIXS,22,0,0},{REG_MIXS,23,0,0},
+/* 0EB0 */ {REG_MIXS,24,0,0},{REG_MIXS,25,0,0},{REG_MIXS,26,0,0},{REG_MIXS,27,0,0},{REG_MIXS,28,0,0},{REG_MIXS,29,0,0},{REG_MIXS,30,0,0},{REG_MIXS,31,0,0},
+/* 0EC0 */ {REG_EFREG,0,0,0},{REG_EFREG,1,0,0},{REG_EFREG,2,0,0},{REG_EFREG,3,0,0},{REG_EFREG,4,0,0},{REG_EFREG,5,0,0},{REG_EFREG,6,0,0},{REG_EFREG,7,0,0},
+/* 0ED0 */ {REG_EFREG,8,0,0},{REG_EFREG,9,0,0},{REG_EFREG,10,0,0},{REG_EFREG,11,0,0},{REG_EFREG,12,0,0},{REG_EFREG,13,0,0},{REG_EFREG,14,0,0},{REG_EFREG,15,0,0},
+/* 0EE0 */ {REG_EXTS,0,0,0},{REG_EXTS,1,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0EF0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F10 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F30 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F50 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F70 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F90 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FB0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FD0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FF0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0}
+};
+
+static const struct YAM_REGDECODE aica_regdecode[0x10000 / 4] = {
+/* 0000 */ {REG_CHAN,0,0,0},{REG_CHAN,0,4,0},{REG_CHAN,0,8,0},{REG_CHAN,0,12,0},{REG_CHAN,0,16,0},{REG_CHAN,0,20,0},{REG_CHAN,0,24,0},{REG_CHAN,0,28,0},
+/* 0020 */ {REG_CHAN,0,32,0},{REG_CHAN,0,36,0},{REG_CHAN,0,40,0},{REG_CHAN,0,44,0},{REG_CHAN,0,48,0},{REG_CHAN,0,52,0},{REG_CHAN,0,56,0},{REG_CHAN,0,60,0},
+/* 0040 */ {REG_CHAN,0,64,0},{REG_CHAN,0,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0080 */ {REG_CHAN,1,0,0},{REG_CHAN,1,4,0},{REG_CHAN,1,8,0},{REG_CHAN,1,12,0},{REG_CHAN,1,16,0},{REG_CHAN,1,20,0},{REG_CHAN,1,24,0},{REG_CHAN,1,28,0},
+/* 00A0 */ {REG_CHAN,1,32,0},{REG_CHAN,1,36,0},{REG_CHAN,1,40,0},{REG_CHAN,1,44,0},{REG_CHAN,1,48,0},{REG_CHAN,1,52,0},{REG_CHAN,1,56,0},{REG_CHAN,1,60,0},
+/* 00C0 */ {REG_CHAN,1,64,0},{REG_CHAN,1,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 00E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0100 */ {REG_CHAN,2,0,0},{REG_CHAN,2,4,0},{REG_CHAN,2,8,0},{REG_CHAN,2,12,0},{REG_CHAN,2,16,0},{REG_CHAN,2,20,0},{REG_CHAN,2,24,0},{REG_CHAN,2,28,0},
+/* 0120 */ {REG_CHAN,2,32,0},{REG_CHAN,2,36,0},{REG_CHAN,2,40,0},{REG_CHAN,2,44,0},{REG_CHAN,2,48,0},{REG_CHAN,2,52,0},{REG_CHAN,2,56,0},{REG_CHAN,2,60,0},
+/* 0140 */ {REG_CHAN,2,64,0},{REG_CHAN,2,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0180 */ {REG_CHAN,3,0,0},{REG_CHAN,3,4,0},{REG_CHAN,3,8,0},{REG_CHAN,3,12,0},{REG_CHAN,3,16,0},{REG_CHAN,3,20,0},{REG_CHAN,3,24,0},{REG_CHAN,3,28,0},
+/* 01A0 */ {REG_CHAN,3,32,0},{REG_CHAN,3,36,0},{REG_CHAN,3,40,0},{REG_CHAN,3,44,0},{REG_CHAN,3,48,0},{REG_CHAN,3,52,0},{REG_CHAN,3,56,0},{REG_CHAN,3,60,0},
+/* 01C0 */ {REG_CHAN,3,64,0},{REG_CHAN,3,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 01E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0200 */ {REG_CHAN,4,0,0},{REG_CHAN,4,4,0},{REG_CHAN,4,8,0},{REG_CHAN,4,12,0},{REG_CHAN,4,16,0},{REG_CHAN,4,20,0},{REG_CHAN,4,24,0},{REG_CHAN,4,28,0},
+/* 0220 */ {REG_CHAN,4,32,0},{REG_CHAN,4,36,0},{REG_CHAN,4,40,0},{REG_CHAN,4,44,0},{REG_CHAN,4,48,0},{REG_CHAN,4,52,0},{REG_CHAN,4,56,0},{REG_CHAN,4,60,0},
+/* 0240 */ {REG_CHAN,4,64,0},{REG_CHAN,4,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0280 */ {REG_CHAN,5,0,0},{REG_CHAN,5,4,0},{REG_CHAN,5,8,0},{REG_CHAN,5,12,0},{REG_CHAN,5,16,0},{REG_CHAN,5,20,0},{REG_CHAN,5,24,0},{REG_CHAN,5,28,0},
+/* 02A0 */ {REG_CHAN,5,32,0},{REG_CHAN,5,36,0},{REG_CHAN,5,40,0},{REG_CHAN,5,44,0},{REG_CHAN,5,48,0},{REG_CHAN,5,52,0},{REG_CHAN,5,56,0},{REG_CHAN,5,60,0},
+/* 02C0 */ {REG_CHAN,5,64,0},{REG_CHAN,5,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 02E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0300 */ {REG_CHAN,6,0,0},{REG_CHAN,6,4,0},{REG_CHAN,6,8,0},{REG_CHAN,6,12,0},{REG_CHAN,6,16,0},{REG_CHAN,6,20,0},{REG_CHAN,6,24,0},{REG_CHAN,6,28,0},
+/* 0320 */ {REG_CHAN,6,32,0},{REG_CHAN,6,36,0},{REG_CHAN,6,40,0},{REG_CHAN,6,44,0},{REG_CHAN,6,48,0},{REG_CHAN,6,52,0},{REG_CHAN,6,56,0},{REG_CHAN,6,60,0},
+/* 0340 */ {REG_CHAN,6,64,0},{REG_CHAN,6,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0380 */ {REG_CHAN,7,0,0},{REG_CHAN,7,4,0},{REG_CHAN,7,8,0},{REG_CHAN,7,12,0},{REG_CHAN,7,16,0},{REG_CHAN,7,20,0},{REG_CHAN,7,24,0},{REG_CHAN,7,28,0},
+/* 03A0 */ {REG_CHAN,7,32,0},{REG_CHAN,7,36,0},{REG_CHAN,7,40,0},{REG_CHAN,7,44,0},{REG_CHAN,7,48,0},{REG_CHAN,7,52,0},{REG_CHAN,7,56,0},{REG_CHAN,7,60,0},
+/* 03C0 */ {REG_CHAN,7,64,0},{REG_CHAN,7,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 03E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0400 */ {REG_CHAN,8,0,0},{REG_CHAN,8,4,0},{REG_CHAN,8,8,0},{REG_CHAN,8,12,0},{REG_CHAN,8,16,0},{REG_CHAN,8,20,0},{REG_CHAN,8,24,0},{REG_CHAN,8,28,0},
+/* 0420 */ {REG_CHAN,8,32,0},{REG_CHAN,8,36,0},{REG_CHAN,8,40,0},{REG_CHAN,8,44,0},{REG_CHAN,8,48,0},{REG_CHAN,8,52,0},{REG_CHAN,8,56,0},{REG_CHAN,8,60,0},
+/* 0440 */ {REG_CHAN,8,64,0},{REG_CHAN,8,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0480 */ {REG_CHAN,9,0,0},{REG_CHAN,9,4,0},{REG_CHAN,9,8,0},{REG_CHAN,9,12,0},{REG_CHAN,9,16,0},{REG_CHAN,9,20,0},{REG_CHAN,9,24,0},{REG_CHAN,9,28,0},
+/* 04A0 */ {REG_CHAN,9,32,0},{REG_CHAN,9,36,0},{REG_CHAN,9,40,0},{REG_CHAN,9,44,0},{REG_CHAN,9,48,0},{REG_CHAN,9,52,0},{REG_CHAN,9,56,0},{REG_CHAN,9,60,0},
+/* 04C0 */ {REG_CHAN,9,64,0},{REG_CHAN,9,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 04E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0500 */ {REG_CHAN,10,0,0},{REG_CHAN,10,4,0},{REG_CHAN,10,8,0},{REG_CHAN,10,12,0},{REG_CHAN,10,16,0},{REG_CHAN,10,20,0},{REG_CHAN,10,24,0},{REG_CHAN,10,28,0},
+/* 0520 */ {REG_CHAN,10,32,0},{REG_CHAN,10,36,0},{REG_CHAN,10,40,0},{REG_CHAN,10,44,0},{REG_CHAN,10,48,0},{REG_CHAN,10,52,0},{REG_CHAN,10,56,0},{REG_CHAN,10,60,0},
+/* 0540 */ {REG_CHAN,10,64,0},{REG_CHAN,10,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0580 */ {REG_CHAN,11,0,0},{REG_CHAN,11,4,0},{REG_CHAN,11,8,0},{REG_CHAN,11,12,0},{REG_CHAN,11,16,0},{REG_CHAN,11,20,0},{REG_CHAN,11,24,0},{REG_CHAN,11,28,0},
+/* 05A0 */ {REG_CHAN,11,32,0},{REG_CHAN,11,36,0},{REG_CHAN,11,40,0},{REG_CHAN,11,44,0},{REG_CHAN,11,48,0},{REG_CHAN,11,52,0},{REG_CHAN,11,56,0},{REG_CHAN,11,60,0},
+/* 05C0 */ {REG_CHAN,11,64,0},{REG_CHAN,11,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 05E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0600 */ {REG_CHAN,12,0,0},{REG_CHAN,12,4,0},{REG_CHAN,12,8,0},{REG_CHAN,12,12,0},{REG_CHAN,12,16,0},{REG_CHAN,12,20,0},{REG_CHAN,12,24,0},{REG_CHAN,12,28,0},
+/* 0620 */ {REG_CHAN,12,32,0},{REG_CHAN,12,36,0},{REG_CHAN,12,40,0},{REG_CHAN,12,44,0},{REG_CHAN,12,48,0},{REG_CHAN,12,52,0},{REG_CHAN,12,56,0},{REG_CHAN,12,60,0},
+/* 0640 */ {REG_CHAN,12,64,0},{REG_CHAN,12,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0680 */ {REG_CHAN,13,0,0},{REG_CHAN,13,4,0},{REG_CHAN,13,8,0},{REG_CHAN,13,12,0},{REG_CHAN,13,16,0},{REG_CHAN,13,20,0},{REG_CHAN,13,24,0},{REG_CHAN,13,28,0},
+/* 06A0 */ {REG_CHAN,13,32,0},{REG_CHAN,13,36,0},{REG_CHAN,13,40,0},{REG_CHAN,13,44,0},{REG_CHAN,13,48,0},{REG_CHAN,13,52,0},{REG_CHAN,13,56,0},{REG_CHAN,13,60,0},
+/* 06C0 */ {REG_CHAN,13,64,0},{REG_CHAN,13,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 06E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0700 */ {REG_CHAN,14,0,0},{REG_CHAN,14,4,0},{REG_CHAN,14,8,0},{REG_CHAN,14,12,0},{REG_CHAN,14,16,0},{REG_CHAN,14,20,0},{REG_CHAN,14,24,0},{REG_CHAN,14,28,0},
+/* 0720 */ {REG_CHAN,14,32,0},{REG_CHAN,14,36,0},{REG_CHAN,14,40,0},{REG_CHAN,14,44,0},{REG_CHAN,14,48,0},{REG_CHAN,14,52,0},{REG_CHAN,14,56,0},{REG_CHAN,14,60,0},
+/* 0740 */ {REG_CHAN,14,64,0},{REG_CHAN,14,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0780 */ {REG_CHAN,15,0,0},{REG_CHAN,15,4,0},{REG_CHAN,15,8,0},{REG_CHAN,15,12,0},{REG_CHAN,15,16,0},{REG_CHAN,15,20,0},{REG_CHAN,15,24,0},{REG_CHAN,15,28,0},
+/* 07A0 */ {REG_CHAN,15,32,0},{REG_CHAN,15,36,0},{REG_CHAN,15,40,0},{REG_CHAN,15,44,0},{REG_CHAN,15,48,0},{REG_CHAN,15,52,0},{REG_CHAN,15,56,0},{REG_CHAN,15,60,0},
+/* 07C0 */ {REG_CHAN,15,64,0},{REG_CHAN,15,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 07E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0800 */ {REG_CHAN,16,0,0},{REG_CHAN,16,4,0},{REG_CHAN,16,8,0},{REG_CHAN,16,12,0},{REG_CHAN,16,16,0},{REG_CHAN,16,20,0},{REG_CHAN,16,24,0},{REG_CHAN,16,28,0},
+/* 0820 */ {REG_CHAN,16,32,0},{REG_CHAN,16,36,0},{REG_CHAN,16,40,0},{REG_CHAN,16,44,0},{REG_CHAN,16,48,0},{REG_CHAN,16,52,0},{REG_CHAN,16,56,0},{REG_CHAN,16,60,0},
+/* 0840 */ {REG_CHAN,16,64,0},{REG_CHAN,16,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0880 */ {REG_CHAN,17,0,0},{REG_CHAN,17,4,0},{REG_CHAN,17,8,0},{REG_CHAN,17,12,0},{REG_CHAN,17,16,0},{REG_CHAN,17,20,0},{REG_CHAN,17,24,0},{REG_CHAN,17,28,0},
+/* 08A0 */ {REG_CHAN,17,32,0},{REG_CHAN,17,36,0},{REG_CHAN,17,40,0},{REG_CHAN,17,44,0},{REG_CHAN,17,48,0},{REG_CHAN,17,52,0},{REG_CHAN,17,56,0},{REG_CHAN,17,60,0},
+/* 08C0 */ {REG_CHAN,17,64,0},{REG_CHAN,17,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 08E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0900 */ {REG_CHAN,18,0,0},{REG_CHAN,18,4,0},{REG_CHAN,18,8,0},{REG_CHAN,18,12,0},{REG_CHAN,18,16,0},{REG_CHAN,18,20,0},{REG_CHAN,18,24,0},{REG_CHAN,18,28,0},
+/* 0920 */ {REG_CHAN,18,32,0},{REG_CHAN,18,36,0},{REG_CHAN,18,40,0},{REG_CHAN,18,44,0},{REG_CHAN,18,48,0},{REG_CHAN,18,52,0},{REG_CHAN,18,56,0},{REG_CHAN,18,60,0},
+/* 0940 */ {REG_CHAN,18,64,0},{REG_CHAN,18,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0980 */ {REG_CHAN,19,0,0},{REG_CHAN,19,4,0},{REG_CHAN,19,8,0},{REG_CHAN,19,12,0},{REG_CHAN,19,16,0},{REG_CHAN,19,20,0},{REG_CHAN,19,24,0},{REG_CHAN,19,28,0},
+/* 09A0 */ {REG_CHAN,19,32,0},{REG_CHAN,19,36,0},{REG_CHAN,19,40,0},{REG_CHAN,19,44,0},{REG_CHAN,19,48,0},{REG_CHAN,19,52,0},{REG_CHAN,19,56,0},{REG_CHAN,19,60,0},
+/* 09C0 */ {REG_CHAN,19,64,0},{REG_CHAN,19,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 09E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0A00 */ {REG_CHAN,20,0,0},{REG_CHAN,20,4,0},{REG_CHAN,20,8,0},{REG_CHAN,20,12,0},{REG_CHAN,20,16,0},{REG_CHAN,20,20,0},{REG_CHAN,20,24,0},{REG_CHAN,20,28,0},
+/* 0A20 */ {REG_CHAN,20,32,0},{REG_CHAN,20,36,0},{REG_CHAN,20,40,0},{REG_CHAN,20,44,0},{REG_CHAN,20,48,0},{REG_CHAN,20,52,0},{REG_CHAN,20,56,0},{REG_CHAN,20,60,0},
+/* 0A40 */ {REG_CHAN,20,64,0},{REG_CHAN,20,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0A80 */ {REG_CHAN,21,0,0},{REG_CHAN,21,4,0},{REG_CHAN,21,8,0},{REG_CHAN,21,12,0},{REG_CHAN,21,16,0},{REG_CHAN,21,20,0},{REG_CHAN,21,24,0},{REG_CHAN,21,28,0},
+/* 0AA0 */ {REG_CHAN,21,32,0},{REG_CHAN,21,36,0},{REG_CHAN,21,40,0},{REG_CHAN,21,44,0},{REG_CHAN,21,48,0},{REG_CHAN,21,52,0},{REG_CHAN,21,56,0},{REG_CHAN,21,60,0},
+/* 0AC0 */ {REG_CHAN,21,64,0},{REG_CHAN,21,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0B00 */ {REG_CHAN,22,0,0},{REG_CHAN,22,4,0},{REG_CHAN,22,8,0},{REG_CHAN,22,12,0},{REG_CHAN,22,16,0},{REG_CHAN,22,20,0},{REG_CHAN,22,24,0},{REG_CHAN,22,28,0},
+/* 0B20 */ {REG_CHAN,22,32,0},{REG_CHAN,22,36,0},{REG_CHAN,22,40,0},{REG_CHAN,22,44,0},{REG_CHAN,22,48,0},{REG_CHAN,22,52,0},{REG_CHAN,22,56,0},{REG_CHAN,22,60,0},
+/* 0B40 */ {REG_CHAN,22,64,0},{REG_CHAN,22,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0B80 */ {REG_CHAN,23,0,0},{REG_CHAN,23,4,0},{REG_CHAN,23,8,0},{REG_CHAN,23,12,0},{REG_CHAN,23,16,0},{REG_CHAN,23,20,0},{REG_CHAN,23,24,0},{REG_CHAN,23,28,0},
+/* 0BA0 */ {REG_CHAN,23,32,0},{REG_CHAN,23,36,0},{REG_CHAN,23,40,0},{REG_CHAN,23,44,0},{REG_CHAN,23,48,0},{REG_CHAN,23,52,0},{REG_CHAN,23,56,0},{REG_CHAN,23,60,0},
+/* 0BC0 */ {REG_CHAN,23,64,0},{REG_CHAN,23,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0C00 */ {REG_CHAN,24,0,0},{REG_CHAN,24,4,0},{REG_CHAN,24,8,0},{REG_CHAN,24,12,0},{REG_CHAN,24,16,0},{REG_CHAN,24,20,0},{REG_CHAN,24,24,0},{REG_CHAN,24,28,0},
+/* 0C20 */ {REG_CHAN,24,32,0},{REG_CHAN,24,36,0},{REG_CHAN,24,40,0},{REG_CHAN,24,44,0},{REG_CHAN,24,48,0},{REG_CHAN,24,52,0},{REG_CHAN,24,56,0},{REG_CHAN,24,60,0},
+/* 0C40 */ {REG_CHAN,24,64,0},{REG_CHAN,24,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0C80 */ {REG_CHAN,25,0,0},{REG_CHAN,25,4,0},{REG_CHAN,25,8,0},{REG_CHAN,25,12,0},{REG_CHAN,25,16,0},{REG_CHAN,25,20,0},{REG_CHAN,25,24,0},{REG_CHAN,25,28,0},
+/* 0CA0 */ {REG_CHAN,25,32,0},{REG_CHAN,25,36,0},{REG_CHAN,25,40,0},{REG_CHAN,25,44,0},{REG_CHAN,25,48,0},{REG_CHAN,25,52,0},{REG_CHAN,25,56,0},{REG_CHAN,25,60,0},
+/* 0CC0 */ {REG_CHAN,25,64,0},{REG_CHAN,25,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0D00 */ {REG_CHAN,26,0,0},{REG_CHAN,26,4,0},{REG_CHAN,26,8,0},{REG_CHAN,26,12,0},{REG_CHAN,26,16,0},{REG_CHAN,26,20,0},{REG_CHAN,26,24,0},{REG_CHAN,26,28,0},
+/* 0D20 */ {REG_CHAN,26,32,0},{REG_CHAN,26,36,0},{REG_CHAN,26,40,0},{REG_CHAN,26,44,0},{REG_CHAN,26,48,0},{REG_CHAN,26,52,0},{REG_CHAN,26,56,0},{REG_CHAN,26,60,0},
+/* 0D40 */ {REG_CHAN,26,64,0},{REG_CHAN,26,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0D80 */ {REG_CHAN,27,0,0},{REG_CHAN,27,4,0},{REG_CHAN,27,8,0},{REG_CHAN,27,12,0},{REG_CHAN,27,16,0},{REG_CHAN,27,20,0},{REG_CHAN,27,24,0},{REG_CHAN,27,28,0},
+/* 0DA0 */ {REG_CHAN,27,32,0},{REG_CHAN,27,36,0},{REG_CHAN,27,40,0},{REG_CHAN,27,44,0},{REG_CHAN,27,48,0},{REG_CHAN,27,52,0},{REG_CHAN,27,56,0},{REG_CHAN,27,60,0},
+/* 0DC0 */ {REG_CHAN,27,64,0},{REG_CHAN,27,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0E00 */ {REG_CHAN,28,0,0},{REG_CHAN,28,4,0},{REG_CHAN,28,8,0},{REG_CHAN,28,12,0},{REG_CHAN,28,16,0},{REG_CHAN,28,20,0},{REG_CHAN,28,24,0},{REG_CHAN,28,28,0},
+/* 0E20 */ {REG_CHAN,28,32,0},{REG_CHAN,28,36,0},{REG_CHAN,28,40,0},{REG_CHAN,28,44,0},{REG_CHAN,28,48,0},{REG_CHAN,28,52,0},{REG_CHAN,28,56,0},{REG_CHAN,28,60,0},
+/* 0E40 */ {REG_CHAN,28,64,0},{REG_CHAN,28,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0E80 */ {REG_CHAN,29,0,0},{REG_CHAN,29,4,0},{REG_CHAN,29,8,0},{REG_CHAN,29,12,0},{REG_CHAN,29,16,0},{REG_CHAN,29,20,0},{REG_CHAN,29,24,0},{REG_CHAN,29,28,0},
+/* 0EA0 */ {REG_CHAN,29,32,0},{REG_CHAN,29,36,0},{REG_CHAN,29,40,0},{REG_CHAN,29,44,0},{REG_CHAN,29,48,0},{REG_CHAN,29,52,0},{REG_CHAN,29,56,0},{REG_CHAN,29,60,0},
+/* 0EC0 */ {REG_CHAN,29,64,0},{REG_CHAN,29,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F00 */ {REG_CHAN,30,0,0},{REG_CHAN,30,4,0},{REG_CHAN,30,8,0},{REG_CHAN,30,12,0},{REG_CHAN,30,16,0},{REG_CHAN,30,20,0},{REG_CHAN,30,24,0},{REG_CHAN,30,28,0},
+/* 0F20 */ {REG_CHAN,30,32,0},{REG_CHAN,30,36,0},{REG_CHAN,30,40,0},{REG_CHAN,30,44,0},{REG_CHAN,30,48,0},{REG_CHAN,30,52,0},{REG_CHAN,30,56,0},{REG_CHAN,30,60,0},
+/* 0F40 */ {REG_CHAN,30,64,0},{REG_CHAN,30,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0F80 */ {REG_CHAN,31,0,0},{REG_CHAN,31,4,0},{REG_CHAN,31,8,0},{REG_CHAN,31,12,0},{REG_CHAN,31,16,0},{REG_CHAN,31,20,0},{REG_CHAN,31,24,0},{REG_CHAN,31,28,0},
+/* 0FA0 */ {REG_CHAN,31,32,0},{REG_CHAN,31,36,0},{REG_CHAN,31,40,0},{REG_CHAN,31,44,0},{REG_CHAN,31,48,0},{REG_CHAN,31,52,0},{REG_CHAN,31,56,0},{REG_CHAN,31,60,0},
+/* 0FC0 */ {REG_CHAN,31,64,0},{REG_CHAN,31,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 0FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1000 */ {REG_CHAN,32,0,0},{REG_CHAN,32,4,0},{REG_CHAN,32,8,0},{REG_CHAN,32,12,0},{REG_CHAN,32,16,0},{REG_CHAN,32,20,0},{REG_CHAN,32,24,0},{REG_CHAN,32,28,0},
+/* 1020 */ {REG_CHAN,32,32,0},{REG_CHAN,32,36,0},{REG_CHAN,32,40,0},{REG_CHAN,32,44,0},{REG_CHAN,32,48,0},{REG_CHAN,32,52,0},{REG_CHAN,32,56,0},{REG_CHAN,32,60,0},
+/* 1040 */ {REG_CHAN,32,64,0},{REG_CHAN,32,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1080 */ {REG_CHAN,33,0,0},{REG_CHAN,33,4,0},{REG_CHAN,33,8,0},{REG_CHAN,33,12,0},{REG_CHAN,33,16,0},{REG_CHAN,33,20,0},{REG_CHAN,33,24,0},{REG_CHAN,33,28,0},
+/* 10A0 */ {REG_CHAN,33,32,0},{REG_CHAN,33,36,0},{REG_CHAN,33,40,0},{REG_CHAN,33,44,0},{REG_CHAN,33,48,0},{REG_CHAN,33,52,0},{REG_CHAN,33,56,0},{REG_CHAN,33,60,0},
+/* 10C0 */ {REG_CHAN,33,64,0},{REG_CHAN,33,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 10E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1100 */ {REG_CHAN,34,0,0},{REG_CHAN,34,4,0},{REG_CHAN,34,8,0},{REG_CHAN,34,12,0},{REG_CHAN,34,16,0},{REG_CHAN,34,20,0},{REG_CHAN,34,24,0},{REG_CHAN,34,28,0},
+/* 1120 */ {REG_CHAN,34,32,0},{REG_CHAN,34,36,0},{REG_CHAN,34,40,0},{REG_CHAN,34,44,0},{REG_CHAN,34,48,0},{REG_CHAN,34,52,0},{REG_CHAN,34,56,0},{REG_CHAN,34,60,0},
+/* 1140 */ {REG_CHAN,34,64,0},{REG_CHAN,34,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1180 */ {REG_CHAN,35,0,0},{REG_CHAN,35,4,0},{REG_CHAN,35,8,0},{REG_CHAN,35,12,0},{REG_CHAN,35,16,0},{REG_CHAN,35,20,0},{REG_CHAN,35,24,0},{REG_CHAN,35,28,0},
+/* 11A0 */ {REG_CHAN,35,32,0},{REG_CHAN,35,36,0},{REG_CHAN,35,40,0},{REG_CHAN,35,44,0},{REG_CHAN,35,48,0},{REG_CHAN,35,52,0},{REG_CHAN,35,56,0},{REG_CHAN,35,60,0},
+/* 11C0 */ {REG_CHAN,35,64,0},{REG_CHAN,35,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 11E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1200 */ {REG_CHAN,36,0,0},{REG_CHAN,36,4,0},{REG_CHAN,36,8,0},{REG_CHAN,36,12,0},{REG_CHAN,36,16,0},{REG_CHAN,36,20,0},{REG_CHAN,36,24,0},{REG_CHAN,36,28,0},
+/* 1220 */ {REG_CHAN,36,32,0},{REG_CHAN,36,36,0},{REG_CHAN,36,40,0},{REG_CHAN,36,44,0},{REG_CHAN,36,48,0},{REG_CHAN,36,52,0},{REG_CHAN,36,56,0},{REG_CHAN,36,60,0},
+/* 1240 */ {REG_CHAN,36,64,0},{REG_CHAN,36,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1280 */ {REG_CHAN,37,0,0},{REG_CHAN,37,4,0},{REG_CHAN,37,8,0},{REG_CHAN,37,12,0},{REG_CHAN,37,16,0},{REG_CHAN,37,20,0},{REG_CHAN,37,24,0},{REG_CHAN,37,28,0},
+/* 12A0 */ {REG_CHAN,37,32,0},{REG_CHAN,37,36,0},{REG_CHAN,37,40,0},{REG_CHAN,37,44,0},{REG_CHAN,37,48,0},{REG_CHAN,37,52,0},{REG_CHAN,37,56,0},{REG_CHAN,37,60,0},
+/* 12C0 */ {REG_CHAN,37,64,0},{REG_CHAN,37,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 12E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1300 */ {REG_CHAN,38,0,0},{REG_CHAN,38,4,0},{REG_CHAN,38,8,0},{REG_CHAN,38,12,0},{REG_CHAN,38,16,0},{REG_CHAN,38,20,0},{REG_CHAN,38,24,0},{REG_CHAN,38,28,0},
+/* 1320 */ {REG_CHAN,38,32,0},{REG_CHAN,38,36,0},{REG_CHAN,38,40,0},{REG_CHAN,38,44,0},{REG_CHAN,38,48,0},{REG_CHAN,38,52,0},{REG_CHAN,38,56,0},{REG_CHAN,38,60,0},
+/* 1340 */ {REG_CHAN,38,64,0},{REG_CHAN,38,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1380 */ {REG_CHAN,39,0,0},{REG_CHAN,39,4,0},{REG_CHAN,39,8,0},{REG_CHAN,39,12,0},{REG_CHAN,39,16,0},{REG_CHAN,39,20,0},{REG_CHAN,39,24,0},{REG_CHAN,39,28,0},
+/* 13A0 */ {REG_CHAN,39,32,0},{REG_CHAN,39,36,0},{REG_CHAN,39,40,0},{REG_CHAN,39,44,0},{REG_CHAN,39,48,0},{REG_CHAN,39,52,0},{REG_CHAN,39,56,0},{REG_CHAN,39,60,0},
+/* 13C0 */ {REG_CHAN,39,64,0},{REG_CHAN,39,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 13E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1400 */ {REG_CHAN,40,0,0},{REG_CHAN,40,4,0},{REG_CHAN,40,8,0},{REG_CHAN,40,12,0},{REG_CHAN,40,16,0},{REG_CHAN,40,20,0},{REG_CHAN,40,24,0},{REG_CHAN,40,28,0},
+/* 1420 */ {REG_CHAN,40,32,0},{REG_CHAN,40,36,0},{REG_CHAN,40,40,0},{REG_CHAN,40,44,0},{REG_CHAN,40,48,0},{REG_CHAN,40,52,0},{REG_CHAN,40,56,0},{REG_CHAN,40,60,0},
+/* 1440 */ {REG_CHAN,40,64,0},{REG_CHAN,40,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1480 */ {REG_CHAN,41,0,0},{REG_CHAN,41,4,0},{REG_CHAN,41,8,0},{REG_CHAN,41,12,0},{REG_CHAN,41,16,0},{REG_CHAN,41,20,0},{REG_CHAN,41,24,0},{REG_CHAN,41,28,0},
+/* 14A0 */ {REG_CHAN,41,32,0},{REG_CHAN,41,36,0},{REG_CHAN,41,40,0},{REG_CHAN,41,44,0},{REG_CHAN,41,48,0},{REG_CHAN,41,52,0},{REG_CHAN,41,56,0},{REG_CHAN,41,60,0},
+/* 14C0 */ {REG_CHAN,41,64,0},{REG_CHAN,41,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 14E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1500 */ {REG_CHAN,42,0,0},{REG_CHAN,42,4,0},{REG_CHAN,42,8,0},{REG_CHAN,42,12,0},{REG_CHAN,42,16,0},{REG_CHAN,42,20,0},{REG_CHAN,42,24,0},{REG_CHAN,42,28,0},
+/* 1520 */ {REG_CHAN,42,32,0},{REG_CHAN,42,36,0},{REG_CHAN,42,40,0},{REG_CHAN,42,44,0},{REG_CHAN,42,48,0},{REG_CHAN,42,52,0},{REG_CHAN,42,56,0},{REG_CHAN,42,60,0},
+/* 1540 */ {REG_CHAN,42,64,0},{REG_CHAN,42,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1580 */ {REG_CHAN,43,0,0},{REG_CHAN,43,4,0},{REG_CHAN,43,8,0},{REG_CHAN,43,12,0},{REG_CHAN,43,16,0},{REG_CHAN,43,20,0},{REG_CHAN,43,24,0},{REG_CHAN,43,28,0},
+/* 15A0 */ {REG_CHAN,43,32,0},{REG_CHAN,43,36,0},{REG_CHAN,43,40,0},{REG_CHAN,43,44,0},{REG_CHAN,43,48,0},{REG_CHAN,43,52,0},{REG_CHAN,43,56,0},{REG_CHAN,43,60,0},
+/* 15C0 */ {REG_CHAN,43,64,0},{REG_CHAN,43,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 15E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1600 */ {REG_CHAN,44,0,0},{REG_CHAN,44,4,0},{REG_CHAN,44,8,0},{REG_CHAN,44,12,0},{REG_CHAN,44,16,0},{REG_CHAN,44,20,0},{REG_CHAN,44,24,0},{REG_CHAN,44,28,0},
+/* 1620 */ {REG_CHAN,44,32,0},{REG_CHAN,44,36,0},{REG_CHAN,44,40,0},{REG_CHAN,44,44,0},{REG_CHAN,44,48,0},{REG_CHAN,44,52,0},{REG_CHAN,44,56,0},{REG_CHAN,44,60,0},
+/* 1640 */ {REG_CHAN,44,64,0},{REG_CHAN,44,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1680 */ {REG_CHAN,45,0,0},{REG_CHAN,45,4,0},{REG_CHAN,45,8,0},{REG_CHAN,45,12,0},{REG_CHAN,45,16,0},{REG_CHAN,45,20,0},{REG_CHAN,45,24,0},{REG_CHAN,45,28,0},
+/* 16A0 */ {REG_CHAN,45,32,0},{REG_CHAN,45,36,0},{REG_CHAN,45,40,0},{REG_CHAN,45,44,0},{REG_CHAN,45,48,0},{REG_CHAN,45,52,0},{REG_CHAN,45,56,0},{REG_CHAN,45,60,0},
+/* 16C0 */ {REG_CHAN,45,64,0},{REG_CHAN,45,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 16E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1700 */ {REG_CHAN,46,0,0},{REG_CHAN,46,4,0},{REG_CHAN,46,8,0},{REG_CHAN,46,12,0},{REG_CHAN,46,16,0},{REG_CHAN,46,20,0},{REG_CHAN,46,24,0},{REG_CHAN,46,28,0},
+/* 1720 */ {REG_CHAN,46,32,0},{REG_CHAN,46,36,0},{REG_CHAN,46,40,0},{REG_CHAN,46,44,0},{REG_CHAN,46,48,0},{REG_CHAN,46,52,0},{REG_CHAN,46,56,0},{REG_CHAN,46,60,0},
+/* 1740 */ {REG_CHAN,46,64,0},{REG_CHAN,46,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1780 */ {REG_CHAN,47,0,0},{REG_CHAN,47,4,0},{REG_CHAN,47,8,0},{REG_CHAN,47,12,0},{REG_CHAN,47,16,0},{REG_CHAN,47,20,0},{REG_CHAN,47,24,0},{REG_CHAN,47,28,0},
+/* 17A0 */ {REG_CHAN,47,32,0},{REG_CHAN,47,36,0},{REG_CHAN,47,40,0},{REG_CHAN,47,44,0},{REG_CHAN,47,48,0},{REG_CHAN,47,52,0},{REG_CHAN,47,56,0},{REG_CHAN,47,60,0},
+/* 17C0 */ {REG_CHAN,47,64,0},{REG_CHAN,47,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 17E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1800 */ {REG_CHAN,48,0,0},{REG_CHAN,48,4,0},{REG_CHAN,48,8,0},{REG_CHAN,48,12,0},{REG_CHAN,48,16,0},{REG_CHAN,48,20,0},{REG_CHAN,48,24,0},{REG_CHAN,48,28,0},
+/* 1820 */ {REG_CHAN,48,32,0},{REG_CHAN,48,36,0},{REG_CHAN,48,40,0},{REG_CHAN,48,44,0},{REG_CHAN,48,48,0},{REG_CHAN,48,52,0},{REG_CHAN,48,56,0},{REG_CHAN,48,60,0},
+/* 1840 */ {REG_CHAN,48,64,0},{REG_CHAN,48,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1880 */ {REG_CHAN,49,0,0},{REG_CHAN,49,4,0},{REG_CHAN,49,8,0},{REG_CHAN,49,12,0},{REG_CHAN,49,16,0},{REG_CHAN,49,20,0},{REG_CHAN,49,24,0},{REG_CHAN,49,28,0},
+/* 18A0 */ {REG_CHAN,49,32,0},{REG_CHAN,49,36,0},{REG_CHAN,49,40,0},{REG_CHAN,49,44,0},{REG_CHAN,49,48,0},{REG_CHAN,49,52,0},{REG_CHAN,49,56,0},{REG_CHAN,49,60,0},
+/* 18C0 */ {REG_CHAN,49,64,0},{REG_CHAN,49,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 18E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1900 */ {REG_CHAN,50,0,0},{REG_CHAN,50,4,0},{REG_CHAN,50,8,0},{REG_CHAN,50,12,0},{REG_CHAN,50,16,0},{REG_CHAN,50,20,0},{REG_CHAN,50,24,0},{REG_CHAN,50,28,0},
+/* 1920 */ {REG_CHAN,50,32,0},{REG_CHAN,50,36,0},{REG_CHAN,50,40,0},{REG_CHAN,50,44,0},{REG_CHAN,50,48,0},{REG_CHAN,50,52,0},{REG_CHAN,50,56,0},{REG_CHAN,50,60,0},
+/* 1940 */ {REG_CHAN,50,64,0},{REG_CHAN,50,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1980 */ {REG_CHAN,51,0,0},{REG_CHAN,51,4,0},{REG_CHAN,51,8,0},{REG_CHAN,51,12,0},{REG_CHAN,51,16,0},{REG_CHAN,51,20,0},{REG_CHAN,51,24,0},{REG_CHAN,51,28,0},
+/* 19A0 */ {REG_CHAN,51,32,0},{REG_CHAN,51,36,0},{REG_CHAN,51,40,0},{REG_CHAN,51,44,0},{REG_CHAN,51,48,0},{REG_CHAN,51,52,0},{REG_CHAN,51,56,0},{REG_CHAN,51,60,0},
+/* 19C0 */ {REG_CHAN,51,64,0},{REG_CHAN,51,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 19E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1A00 */ {REG_CHAN,52,0,0},{REG_CHAN,52,4,0},{REG_CHAN,52,8,0},{REG_CHAN,52,12,0},{REG_CHAN,52,16,0},{REG_CHAN,52,20,0},{REG_CHAN,52,24,0},{REG_CHAN,52,28,0},
+/* 1A20 */ {REG_CHAN,52,32,0},{REG_CHAN,52,36,0},{REG_CHAN,52,40,0},{REG_CHAN,52,44,0},{REG_CHAN,52,48,0},{REG_CHAN,52,52,0},{REG_CHAN,52,56,0},{REG_CHAN,52,60,0},
+/* 1A40 */ {REG_CHAN,52,64,0},{REG_CHAN,52,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1A80 */ {REG_CHAN,53,0,0},{REG_CHAN,53,4,0},{REG_CHAN,53,8,0},{REG_CHAN,53,12,0},{REG_CHAN,53,16,0},{REG_CHAN,53,20,0},{REG_CHAN,53,24,0},{REG_CHAN,53,28,0},
+/* 1AA0 */ {REG_CHAN,53,32,0},{REG_CHAN,53,36,0},{REG_CHAN,53,40,0},{REG_CHAN,53,44,0},{REG_CHAN,53,48,0},{REG_CHAN,53,52,0},{REG_CHAN,53,56,0},{REG_CHAN,53,60,0},
+/* 1AC0 */ {REG_CHAN,53,64,0},{REG_CHAN,53,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1B00 */ {REG_CHAN,54,0,0},{REG_CHAN,54,4,0},{REG_CHAN,54,8,0},{REG_CHAN,54,12,0},{REG_CHAN,54,16,0},{REG_CHAN,54,20,0},{REG_CHAN,54,24,0},{REG_CHAN,54,28,0},
+/* 1B20 */ {REG_CHAN,54,32,0},{REG_CHAN,54,36,0},{REG_CHAN,54,40,0},{REG_CHAN,54,44,0},{REG_CHAN,54,48,0},{REG_CHAN,54,52,0},{REG_CHAN,54,56,0},{REG_CHAN,54,60,0},
+/* 1B40 */ {REG_CHAN,54,64,0},{REG_CHAN,54,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1B80 */ {REG_CHAN,55,0,0},{REG_CHAN,55,4,0},{REG_CHAN,55,8,0},{REG_CHAN,55,12,0},{REG_CHAN,55,16,0},{REG_CHAN,55,20,0},{REG_CHAN,55,24,0},{REG_CHAN,55,28,0},
+/* 1BA0 */ {REG_CHAN,55,32,0},{REG_CHAN,55,36,0},{REG_CHAN,55,40,0},{REG_CHAN,55,44,0},{REG_CHAN,55,48,0},{REG_CHAN,55,52,0},{REG_CHAN,55,56,0},{REG_CHAN,55,60,0},
+/* 1BC0 */ {REG_CHAN,55,64,0},{REG_CHAN,55,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1C00 */ {REG_CHAN,56,0,0},{REG_CHAN,56,4,0},{REG_CHAN,56,8,0},{REG_CHAN,56,12,0},{REG_CHAN,56,16,0},{REG_CHAN,56,20,0},{REG_CHAN,56,24,0},{REG_CHAN,56,28,0},
+/* 1C20 */ {REG_CHAN,56,32,0},{REG_CHAN,56,36,0},{REG_CHAN,56,40,0},{REG_CHAN,56,44,0},{REG_CHAN,56,48,0},{REG_CHAN,56,52,0},{REG_CHAN,56,56,0},{REG_CHAN,56,60,0},
+/* 1C40 */ {REG_CHAN,56,64,0},{REG_CHAN,56,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1C80 */ {REG_CHAN,57,0,0},{REG_CHAN,57,4,0},{REG_CHAN,57,8,0},{REG_CHAN,57,12,0},{REG_CHAN,57,16,0},{REG_CHAN,57,20,0},{REG_CHAN,57,24,0},{REG_CHAN,57,28,0},
+/* 1CA0 */ {REG_CHAN,57,32,0},{REG_CHAN,57,36,0},{REG_CHAN,57,40,0},{REG_CHAN,57,44,0},{REG_CHAN,57,48,0},{REG_CHAN,57,52,0},{REG_CHAN,57,56,0},{REG_CHAN,57,60,0},
+/* 1CC0 */ {REG_CHAN,57,64,0},{REG_CHAN,57,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1D00 */ {REG_CHAN,58,0,0},{REG_CHAN,58,4,0},{REG_CHAN,58,8,0},{REG_CHAN,58,12,0},{REG_CHAN,58,16,0},{REG_CHAN,58,20,0},{REG_CHAN,58,24,0},{REG_CHAN,58,28,0},
+/* 1D20 */ {REG_CHAN,58,32,0},{REG_CHAN,58,36,0},{REG_CHAN,58,40,0},{REG_CHAN,58,44,0},{REG_CHAN,58,48,0},{REG_CHAN,58,52,0},{REG_CHAN,58,56,0},{REG_CHAN,58,60,0},
+/* 1D40 */ {REG_CHAN,58,64,0},{REG_CHAN,58,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1D80 */ {REG_CHAN,59,0,0},{REG_CHAN,59,4,0},{REG_CHAN,59,8,0},{REG_CHAN,59,12,0},{REG_CHAN,59,16,0},{REG_CHAN,59,20,0},{REG_CHAN,59,24,0},{REG_CHAN,59,28,0},
+/* 1DA0 */ {REG_CHAN,59,32,0},{REG_CHAN,59,36,0},{REG_CHAN,59,40,0},{REG_CHAN,59,44,0},{REG_CHAN,59,48,0},{REG_CHAN,59,52,0},{REG_CHAN,59,56,0},{REG_CHAN,59,60,0},
+/* 1DC0 */ {REG_CHAN,59,64,0},{REG_CHAN,59,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1E00 */ {REG_CHAN,60,0,0},{REG_CHAN,60,4,0},{REG_CHAN,60,8,0},{REG_CHAN,60,12,0},{REG_CHAN,60,16,0},{REG_CHAN,60,20,0},{REG_CHAN,60,24,0},{REG_CHAN,60,28,0},
+/* 1E20 */ {REG_CHAN,60,32,0},{REG_CHAN,60,36,0},{REG_CHAN,60,40,0},{REG_CHAN,60,44,0},{REG_CHAN,60,48,0},{REG_CHAN,60,52,0},{REG_CHAN,60,56,0},{REG_CHAN,60,60,0},
+/* 1E40 */ {REG_CHAN,60,64,0},{REG_CHAN,60,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1E80 */ {REG_CHAN,61,0,0},{REG_CHAN,61,4,0},{REG_CHAN,61,8,0},{REG_CHAN,61,12,0},{REG_CHAN,61,16,0},{REG_CHAN,61,20,0},{REG_CHAN,61,24,0},{REG_CHAN,61,28,0},
+/* 1EA0 */ {REG_CHAN,61,32,0},{REG_CHAN,61,36,0},{REG_CHAN,61,40,0},{REG_CHAN,61,44,0},{REG_CHAN,61,48,0},{REG_CHAN,61,52,0},{REG_CHAN,61,56,0},{REG_CHAN,61,60,0},
+/* 1EC0 */ {REG_CHAN,61,64,0},{REG_CHAN,61,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1F00 */ {REG_CHAN,62,0,0},{REG_CHAN,62,4,0},{REG_CHAN,62,8,0},{REG_CHAN,62,12,0},{REG_CHAN,62,16,0},{REG_CHAN,62,20,0},{REG_CHAN,62,24,0},{REG_CHAN,62,28,0},
+/* 1F20 */ {REG_CHAN,62,32,0},{REG_CHAN,62,36,0},{REG_CHAN,62,40,0},{REG_CHAN,62,44,0},{REG_CHAN,62,48,0},{REG_CHAN,62,52,0},{REG_CHAN,62,56,0},{REG_CHAN,62,60,0},
+/* 1F40 */ {REG_CHAN,62,64,0},{REG_CHAN,62,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1F80 */ {REG_CHAN,63,0,0},{REG_CHAN,63,4,0},{REG_CHAN,63,8,0},{REG_CHAN,63,12,0},{REG_CHAN,63,16,0},{REG_CHAN,63,20,0},{REG_CHAN,63,24,0},{REG_CHAN,63,28,0},
+/* 1FA0 */ {REG_CHAN,63,32,0},{REG_CHAN,63,36,0},{REG_CHAN,63,40,0},{REG_CHAN,63,44,0},{REG_CHAN,63,48,0},{REG_CHAN,63,52,0},{REG_CHAN,63,56,0},{REG_CHAN,63,60,0},
+/* 1FC0 */ {REG_CHAN,63,64,0},{REG_CHAN,63,68,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 1FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 2000 */ {REG_EFX,0,0,0},{REG_EFX,1,0,0},{REG_EFX,2,0,0},{REG_EFX,3,0,0},{REG_EFX,4,0,0},{REG_EFX,5,0,0},{REG_EFX,6,0,0},{REG_EFX,7,0,0},
+/* 2020 */ {REG_EFX,8,0,0},{REG_EFX,9,0,0},{REG_EFX,10,0,0},{REG_EFX,11,0,0},{REG_EFX,12,0,0},{REG_EFX,13,0,0},{REG_EFX,14,0,0},{REG_EFX,15,0,0},
+/* 2040 */ {REG_EFX,16,0,0},{REG_EFX,17,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2060 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2080 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 20A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 20C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 20E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2100 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2120 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2140 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2160 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2180 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 21A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 21C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 21E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2200 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2220 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2240 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2260 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2280 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 22A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 22C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 22E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2300 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2320 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2340 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2360 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2380 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 23A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 23C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 23E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2400 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2420 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2440 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2460 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2480 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 24A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 24C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 24E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2500 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2520 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2540 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2560 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2580 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 25A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 25C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 25E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2600 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2620 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2640 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2660 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2680 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 26A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 26C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 26E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2700 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2720 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2740 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2760 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2780 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 27A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 27C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 27E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2800 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2820 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2840 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2860 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2880 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 28A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 28C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 28E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2900 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2920 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2940 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2960 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2980 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 29A0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 29C0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 29E0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2A00 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2A20 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2A40 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2A60 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2A80 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2AA0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2AC0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2AE0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2B00 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2B20 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2B40 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2B60 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2B80 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2BA0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2BC0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2BE0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2C00 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2C20 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2C40 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2C60 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2C80 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2CA0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2CC0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2CE0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2D00 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2D20 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2D40 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2D60 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2D80 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2DA0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2DC0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2DE0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2E00 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2E20 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2E40 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2E60 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2E80 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2EA0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2EC0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2EE0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2F00 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2F20 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2F40 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2F60 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2F80 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2FA0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2FC0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 2FE0 */ {REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},{REG_SYS,0,0,0},
+/* 3000 */ {REG_COEF,0,0,0},{REG_COEF,1,0,0},{REG_COEF,2,0,0},{REG_COEF,3,0,0},{REG_COEF,4,0,0},{REG_COEF,5,0,0},{REG_COEF,6,0,0},{REG_COEF,7,0,0},
+/* 3020 */ {REG_COEF,8,0,0},{REG_COEF,9,0,0},{REG_COEF,10,0,0},{REG_COEF,11,0,0},{REG_COEF,12,0,0},{REG_COEF,13,0,0},{REG_COEF,14,0,0},{REG_COEF,15,0,0},
+/* 3040 */ {REG_COEF,16,0,0},{REG_COEF,17,0,0},{REG_COEF,18,0,0},{REG_COEF,19,0,0},{REG_COEF,20,0,0},{REG_COEF,21,0,0},{REG_COEF,22,0,0},{REG_COEF,23,0,0},
+/* 3060 */ {REG_COEF,24,0,0},{REG_COEF,25,0,0},{REG_COEF,26,0,0},{REG_COEF,27,0,0},{REG_COEF,28,0,0},{REG_COEF,29,0,0},{REG_COEF,30,0,0},{REG_COEF,31,0,0},
+/* 3080 */ {REG_COEF,32,0,0},{REG_COEF,33,0,0},{REG_COEF,34,0,0},{REG_COEF,35,0,0},{REG_COEF,36,0,0},{REG_COEF,37,0,0},{REG_COEF,38,0,0},{REG_COEF,39,0,0},
+/* 30A0 */ {REG_COEF,40,0,0},{REG_COEF,41,0,0},{REG_COEF,42,0,0},{REG_COEF,43,0,0},{REG_COEF,44,0,0},{REG_COEF,45,0,0},{REG_COEF,46,0,0},{REG_COEF,47,0,0},
+/* 30C0 */ {REG_COEF,48,0,0},{REG_COEF,49,0,0},{REG_COEF,50,0,0},{REG_COEF,51,0,0},{REG_COEF,52,0,0},{REG_COEF,53,0,0},{REG_COEF,54,0,0},{REG_COEF,55,0,0},
+/* 30E0 */ {REG_COEF,56,0,0},{REG_COEF,57,0,0},{REG_COEF,58,0,0},{REG_COEF,59,0,0},{REG_COEF,60,0,0},{REG_COEF,61,0,0},{REG_COEF,62,0,0},{REG_COEF,63,0,0},
+/* 3100 */ {REG_COEF,64,0,0},{REG_COEF,65,0,0},{REG_COEF,66,0,0},{REG_COEF,67,0,0},{REG_COEF,68,0,0},{REG_COEF,69,0,0},{REG_COEF,70,0,0},{REG_COEF,71,0,0},
+/* 3120 */ {REG_COEF,72,0,0},{REG_COEF,73,0,0},{REG_COEF,74,0,0},{REG_COEF,75,0,0},{REG_COEF,76,0,0},{REG_COEF,77,0,0},{REG_COEF,78,0,0},{REG_COEF,79,0,0},
+/* 3140 */ {REG_COEF,80,0,0},{REG_COEF,81,0,0},{REG_COEF,82,0,0},{REG_COEF,83,0,0},{REG_COEF,84,0,0},{REG_COEF,85,0,0},{REG_COEF,86,0,0},{REG_COEF,87,0,0},
+/* 3160 */ {REG_COEF,88,0,0},{REG_COEF,89,0,0},{REG_COEF,90,0,0},{REG_COEF,91,0,0},{REG_COEF,92,0,0},{REG_COEF,93,0,0},{REG_COEF,94,0,0},{REG_COEF,95,0,0},
+/* 3180 */ {REG_COEF,96,0,0},{REG_COEF,97,0,0},{REG_COEF,98,0,0},{REG_COEF,99,0,0},{REG_COEF,100,0,0},{REG_COEF,101,0,0},{REG_COEF,102,0,0},{REG_COEF,103,0,0},
+/* 31A0 */ {REG_COEF,104,0,0},{REG_COEF,105,0,0},{REG_COEF,106,0,0},{REG_COEF,107,0,0},{REG_COEF,108,0,0},{REG_COEF,109,0,0},{REG_COEF,110,0,0},{REG_COEF,111,0,0},
+/* 31C0 */ {REG_COEF,112,0,0},{REG_COEF,113,0,0},{REG_COEF,114,0,0},{REG_COEF,115,0,0},{REG_COEF,116,0,0},{REG_COEF,117,0,0},{REG_COEF,118,0,0},{REG_COEF,119,0,0},
+/* 31E0 */ {REG_COEF,120,0,0},{REG_COEF,121,0,0},{REG_COEF,122,0,0},{REG_COEF,123,0,0},{REG_COEF,124,0,0},{REG_COEF,125,0,0},{REG_COEF,126,0,0},{REG_COEF,127,0,0},
+/* 3200 */ {REG_MADRS,0,0,0},{REG_MADRS,1,0,0},{REG_MADRS,2,0,0},{REG_MADRS,3,0,0},{REG_MADRS,4,0,0},{REG_MADRS,5,0,0},{REG_MADRS,6,0,0},{REG_MADRS,7,0,0},
+/* 3220 */ {REG_MADRS,8,0,0},{REG_MADRS,9,0,0},{REG_MADRS,10,0,0},{REG_MADRS,11,0,0},{REG_MADRS,12,0,0},{REG_MADRS,13,0,0},{REG_MADRS,14,0,0},{REG_MADRS,15,0,0},
+/* 3240 */ {REG_MADRS,16,0,0},{REG_MADRS,17,0,0},{REG_MADRS,18,0,0},{REG_MADRS,19,0,0},{REG_MADRS,20,0,0},{REG_MADRS,21,0,0},{REG_MADRS,22,0,0},{REG_MADRS,23,0,0},
+/* 3260 */ {REG_MADRS,24,0,0},{REG_MADRS,25,0,0},{REG_MADRS,26,0,0},{REG_MADRS,27,0,0},{REG_MADRS,28,0,0},{REG_MADRS,29,0,0},{REG_MADRS,30,0,0},{REG_MADRS,31,0,0},
+/* 3280 */ {REG_MADRS,32,0,0},{REG_MADRS,33,0,0},{REG_MADRS,34,0,0},{REG_MADRS,35,0,0},{REG_MADRS,36,0,0},{REG_MADRS,37,0,0},{REG_MADRS,38,0,0},{REG_MADRS,39,0,0},
+/* 32A0 */ {REG_MADRS,40,0,0},{REG_MADRS,41,0,0},{REG_MADRS,42,0,0},{REG_MADRS,43,0,0},{REG_MADRS,44,0,0},{REG_MADRS,45,0,0},{REG_MADRS,46,0,0},{REG_MADRS,47,0,0},
+/* 32C0 */ {REG_MADRS,48,0,0},{REG_MADRS,49,0,0},{REG_MADRS,50,0,0},{REG_MADRS,51,0,0},{REG_MADRS,52,0,0},{REG_MADRS,53,0,0},{REG_MADRS,54,0,0},{REG_MADRS,55,0,0},
+/* 32E0 */ {REG_MADRS,56,0,0},{REG_MADRS,57,0,0},{REG_MADRS,58,0,0},{REG_MADRS,59,0,0},{REG_MADRS,60,0,0},{REG_MADRS,61,0,0},{REG_MADRS,62,0,0},{REG_MADRS,63,0,0},
+/* 3300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 33A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 33C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 33E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3400 */ {REG_MPRO,0,48,0},{REG_MPRO,0,32,0},{REG_MPRO,0,16,0},{REG_MPRO,0,0,0},{REG_MPRO,1,48,0},{REG_MPRO,1,32,0},{REG_MPRO,1,16,0},{REG_MPRO,1,0,0},
+/* 3420 */ {REG_MPRO,2,48,0},{REG_MPRO,2,32,0},{REG_MPRO,2,16,0},{REG_MPRO,2,0,0},{REG_MPRO,3,48,0},{REG_MPRO,3,32,0},{REG_MPRO,3,16,0},{REG_MPRO,3,0,0},
+/* 3440 */ {REG_MPRO,4,48,0},{REG_MPRO,4,32,0},{REG_MPRO,4,16,0},{REG_MPRO,4,0,0},{REG_MPRO,5,48,0},{REG_MPRO,5,32,0},{REG_MPRO,5,16,0},{REG_MPRO,5,0,0},
+/* 3460 */ {REG_MPRO,6,48,0},{REG_MPRO,6,32,0},{REG_MPRO,6,16,0},{REG_MPRO,6,0,0},{REG_MPRO,7,48,0},{REG_MPRO,7,32,0},{REG_MPRO,7,16,0},{REG_MPRO,7,0,0},
+/* 3480 */ {REG_MPRO,8,48,0},{REG_MPRO,8,32,0},{REG_MPRO,8,16,0},{REG_MPRO,8,0,0},{REG_MPRO,9,48,0},{REG_MPRO,9,32,0},{REG_MPRO,9,16,0},{REG_MPRO,9,0,0},
+/* 34A0 */ {REG_MPRO,10,48,0},{REG_MPRO,10,32,0},{REG_MPRO,10,16,0},{REG_MPRO,10,0,0},{REG_MPRO,11,48,0},{REG_MPRO,11,32,0},{REG_MPRO,11,16,0},{REG_MPRO,11,0,0},
+/* 34C0 */ {REG_MPRO,12,48,0},{REG_MPRO,12,32,0},{REG_MPRO,12,16,0},{REG_MPRO,12,0,0},{REG_MPRO,13,48,0},{REG_MPRO,13,32,0},{REG_MPRO,13,16,0},{REG_MPRO,13,0,0},
+/* 34E0 */ {REG_MPRO,14,48,0},{REG_MPRO,14,32,0},{REG_MPRO,14,16,0},{REG_MPRO,14,0,0},{REG_MPRO,15,48,0},{REG_MPRO,15,32,0},{REG_MPRO,15,16,0},{REG_MPRO,15,0,0},
+/* 3500 */ {REG_MPRO,16,48,0},{REG_MPRO,16,32,0},{REG_MPRO,16,16,0},{REG_MPRO,16,0,0},{REG_MPRO,17,48,0},{REG_MPRO,17,32,0},{REG_MPRO,17,16,0},{REG_MPRO,17,0,0},
+/* 3520 */ {REG_MPRO,18,48,0},{REG_MPRO,18,32,0},{REG_MPRO,18,16,0},{REG_MPRO,18,0,0},{REG_MPRO,19,48,0},{REG_MPRO,19,32,0},{REG_MPRO,19,16,0},{REG_MPRO,19,0,0},
+/* 3540 */ {REG_MPRO,20,48,0},{REG_MPRO,20,32,0},{REG_MPRO,20,16,0},{REG_MPRO,20,0,0},{REG_MPRO,21,48,0},{REG_MPRO,21,32,0},{REG_MPRO,21,16,0},{REG_MPRO,21,0,0},
+/* 3560 */ {REG_MPRO,22,48,0},{REG_MPRO,22,32,0},{REG_MPRO,22,16,0},{REG_MPRO,22,0,0},{REG_MPRO,23,48,0},{REG_MPRO,23,32,0},{REG_MPRO,23,16,0},{REG_MPRO,23,0,0},
+/* 3580 */ {REG_MPRO,24,48,0},{REG_MPRO,24,32,0},{REG_MPRO,24,16,0},{REG_MPRO,24,0,0},{REG_MPRO,25,48,0},{REG_MPRO,25,32,0},{REG_MPRO,25,16,0},{REG_MPRO,25,0,0},
+/* 35A0 */ {REG_MPRO,26,48,0},{REG_MPRO,26,32,0},{REG_MPRO,26,16,0},{REG_MPRO,26,0,0},{REG_MPRO,27,48,0},{REG_MPRO,27,32,0},{REG_MPRO,27,16,0},{REG_MPRO,27,0,0},
+/* 35C0 */ {REG_MPRO,28,48,0},{REG_MPRO,28,32,0},{REG_MPRO,28,16,0},{REG_MPRO,28,0,0},{REG_MPRO,29,48,0},{REG_MPRO,29,32,0},{REG_MPRO,29,16,0},{REG_MPRO,29,0,0},
+/* 35E0 */ {REG_MPRO,30,48,0},{REG_MPRO,30,32,0},{REG_MPRO,30,16,0},{REG_MPRO,30,0,0},{REG_MPRO,31,48,0},{REG_MPRO,31,32,0},{REG_MPRO,31,16,0},{REG_MPRO,31,0,0},
+/* 3600 */ {REG_MPRO,32,48,0},{REG_MPRO,32,32,0},{REG_MPRO,32,16,0},{REG_MPRO,32,0,0},{REG_MPRO,33,48,0},{REG_MPRO,33,32,0},{REG_MPRO,33,16,0},{REG_MPRO,33,0,0},
+/* 3620 */ {REG_MPRO,34,48,0},{REG_MPRO,34,32,0},{REG_MPRO,34,16,0},{REG_MPRO,34,0,0},{REG_MPRO,35,48,0},{REG_MPRO,35,32,0},{REG_MPRO,35,16,0},{REG_MPRO,35,0,0},
+/* 3640 */ {REG_MPRO,36,48,0},{REG_MPRO,36,32,0},{REG_MPRO,36,16,0},{REG_MPRO,36,0,0},{REG_MPRO,37,48,0},{REG_MPRO,37,32,0},{REG_MPRO,37,16,0},{REG_MPRO,37,0,0},
+/* 3660 */ {REG_MPRO,38,48,0},{REG_MPRO,38,32,0},{REG_MPRO,38,16,0},{REG_MPRO,38,0,0},{REG_MPRO,39,48,0},{REG_MPRO,39,32,0},{REG_MPRO,39,16,0},{REG_MPRO,39,0,0},
+/* 3680 */ {REG_MPRO,40,48,0},{REG_MPRO,40,32,0},{REG_MPRO,40,16,0},{REG_MPRO,40,0,0},{REG_MPRO,41,48,0},{REG_MPRO,41,32,0},{REG_MPRO,41,16,0},{REG_MPRO,41,0,0},
+/* 36A0 */ {REG_MPRO,42,48,0},{REG_MPRO,42,32,0},{REG_MPRO,42,16,0},{REG_MPRO,42,0,0},{REG_MPRO,43,48,0},{REG_MPRO,43,32,0},{REG_MPRO,43,16,0},{REG_MPRO,43,0,0},
+/* 36C0 */ {REG_MPRO,44,48,0},{REG_MPRO,44,32,0},{REG_MPRO,44,16,0},{REG_MPRO,44,0,0},{REG_MPRO,45,48,0},{REG_MPRO,45,32,0},{REG_MPRO,45,16,0},{REG_MPRO,45,0,0},
+/* 36E0 */ {REG_MPRO,46,48,0},{REG_MPRO,46,32,0},{REG_MPRO,46,16,0},{REG_MPRO,46,0,0},{REG_MPRO,47,48,0},{REG_MPRO,47,32,0},{REG_MPRO,47,16,0},{REG_MPRO,47,0,0},
+/* 3700 */ {REG_MPRO,48,48,0},{REG_MPRO,48,32,0},{REG_MPRO,48,16,0},{REG_MPRO,48,0,0},{REG_MPRO,49,48,0},{REG_MPRO,49,32,0},{REG_MPRO,49,16,0},{REG_MPRO,49,0,0},
+/* 3720 */ {REG_MPRO,50,48,0},{REG_MPRO,50,32,0},{REG_MPRO,50,16,0},{REG_MPRO,50,0,0},{REG_MPRO,51,48,0},{REG_MPRO,51,32,0},{REG_MPRO,51,16,0},{REG_MPRO,51,0,0},
+/* 3740 */ {REG_MPRO,52,48,0},{REG_MPRO,52,32,0},{REG_MPRO,52,16,0},{REG_MPRO,52,0,0},{REG_MPRO,53,48,0},{REG_MPRO,53,32,0},{REG_MPRO,53,16,0},{REG_MPRO,53,0,0},
+/* 3760 */ {REG_MPRO,54,48,0},{REG_MPRO,54,32,0},{REG_MPRO,54,16,0},{REG_MPRO,54,0,0},{REG_MPRO,55,48,0},{REG_MPRO,55,32,0},{REG_MPRO,55,16,0},{REG_MPRO,55,0,0},
+/* 3780 */ {REG_MPRO,56,48,0},{REG_MPRO,56,32,0},{REG_MPRO,56,16,0},{REG_MPRO,56,0,0},{REG_MPRO,57,48,0},{REG_MPRO,57,32,0},{REG_MPRO,57,16,0},{REG_MPRO,57,0,0},
+/* 37A0 */ {REG_MPRO,58,48,0},{REG_MPRO,58,32,0},{REG_MPRO,58,16,0},{REG_MPRO,58,0,0},{REG_MPRO,59,48,0},{REG_MPRO,59,32,0},{REG_MPRO,59,16,0},{REG_MPRO,59,0,0},
+/* 37C0 */ {REG_MPRO,60,48,0},{REG_MPRO,60,32,0},{REG_MPRO,60,16,0},{REG_MPRO,60,0,0},{REG_MPRO,61,48,0},{REG_MPRO,61,32,0},{REG_MPRO,61,16,0},{REG_MPRO,61,0,0},
+/* 37E0 */ {REG_MPRO,62,48,0},{REG_MPRO,62,32,0},{REG_MPRO,62,16,0},{REG_MPRO,62,0,0},{REG_MPRO,63,48,0},{REG_MPRO,63,32,0},{REG_MPRO,63,16,0},{REG_MPRO,63,0,0},
+/* 3800 */ {REG_MPRO,64,48,0},{REG_MPRO,64,32,0},{REG_MPRO,64,16,0},{REG_MPRO,64,0,0},{REG_MPRO,65,48,0},{REG_MPRO,65,32,0},{REG_MPRO,65,16,0},{REG_MPRO,65,0,0},
+/* 3820 */ {REG_MPRO,66,48,0},{REG_MPRO,66,32,0},{REG_MPRO,66,16,0},{REG_MPRO,66,0,0},{REG_MPRO,67,48,0},{REG_MPRO,67,32,0},{REG_MPRO,67,16,0},{REG_MPRO,67,0,0},
+/* 3840 */ {REG_MPRO,68,48,0},{REG_MPRO,68,32,0},{REG_MPRO,68,16,0},{REG_MPRO,68,0,0},{REG_MPRO,69,48,0},{REG_MPRO,69,32,0},{REG_MPRO,69,16,0},{REG_MPRO,69,0,0},
+/* 3860 */ {REG_MPRO,70,48,0},{REG_MPRO,70,32,0},{REG_MPRO,70,16,0},{REG_MPRO,70,0,0},{REG_MPRO,71,48,0},{REG_MPRO,71,32,0},{REG_MPRO,71,16,0},{REG_MPRO,71,0,0},
+/* 3880 */ {REG_MPRO,72,48,0},{REG_MPRO,72,32,0},{REG_MPRO,72,16,0},{REG_MPRO,72,0,0},{REG_MPRO,73,48,0},{REG_MPRO,73,32,0},{REG_MPRO,73,16,0},{REG_MPRO,73,0,0},
+/* 38A0 */ {REG_MPRO,74,48,0},{REG_MPRO,74,32,0},{REG_MPRO,74,16,0},{REG_MPRO,74,0,0},{REG_MPRO,75,48,0},{REG_MPRO,75,32,0},{REG_MPRO,75,16,0},{REG_MPRO,75,0,0},
+/* 38C0 */ {REG_MPRO,76,48,0},{REG_MPRO,76,32,0},{REG_MPRO,76,16,0},{REG_MPRO,76,0,0},{REG_MPRO,77,48,0},{REG_MPRO,77,32,0},{REG_MPRO,77,16,0},{REG_MPRO,77,0,0},
+/* 38E0 */ {REG_MPRO,78,48,0},{REG_MPRO,78,32,0},{REG_MPRO,78,16,0},{REG_MPRO,78,0,0},{REG_MPRO,79,48,0},{REG_MPRO,79,32,0},{REG_MPRO,79,16,0},{REG_MPRO,79,0,0},
+/* 3900 */ {REG_MPRO,80,48,0},{REG_MPRO,80,32,0},{REG_MPRO,80,16,0},{REG_MPRO,80,0,0},{REG_MPRO,81,48,0},{REG_MPRO,81,32,0},{REG_MPRO,81,16,0},{REG_MPRO,81,0,0},
+/* 3920 */ {REG_MPRO,82,48,0},{REG_MPRO,82,32,0},{REG_MPRO,82,16,0},{REG_MPRO,82,0,0},{REG_MPRO,83,48,0},{REG_MPRO,83,32,0},{REG_MPRO,83,16,0},{REG_MPRO,83,0,0},
+/* 3940 */ {REG_MPRO,84,48,0},{REG_MPRO,84,32,0},{REG_MPRO,84,16,0},{REG_MPRO,84,0,0},{REG_MPRO,85,48,0},{REG_MPRO,85,32,0},{REG_MPRO,85,16,0},{REG_MPRO,85,0,0},
+/* 3960 */ {REG_MPRO,86,48,0},{REG_MPRO,86,32,0},{REG_MPRO,86,16,0},{REG_MPRO,86,0,0},{REG_MPRO,87,48,0},{REG_MPRO,87,32,0},{REG_MPRO,87,16,0},{REG_MPRO,87,0,0},
+/* 3980 */ {REG_MPRO,88,48,0},{REG_MPRO,88,32,0},{REG_MPRO,88,16,0},{REG_MPRO,88,0,0},{REG_MPRO,89,48,0},{REG_MPRO,89,32,0},{REG_MPRO,89,16,0},{REG_MPRO,89,0,0},
+/* 39A0 */ {REG_MPRO,90,48,0},{REG_MPRO,90,32,0},{REG_MPRO,90,16,0},{REG_MPRO,90,0,0},{REG_MPRO,91,48,0},{REG_MPRO,91,32,0},{REG_MPRO,91,16,0},{REG_MPRO,91,0,0},
+/* 39C0 */ {REG_MPRO,92,48,0},{REG_MPRO,92,32,0},{REG_MPRO,92,16,0},{REG_MPRO,92,0,0},{REG_MPRO,93,48,0},{REG_MPRO,93,32,0},{REG_MPRO,93,16,0},{REG_MPRO,93,0,0},
+/* 39E0 */ {REG_MPRO,94,48,0},{REG_MPRO,94,32,0},{REG_MPRO,94,16,0},{REG_MPRO,94,0,0},{REG_MPRO,95,48,0},{REG_MPRO,95,32,0},{REG_MPRO,95,16,0},{REG_MPRO,95,0,0},
+/* 3A00 */ {REG_MPRO,96,48,0},{REG_MPRO,96,32,0},{REG_MPRO,96,16,0},{REG_MPRO,96,0,0},{REG_MPRO,97,48,0},{REG_MPRO,97,32,0},{REG_MPRO,97,16,0},{REG_MPRO,97,0,0},
+/* 3A20 */ {REG_MPRO,98,48,0},{REG_MPRO,98,32,0},{REG_MPRO,98,16,0},{REG_MPRO,98,0,0},{REG_MPRO,99,48,0},{REG_MPRO,99,32,0},{REG_MPRO,99,16,0},{REG_MPRO,99,0,0},
+/* 3A40 */ {REG_MPRO,100,48,0},{REG_MPRO,100,32,0},{REG_MPRO,100,16,0},{REG_MPRO,100,0,0},{REG_MPRO,101,48,0},{REG_MPRO,101,32,0},{REG_MPRO,101,16,0},{REG_MPRO,101,0,0},
+/* 3A60 */ {REG_MPRO,102,48,0},{REG_MPRO,102,32,0},{REG_MPRO,102,16,0},{REG_MPRO,102,0,0},{REG_MPRO,103,48,0},{REG_MPRO,103,32,0},{REG_MPRO,103,16,0},{REG_MPRO,103,0,0},
+/* 3A80 */ {REG_MPRO,104,48,0},{REG_MPRO,104,32,0},{REG_MPRO,104,16,0},{REG_MPRO,104,0,0},{REG_MPRO,105,48,0},{REG_MPRO,105,32,0},{REG_MPRO,105,16,0},{REG_MPRO,105,0,0},
+/* 3AA0 */ {REG_MPRO,106,48,0},{REG_MPRO,106,32,0},{REG_MPRO,106,16,0},{REG_MPRO,106,0,0},{REG_MPRO,107,48,0},{REG_MPRO,107,32,0},{REG_MPRO,107,16,0},{REG_MPRO,107,0,0},
+/* 3AC0 */ {REG_MPRO,108,48,0},{REG_MPRO,108,32,0},{REG_MPRO,108,16,0},{REG_MPRO,108,0,0},{REG_MPRO,109,48,0},{REG_MPRO,109,32,0},{REG_MPRO,109,16,0},{REG_MPRO,109,0,0},
+/* 3AE0 */ {REG_MPRO,110,48,0},{REG_MPRO,110,32,0},{REG_MPRO,110,16,0},{REG_MPRO,110,0,0},{REG_MPRO,111,48,0},{REG_MPRO,111,32,0},{REG_MPRO,111,16,0},{REG_MPRO,111,0,0},
+/* 3B00 */ {REG_MPRO,112,48,0},{REG_MPRO,112,32,0},{REG_MPRO,112,16,0},{REG_MPRO,112,0,0},{REG_MPRO,113,48,0},{REG_MPRO,113,32,0},{REG_MPRO,113,16,0},{REG_MPRO,113,0,0},
+/* 3B20 */ {REG_MPRO,114,48,0},{REG_MPRO,114,32,0},{REG_MPRO,114,16,0},{REG_MPRO,114,0,0},{REG_MPRO,115,48,0},{REG_MPRO,115,32,0},{REG_MPRO,115,16,0},{REG_MPRO,115,0,0},
+/* 3B40 */ {REG_MPRO,116,48,0},{REG_MPRO,116,32,0},{REG_MPRO,116,16,0},{REG_MPRO,116,0,0},{REG_MPRO,117,48,0},{REG_MPRO,117,32,0},{REG_MPRO,117,16,0},{REG_MPRO,117,0,0},
+/* 3B60 */ {REG_MPRO,118,48,0},{REG_MPRO,118,32,0},{REG_MPRO,118,16,0},{REG_MPRO,118,0,0},{REG_MPRO,119,48,0},{REG_MPRO,119,32,0},{REG_MPRO,119,16,0},{REG_MPRO,119,0,0},
+/* 3B80 */ {REG_MPRO,120,48,0},{REG_MPRO,120,32,0},{REG_MPRO,120,16,0},{REG_MPRO,120,0,0},{REG_MPRO,121,48,0},{REG_MPRO,121,32,0},{REG_MPRO,121,16,0},{REG_MPRO,121,0,0},
+/* 3BA0 */ {REG_MPRO,122,48,0},{REG_MPRO,122,32,0},{REG_MPRO,122,16,0},{REG_MPRO,122,0,0},{REG_MPRO,123,48,0},{REG_MPRO,123,32,0},{REG_MPRO,123,16,0},{REG_MPRO,123,0,0},
+/* 3BC0 */ {REG_MPRO,124,48,0},{REG_MPRO,124,32,0},{REG_MPRO,124,16,0},{REG_MPRO,124,0,0},{REG_MPRO,125,48,0},{REG_MPRO,125,32,0},{REG_MPRO,125,16,0},{REG_MPRO,125,0,0},
+/* 3BE0 */ {REG_MPRO,126,48,0},{REG_MPRO,126,32,0},{REG_MPRO,126,16,0},{REG_MPRO,126,0,0},{REG_MPRO,127,48,0},{REG_MPRO,127,32,0},{REG_MPRO,127,16,0},{REG_MPRO,127,0,0},
+/* 3C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 3FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4000 */ {REG_TEMP,0,0,0},{REG_TEMP,1,0,0},{REG_TEMP,2,0,0},{REG_TEMP,3,0,0},{REG_TEMP,4,0,0},{REG_TEMP,5,0,0},{REG_TEMP,6,0,0},{REG_TEMP,7,0,0},
+/* 4020 */ {REG_TEMP,8,0,0},{REG_TEMP,9,0,0},{REG_TEMP,10,0,0},{REG_TEMP,11,0,0},{REG_TEMP,12,0,0},{REG_TEMP,13,0,0},{REG_TEMP,14,0,0},{REG_TEMP,15,0,0},
+/* 4040 */ {REG_TEMP,16,0,0},{REG_TEMP,17,0,0},{REG_TEMP,18,0,0},{REG_TEMP,19,0,0},{REG_TEMP,20,0,0},{REG_TEMP,21,0,0},{REG_TEMP,22,0,0},{REG_TEMP,23,0,0},
+/* 4060 */ {REG_TEMP,24,0,0},{REG_TEMP,25,0,0},{REG_TEMP,26,0,0},{REG_TEMP,27,0,0},{REG_TEMP,28,0,0},{REG_TEMP,29,0,0},{REG_TEMP,30,0,0},{REG_TEMP,31,0,0},
+/* 4080 */ {REG_TEMP,32,0,0},{REG_TEMP,33,0,0},{REG_TEMP,34,0,0},{REG_TEMP,35,0,0},{REG_TEMP,36,0,0},{REG_TEMP,37,0,0},{REG_TEMP,38,0,0},{REG_TEMP,39,0,0},
+/* 40A0 */ {REG_TEMP,40,0,0},{REG_TEMP,41,0,0},{REG_TEMP,42,0,0},{REG_TEMP,43,0,0},{REG_TEMP,44,0,0},{REG_TEMP,45,0,0},{REG_TEMP,46,0,0},{REG_TEMP,47,0,0},
+/* 40C0 */ {REG_TEMP,48,0,0},{REG_TEMP,49,0,0},{REG_TEMP,50,0,0},{REG_TEMP,51,0,0},{REG_TEMP,52,0,0},{REG_TEMP,53,0,0},{REG_TEMP,54,0,0},{REG_TEMP,55,0,0},
+/* 40E0 */ {REG_TEMP,56,0,0},{REG_TEMP,57,0,0},{REG_TEMP,58,0,0},{REG_TEMP,59,0,0},{REG_TEMP,60,0,0},{REG_TEMP,61,0,0},{REG_TEMP,62,0,0},{REG_TEMP,63,0,0},
+/* 4100 */ {REG_TEMP,64,0,0},{REG_TEMP,65,0,0},{REG_TEMP,66,0,0},{REG_TEMP,67,0,0},{REG_TEMP,68,0,0},{REG_TEMP,69,0,0},{REG_TEMP,70,0,0},{REG_TEMP,71,0,0},
+/* 4120 */ {REG_TEMP,72,0,0},{REG_TEMP,73,0,0},{REG_TEMP,74,0,0},{REG_TEMP,75,0,0},{REG_TEMP,76,0,0},{REG_TEMP,77,0,0},{REG_TEMP,78,0,0},{REG_TEMP,79,0,0},
+/* 4140 */ {REG_TEMP,80,0,0},{REG_TEMP,81,0,0},{REG_TEMP,82,0,0},{REG_TEMP,83,0,0},{REG_TEMP,84,0,0},{REG_TEMP,85,0,0},{REG_TEMP,86,0,0},{REG_TEMP,87,0,0},
+/* 4160 */ {REG_TEMP,88,0,0},{REG_TEMP,89,0,0},{REG_TEMP,90,0,0},{REG_TEMP,91,0,0},{REG_TEMP,92,0,0},{REG_TEMP,93,0,0},{REG_TEMP,94,0,0},{REG_TEMP,95,0,0},
+/* 4180 */ {REG_TEMP,96,0,0},{REG_TEMP,97,0,0},{REG_TEMP,98,0,0},{REG_TEMP,99,0,0},{REG_TEMP,100,0,0},{REG_TEMP,101,0,0},{REG_TEMP,102,0,0},{REG_TEMP,103,0,0},
+/* 41A0 */ {REG_TEMP,104,0,0},{REG_TEMP,105,0,0},{REG_TEMP,106,0,0},{REG_TEMP,107,0,0},{REG_TEMP,108,0,0},{REG_TEMP,109,0,0},{REG_TEMP,110,0,0},{REG_TEMP,111,0,0},
+/* 41C0 */ {REG_TEMP,112,0,0},{REG_TEMP,113,0,0},{REG_TEMP,114,0,0},{REG_TEMP,115,0,0},{REG_TEMP,116,0,0},{REG_TEMP,117,0,0},{REG_TEMP,118,0,0},{REG_TEMP,119,0,0},
+/* 41E0 */ {REG_TEMP,120,0,0},{REG_TEMP,121,0,0},{REG_TEMP,122,0,0},{REG_TEMP,123,0,0},{REG_TEMP,124,0,0},{REG_TEMP,125,0,0},{REG_TEMP,126,0,0},{REG_TEMP,127,0,0},
+/* 4200 */ {REG_TEMP,128,0,0},{REG_TEMP,129,0,0},{REG_TEMP,130,0,0},{REG_TEMP,131,0,0},{REG_TEMP,132,0,0},{REG_TEMP,133,0,0},{REG_TEMP,134,0,0},{REG_TEMP,135,0,0},
+/* 4220 */ {REG_TEMP,136,0,0},{REG_TEMP,137,0,0},{REG_TEMP,138,0,0},{REG_TEMP,139,0,0},{REG_TEMP,140,0,0},{REG_TEMP,141,0,0},{REG_TEMP,142,0,0},{REG_TEMP,143,0,0},
+/* 4240 */ {REG_TEMP,144,0,0},{REG_TEMP,145,0,0},{REG_TEMP,146,0,0},{REG_TEMP,147,0,0},{REG_TEMP,148,0,0},{REG_TEMP,149,0,0},{REG_TEMP,150,0,0},{REG_TEMP,151,0,0},
+/* 4260 */ {REG_TEMP,152,0,0},{REG_TEMP,153,0,0},{REG_TEMP,154,0,0},{REG_TEMP,155,0,0},{REG_TEMP,156,0,0},{REG_TEMP,157,0,0},{REG_TEMP,158,0,0},{REG_TEMP,159,0,0},
+/* 4280 */ {REG_TEMP,160,0,0},{REG_TEMP,161,0,0},{REG_TEMP,162,0,0},{REG_TEMP,163,0,0},{REG_TEMP,164,0,0},{REG_TEMP,165,0,0},{REG_TEMP,166,0,0},{REG_TEMP,167,0,0},
+/* 42A0 */ {REG_TEMP,168,0,0},{REG_TEMP,169,0,0},{REG_TEMP,170,0,0},{REG_TEMP,171,0,0},{REG_TEMP,172,0,0},{REG_TEMP,173,0,0},{REG_TEMP,174,0,0},{REG_TEMP,175,0,0},
+/* 42C0 */ {REG_TEMP,176,0,0},{REG_TEMP,177,0,0},{REG_TEMP,178,0,0},{REG_TEMP,179,0,0},{REG_TEMP,180,0,0},{REG_TEMP,181,0,0},{REG_TEMP,182,0,0},{REG_TEMP,183,0,0},
+/* 42E0 */ {REG_TEMP,184,0,0},{REG_TEMP,185,0,0},{REG_TEMP,186,0,0},{REG_TEMP,187,0,0},{REG_TEMP,188,0,0},{REG_TEMP,189,0,0},{REG_TEMP,190,0,0},{REG_TEMP,191,0,0},
+/* 4300 */ {REG_TEMP,192,0,0},{REG_TEMP,193,0,0},{REG_TEMP,194,0,0},{REG_TEMP,195,0,0},{REG_TEMP,196,0,0},{REG_TEMP,197,0,0},{REG_TEMP,198,0,0},{REG_TEMP,199,0,0},
+/* 4320 */ {REG_TEMP,200,0,0},{REG_TEMP,201,0,0},{REG_TEMP,202,0,0},{REG_TEMP,203,0,0},{REG_TEMP,204,0,0},{REG_TEMP,205,0,0},{REG_TEMP,206,0,0},{REG_TEMP,207,0,0},
+/* 4340 */ {REG_TEMP,208,0,0},{REG_TEMP,209,0,0},{REG_TEMP,210,0,0},{REG_TEMP,211,0,0},{REG_TEMP,212,0,0},{REG_TEMP,213,0,0},{REG_TEMP,214,0,0},{REG_TEMP,215,0,0},
+/* 4360 */ {REG_TEMP,216,0,0},{REG_TEMP,217,0,0},{REG_TEMP,218,0,0},{REG_TEMP,219,0,0},{REG_TEMP,220,0,0},{REG_TEMP,221,0,0},{REG_TEMP,222,0,0},{REG_TEMP,223,0,0},
+/* 4380 */ {REG_TEMP,224,0,0},{REG_TEMP,225,0,0},{REG_TEMP,226,0,0},{REG_TEMP,227,0,0},{REG_TEMP,228,0,0},{REG_TEMP,229,0,0},{REG_TEMP,230,0,0},{REG_TEMP,231,0,0},
+/* 43A0 */ {REG_TEMP,232,0,0},{REG_TEMP,233,0,0},{REG_TEMP,234,0,0},{REG_TEMP,235,0,0},{REG_TEMP,236,0,0},{REG_TEMP,237,0,0},{REG_TEMP,238,0,0},{REG_TEMP,239,0,0},
+/* 43C0 */ {REG_TEMP,240,0,0},{REG_TEMP,241,0,0},{REG_TEMP,242,0,0},{REG_TEMP,243,0,0},{REG_TEMP,244,0,0},{REG_TEMP,245,0,0},{REG_TEMP,246,0,0},{REG_TEMP,247,0,0},
+/* 43E0 */ {REG_TEMP,248,0,0},{REG_TEMP,249,0,0},{REG_TEMP,250,0,0},{REG_TEMP,251,0,0},{REG_TEMP,252,0,0},{REG_TEMP,253,0,0},{REG_TEMP,254,0,0},{REG_TEMP,255,0,0},
+/* 4400 */ {REG_MEMS,0,0,0},{REG_MEMS,1,0,0},{REG_MEMS,2,0,0},{REG_MEMS,3,0,0},{REG_MEMS,4,0,0},{REG_MEMS,5,0,0},{REG_MEMS,6,0,0},{REG_MEMS,7,0,0},
+/* 4420 */ {REG_MEMS,8,0,0},{REG_MEMS,9,0,0},{REG_MEMS,10,0,0},{REG_MEMS,11,0,0},{REG_MEMS,12,0,0},{REG_MEMS,13,0,0},{REG_MEMS,14,0,0},{REG_MEMS,15,0,0},
+/* 4440 */ {REG_MEMS,16,0,0},{REG_MEMS,17,0,0},{REG_MEMS,18,0,0},{REG_MEMS,19,0,0},{REG_MEMS,20,0,0},{REG_MEMS,21,0,0},{REG_MEMS,22,0,0},{REG_MEMS,23,0,0},
+/* 4460 */ {REG_MEMS,24,0,0},{REG_MEMS,25,0,0},{REG_MEMS,26,0,0},{REG_MEMS,27,0,0},{REG_MEMS,28,0,0},{REG_MEMS,29,0,0},{REG_MEMS,30,0,0},{REG_MEMS,31,0,0},
+/* 4480 */ {REG_MEMS,32,0,0},{REG_MEMS,33,0,0},{REG_MEMS,34,0,0},{REG_MEMS,35,0,0},{REG_MEMS,36,0,0},{REG_MEMS,37,0,0},{REG_MEMS,38,0,0},{REG_MEMS,39,0,0},
+/* 44A0 */ {REG_MEMS,40,0,0},{REG_MEMS,41,0,0},{REG_MEMS,42,0,0},{REG_MEMS,43,0,0},{REG_MEMS,44,0,0},{REG_MEMS,45,0,0},{REG_MEMS,46,0,0},{REG_MEMS,47,0,0},
+/* 44C0 */ {REG_MEMS,48,0,0},{REG_MEMS,49,0,0},{REG_MEMS,50,0,0},{REG_MEMS,51,0,0},{REG_MEMS,52,0,0},{REG_MEMS,53,0,0},{REG_MEMS,54,0,0},{REG_MEMS,55,0,0},
+/* 44E0 */ {REG_MEMS,56,0,0},{REG_MEMS,57,0,0},{REG_MEMS,58,0,0},{REG_MEMS,59,0,0},{REG_MEMS,60,0,0},{REG_MEMS,61,0,0},{REG_MEMS,62,0,0},{REG_MEMS,63,0,0},
+/* 4500 */ {REG_MIXS,0,0,0},{REG_MIXS,1,0,0},{REG_MIXS,2,0,0},{REG_MIXS,3,0,0},{REG_MIXS,4,0,0},{REG_MIXS,5,0,0},{REG_MIXS,6,0,0},{REG_MIXS,7,0,0},
+/* 4520 */ {REG_MIXS,8,0,0},{REG_MIXS,9,0,0},{REG_MIXS,10,0,0},{REG_MIXS,11,0,0},{REG_MIXS,12,0,0},{REG_MIXS,13,0,0},{REG_MIXS,14,0,0},{REG_MIXS,15,0,0},
+/* 4540 */ {REG_MIXS,16,0,0},{REG_MIXS,17,0,0},{REG_MIXS,18,0,0},{REG_MIXS,19,0,0},{REG_MIXS,20,0,0},{REG_MIXS,21,0,0},{REG_MIXS,22,0,0},{REG_MIXS,23,0,0},
+/* 4560 */ {REG_MIXS,24,0,0},{REG_MIXS,25,0,0},{REG_MIXS,26,0,0},{REG_MIXS,27,0,0},{REG_MIXS,28,0,0},{REG_MIXS,29,0,0},{REG_MIXS,30,0,0},{REG_MIXS,31,0,0},
+/* 4580 */ {REG_EFREG,0,0,0},{REG_EFREG,1,0,0},{REG_EFREG,2,0,0},{REG_EFREG,3,0,0},{REG_EFREG,4,0,0},{REG_EFREG,5,0,0},{REG_EFREG,6,0,0},{REG_EFREG,7,0,0},
+/* 45A0 */ {REG_EFREG,8,0,0},{REG_EFREG,9,0,0},{REG_EFREG,10,0,0},{REG_EFREG,11,0,0},{REG_EFREG,12,0,0},{REG_EFREG,13,0,0},{REG_EFREG,14,0,0},{REG_EFREG,15,0,0},
+/* 45C0 */ {REG_EXTS,0,0,0},{REG_EXTS,1,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 45E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 46A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 46C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 46E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 47A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 47C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 47E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 48A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 48C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 48E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 49A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 49C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 49E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4A00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4A20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4A40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4A80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4AA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4AC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4B00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4B20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4B40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4B80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4BA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4BC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 4FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 50A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 50C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 50E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 51A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 51C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 51E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 52A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 52C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 52E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 53A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 53C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 53E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 54A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 54C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 54E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 55A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 55C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 55E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 56A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 56C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 56E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 57A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 57C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 57E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 58A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 58C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 58E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 59A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 59C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 59E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5A00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5A20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5A40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5A80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5AA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5AC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5B00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5B20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5B40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5B80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5BA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5BC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 5FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 60A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 60C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 60E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 61A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 61C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 61E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 62A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 62C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 62E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 63A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 63C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 63E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 64A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 64C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 64E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 65A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 65C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 65E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 66A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 66C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 66E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 67A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 67C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 67E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 68A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 68C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 68E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 69A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 69C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 69E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6A00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6A20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6A40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6A80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6AA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6AC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6B00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6B20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6B40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6B80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6BA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6BC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 6FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 70A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 70C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 70E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 71A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 71C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 71E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 72A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 72C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 72E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 73A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 73C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 73E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 74A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 74C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 74E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 75A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 75C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 75E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 76A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 76C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 76E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 77A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 77C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 77E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 78A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 78C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 78E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 79A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 79C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 79E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7A00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7A20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7A40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7A80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7AA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7AC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7B00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7B20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7B40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7B80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7BA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7BC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 7FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 80A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 80C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 80E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 81A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 81C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 81E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 82A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 82C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 82E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 83A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 83C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 83E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 84A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 84C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 84E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 85A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 85C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 85E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 86A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 86C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 86E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 87A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 87C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 87E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 88A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 88C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 88E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 89A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 89C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 89E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8A00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8A20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8A40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8A80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8AA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8AC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8B00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8B20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8B40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8B80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8BA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8BC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 8FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 90A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 90C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 90E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 91A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 91C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 91E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 92A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 92C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 92E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 93A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 93C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 93E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 94A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 94C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 94E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 95A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 95C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 95E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 96A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 96C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 96E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 97A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 97C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 97E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 98A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 98C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 98E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 99A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 99C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 99E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9A00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9A20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9A40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9A60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9A80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9AA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9AC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9AE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9B00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9B20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9B40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9B60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9B80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9BA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9BC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9BE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9C00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9C20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9C40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9C60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9C80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9CA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9CC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9CE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9D00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9D20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9D40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9D60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9D80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9DA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9DC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9DE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9E00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9E20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9E40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9E60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9E80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9EA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9EC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9EE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9F00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9F20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9F40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9F60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9F80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9FA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9FC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* 9FE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A0A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A0C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A0E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A1A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A1C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A1E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A2A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A2C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A2E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A3A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A3C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A3E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A4A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A4C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A4E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A5A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A5C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A5E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A6A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A6C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A6E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A7A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A7C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A7E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A8A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A8C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A8E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A9A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A9C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* A9E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AA00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AA20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AA40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AA60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AA80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AAA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AAC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AAE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AB00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AB20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AB40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AB60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AB80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ABA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ABC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ABE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AC00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AC20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AC40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AC60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AC80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ACA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ACC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ACE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AD00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AD20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AD40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AD60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AD80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ADA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ADC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ADE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AE00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AE20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AE40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AE60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AE80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AEA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AEC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AEE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AF00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AF20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AF40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AF60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AF80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AFA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AFC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* AFE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B0A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B0C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B0E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B1A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B1C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B1E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B2A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B2C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B2E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B3A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B3C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B3E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B4A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B4C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B4E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B5A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B5C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B5E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B6A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B6C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B6E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B7A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B7C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B7E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B8A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B8C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B8E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B9A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B9C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* B9E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BA00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BA20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BA40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BA60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BA80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BAA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BAC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BAE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BB00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BB20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BB40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BB60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BB80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BBA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BBC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BBE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BC00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BC20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BC40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BC60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BC80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BCA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BCC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BCE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BD00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BD20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BD40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BD60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BD80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BDA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BDC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BDE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BE00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BE20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BE40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BE60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BE80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BEA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BEC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BEE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BF00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BF20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BF40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BF60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BF80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BFA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BFC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* BFE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C0A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C0C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C0E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C1A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C1C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C1E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C2A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C2C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C2E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C3A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C3C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C3E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C4A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C4C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C4E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C5A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C5C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C5E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C6A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C6C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C6E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C7A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C7C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C7E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C8A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C8C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C8E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C9A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C9C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* C9E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CA00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CA20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CA40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CA60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CA80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CAA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CAC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CAE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CB00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CB20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CB40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CB60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CB80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CBA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CBC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CBE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CC00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CC20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CC40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CC60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CC80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CCA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CCC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CCE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CD00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CD20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CD40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CD60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CD80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CDA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CDC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CDE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CE00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CE20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CE40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CE60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CE80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CEA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CEC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CEE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CF00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CF20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CF40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CF60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CF80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CFA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CFC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* CFE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D0A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D0C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D0E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D1A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D1C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D1E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D2A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D2C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D2E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D3A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D3C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D3E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D4A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D4C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D4E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D5A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D5C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D5E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D6A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D6C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D6E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D7A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D7C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D7E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D8A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D8C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D8E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D9A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D9C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* D9E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DA00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DA20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DA40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DA60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DA80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DAA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DAC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DAE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DB00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DB20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DB40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DB60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DB80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DBA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DBC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DBE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DC00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DC20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DC40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DC60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DC80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DCA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DCC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DCE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DD00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DD20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DD40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DD60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DD80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DDA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DDC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DDE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DE00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DE20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DE40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DE60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DE80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DEA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DEC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DEE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DF00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DF20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DF40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DF60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DF80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DFA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DFC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* DFE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E0A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E0C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E0E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E1A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E1C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E1E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E2A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E2C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E2E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E3A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E3C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E3E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E4A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E4C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E4E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E5A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E5C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E5E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E6A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E6C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E6E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E7A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E7C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E7E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E8A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E8C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E8E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E9A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E9C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* E9E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EA00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EA20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EA40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EA60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EA80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EAA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EAC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EAE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EB00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EB20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EB40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EB60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EB80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EBA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EBC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EBE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EC00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EC20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EC40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EC60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EC80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ECA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ECC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ECE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ED00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ED20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ED40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ED60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* ED80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EDA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EDC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EDE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EE00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EE20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EE40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EE60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EE80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EEA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EEC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EEE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EF00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EF20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EF40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EF60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EF80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EFA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EFC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* EFE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F000 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F020 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F040 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F060 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F080 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F0A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F0C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F0E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F100 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F120 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F140 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F160 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F180 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F1A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F1C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F1E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F200 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F220 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F240 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F260 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F280 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F2A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F2C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F2E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F300 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F320 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F340 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F360 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F380 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F3A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F3C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F3E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F400 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F420 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F440 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F460 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F480 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F4A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F4C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F4E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F500 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F520 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F540 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F560 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F580 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F5A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F5C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F5E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F600 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F620 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F640 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F660 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F680 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F6A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F6C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F6E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F700 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F720 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F740 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F760 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F780 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F7A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F7C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F7E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F800 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F820 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F840 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F860 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F880 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F8A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F8C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F8E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F900 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F920 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F940 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F960 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F980 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F9A0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F9C0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* F9E0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FA00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FA20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FA40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FA60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FA80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FAA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FAC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FAE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FB00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FB20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FB40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FB60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FB80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FBA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FBC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FBE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FC00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FC20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FC40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FC60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FC80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FCA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FCC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FCE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FD00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FD20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FD40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FD60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FD80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FDA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FDC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FDE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FE00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FE20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FE40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FE60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FE80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FEA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FEC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FEE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FF00 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FF20 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FF40 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FF60 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FF80 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FFA0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FFC0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},
+/* FFE0 */ {REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0},{REG_NONE,0,0,0}
+};
+
+/////////////////////////////////////////////////////////////////////////////
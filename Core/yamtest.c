@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// yamtest - Checks queued register writes and play position reads
+//
+// Usage: yamtest
+//
+// Build it against yam.c with the same defines as the library, e.g.
+//   gcc -DEMU_COMPILE -DEMU_LITTLE_ENDIAN -DHAVE_STDINT_H -DLSB_FIRST
+//       -o yamtest yamtest.c yam.c
+//
+// Register writes are applied at the odometer they arrived at, not at the
+// next flush. This pins that down for the EFX send levels: EFREG 0 holds a
+// constant (the DSP program is empty, so nothing overwrites it), and its
+// send level is turned up partway through a span that is only flushed at
+// the end. Output has to be silent before that sample and steady from it
+// on. It also checks that reading the register back sees the queued write.
+//
+// PlayPos (AICA) and CallAddress (SCSP) read a play position that is past
+// a loop end the CPU just moved under it. That reads back folded into the
+// loop, not as the raw position.
+//
+// Exits nonzero on the first mismatch.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "yam.h"
+
+#define RAMSIZE (0x200000)
+
+static int failures = 0;
+
+static void expect(const char *what, uint32 got, uint32 want) {
+  if(got != want) {
+    printf("FAIL %s: 0x%X, expected 0x%X\n", what, got, want);
+    failures++;
+  }
+}
+
+//
+// Render a span of samples with an EFSDL write at sample 'at', and check
+// where the effect output starts
+//
+static void check_efx_write(void *state, uint32 at, uint32 samples) {
+  static sint16 buf[2 * 1024];
+  char what[64];
+  uint32 i;
+
+  memset(buf, 0x55, sizeof(buf));
+  yam_beginbuffer(state, buf);
+  yam_advance(state, at);
+  // EFSDL 0xF, EFPAN 0 for EFX slot 0
+  yam_aica_store_reg(state, 0x2000, 0x0F00, 0xFFFF, NULL);
+  // reading it back applies the queued write first
+  sprintf(what, "EFSDL read back (write at %u)", at);
+  expect(what, yam_aica_load_reg(state, 0x2000, 0xFFFF), 0x0F00);
+  yam_advance(state, samples - at);
+  yam_flush(state);
+
+  for(i = 0; i < samples; i++) {
+    sint16 want = (i < at) ? 0 : buf[2 * at];
+    if(buf[2 * i] != want || buf[2 * i + 1] != want) {
+      sprintf(what, "sample %u (write at %u)", i, at);
+      expect(what, (uint16)(buf[2 * i]), (uint16)want);
+      return;
+    }
+  }
+  sprintf(what, "output from sample %u on", at);
+  if(!buf[2 * at]) { expect(what, 0, 1); }
+
+  // and back off for the next round
+  yam_aica_store_reg(state, 0x2000, 0x0000, 0xFFFF, NULL);
+  yam_flush(state);
+}
+
+//
+// Play a forward loop from 0 to 0x8000 at one source sample per output
+// sample, then shrink the loop under the play position and read it back
+//
+static void check_aica_playpos(void *state) {
+  // no output needed here
+  yam_beginbuffer(state, NULL);
+  yam_aica_store_reg(state, 0x0008, 0x0000, 0xFFFF, NULL); // LSA
+  yam_aica_store_reg(state, 0x000C, 0x8000, 0xFFFF, NULL); // LEA
+  yam_aica_store_reg(state, 0x0010, 0x001F, 0xFFFF, NULL); // AR 0x1F
+  yam_aica_store_reg(state, 0x0000, 0xC200, 0xFFFF, NULL); // key on, loop
+  yam_flush(state);
+  yam_advance(state, 0x3456);
+  yam_flush(state);
+  yam_aica_store_reg(state, 0x000C, 0x1000, 0xFFFF, NULL);
+  yam_aica_store_reg(state, 0x280C, 0x0000, 0xFF00, NULL); // MSLC 0
+  expect("AICA PlayPos past the loop end", yam_aica_load_reg(state, 0x2814, 0xFFFF), 0x0456);
+  yam_aica_store_reg(state, 0x0000, 0x8000, 0xFFFF, NULL); // key off
+  yam_flush(state);
+}
+
+static void check_scsp_calladdress(void) {
+  void *state = malloc(yam_get_state_size(1));
+  uint32 *ram = calloc(0x80000, 1);
+  if(!state || !ram) { perror("yamtest"); exit(1); }
+  yam_clear_state(state, 1);
+  yam_setram(state, ram, 0x80000, 1, 0);
+  yam_beginbuffer(state, NULL);
+  yam_scsp_store_reg(state, 0x0004, 0x0000, 0xFFFF, NULL); // LSA
+  yam_scsp_store_reg(state, 0x0006, 0x8000, 0xFFFF, NULL); // LEA
+  yam_scsp_store_reg(state, 0x0008, 0x001F, 0xFFFF, NULL); // AR 0x1F
+  yam_scsp_store_reg(state, 0x0000, 0x1820, 0xFFFF, NULL); // key on, loop
+  yam_flush(state);
+  yam_advance(state, 0x7123);
+  yam_flush(state);
+  yam_scsp_store_reg(state, 0x0006, 0x3000, 0xFFFF, NULL);
+  yam_scsp_store_reg(state, 0x0408, 0x0000, 0xFF00, NULL); // MSLC 0
+  expect("SCSP CallAddress past the loop end", yam_scsp_load_reg(state, 0x0408, 0xFFFF), 0x0080);
+  free(ram);
+  free(state);
+}
+
+int main(void) {
+  void *state;
+  uint32 *ram;
+  static const uint32 spans[][2] = {
+    {   1,  16 }, // right at the start
+    {  37, 120 }, // inside one render
+    { 150, 500 }, // past the first RENDERMAX samples
+    { 199, 201 }  // on the last sample of a full render
+  };
+  uint32 i;
+
+  yam_init();
+  state = malloc(yam_get_state_size(2));
+  ram = calloc(RAMSIZE, 1);
+  if(!state || !ram) { perror("yamtest"); return 1; }
+  yam_clear_state(state, 2);
+  yam_setram(state, ram, RAMSIZE, 0, 0);
+  yam_enable_dry(state, 1);
+  yam_enable_dsp(state, 1);
+  yam_enable_dsp_dynarec(state, 0);
+
+  // full master volume, and a constant in EFREG 0
+  yam_aica_store_reg(state, 0x2800, 0x000F, 0xFFFF, NULL);
+  yam_aica_store_reg(state, 0x4580, 0x4000, 0xFFFF, NULL);
+  yam_flush(state);
+
+  for(i = 0; i < sizeof(spans) / sizeof(spans[0]); i++) {
+    check_efx_write(state, spans[i][0], spans[i][1]);
+  }
+
+  check_aica_playpos(state);
+  check_scsp_calladdress();
+
+  free(ram);
+  free(state);
+  if(failures) {
+    printf("%d failure(s)\n", failures);
+    return 1;
+  }
+  printf("yam: all tests passed\n");
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,268 @@
+// ARM to WebAssembly block translator, used by Core/arm.c when built with
+// -DARM_WASM_DYNAREC (which needs -s WASM=1 -s ALLOW_TABLE_GROWTH=1).
+//
+// arm.c hands over a decoded block (struct ARM_WASM_DESC) and gets back a
+// function table index it can call like any C function pointer taking the
+// state pointer, or 0 if it should keep interpreting the block.
+// The generated function does exactly what block_run does: condition checks,
+// cycle accounting and the straight-line/self-modification exits. Simple
+// data processing and branches are done inline, everything else calls the
+// interpreter's handlers through the table.
+//
+// $ArmWasm only needs a memory, a table and the descriptor words, so it can
+// be loaded and exercised under plain Node without a browser; see
+// armwasm_test.js ("node armwasm_test.js").
+mergeInto(LibraryManager.library, {
+	$ArmWasm: {
+		// must match arm.c
+		KIND_CALL: 0,
+		KIND_BRANCH: 1,
+		KIND_DP: 2,
+		DESC_HEADER_WORDS: 15,
+		DESC_INS_WORDS: 4,
+
+		free: [],
+
+		uleb: function(out, v) {
+			v >>>= 0;
+			do {
+				var b = v & 0x7F;
+				v >>>= 7;
+				out.push(v ? (b | 0x80) : b);
+			} while (v);
+		},
+		sleb: function(out, v) {
+			v |= 0;
+			for (;;) {
+				var b = v & 0x7F;
+				v >>= 7;
+				if ((v == 0 && !(b & 0x40)) || (v == -1 && (b & 0x40))) { out.push(b); return; }
+				out.push(b | 0x80);
+			}
+		},
+		str: function(out, s) {
+			ArmWasm.uleb(out, s.length);
+			for (var i = 0; i < s.length; i++) out.push(s.charCodeAt(i));
+		},
+		section: function(out, id, body) {
+			out.push(id);
+			ArmWasm.uleb(out, body.length);
+			for (var i = 0; i < body.length; i++) out.push(body[i]);
+		},
+
+		// read a descriptor out of linear memory (HEAPU32 view, byte address)
+		readDesc: function(heap32, p) {
+			var h = p >> 2;
+			var d = {
+				n:           heap32[h + 0],
+				pc:          heap32[h + 1],
+				ofsR:        heap32[h + 2],
+				ofsCpsr:     heap32[h + 3],
+				ofsLazyKind: heap32[h + 4],
+				ofsLazyOp1:  heap32[h + 5],
+				ofsLazyOp2:  heap32[h + 6],
+				ofsLazyRes:  heap32[h + 7],
+				ofsCycles:   heap32[h + 8],
+				ofsMaxpc:    heap32[h + 9],
+				ofsGen:      heap32[h + 10],
+				gen:         heap32[h + 11],
+				condtable:   heap32[h + 12],
+				materialize: heap32[h + 13],
+				ins: []
+			};
+			h += ArmWasm.DESC_HEADER_WORDS;
+			for (var i = 0; i < d.n; i++, h += ArmWasm.DESC_INS_WORDS) {
+				d.ins.push({
+					insword: heap32[h + 0],
+					cond:    heap32[h + 1],
+					handler: heap32[h + 2],
+					kind:    heap32[h + 3]
+				});
+			}
+			return d;
+		},
+
+		// function body for one block; locals: 0 = state, 1 = scratch,
+		// 2 = operand1, 3 = operand2, 4 = result
+		body: function(d) {
+			var c = [];
+			var U = function(v) { ArmWasm.uleb(c, v); };
+			var S = function(v) { ArmWasm.sleb(c, v); };
+			var get = function(l) { c.push(0x20); U(l); };
+			var set = function(l) { c.push(0x21); U(l); };
+			var konst = function(v) { c.push(0x41); S(v); };
+			// [addr] -> value, [addr value] -> ; offsets are state-relative
+			var load = function(ofs) { c.push(0x28, 0x02); U(ofs); };
+			var store = function(ofs) { c.push(0x36, 0x02); U(ofs); };
+			var storeConst = function(ofs, v) { get(0); konst(v); store(ofs); };
+			var storeLocal = function(ofs, l) { get(0); get(l); store(ofs); };
+			var loadReg = function(n) { get(0); load(d.ofsR + 4 * n); };
+			var call = function(fn) { konst(fn); c.push(0x11, 0x00, 0x00); }; // call_indirect type 0
+			var callHandler = function(ins) { get(0); konst(ins.insword); konst(ins.handler); c.push(0x11, 0x01, 0x00); };
+			// flags_materialize if anything at or above kind is pending
+			var settle = function(kind) {
+				get(0); load(d.ofsLazyKind);
+				if (kind > 1) { konst(kind); c.push(0x4F); } // i32.ge_u
+				c.push(0x04, 0x40); get(0); call(d.materialize); c.push(0x0B);
+			};
+			var pc = d.pc;
+			c.push(0x01, 0x04, 0x7F); // 4 extra i32 locals
+			c.push(0x02, 0x40);       // block $exit
+			for (var i = 0; i < d.ins.length; i++, pc = (pc + 4) >>> 0) {
+				var ins = d.ins[i];
+				var next = (pc + 4) >>> 0;
+				var conditional = ins.cond != 0xE;
+				if (conditional) {
+					settle(1);
+					get(0); load(d.ofsCpsr); konst(24); c.push(0x76); // i32.shr_u
+					c.push(0x2D, 0x00); U((d.condtable + ins.cond) >>> 0); // i32.load8_u
+					c.push(0x04, 0x40); // if
+				}
+				switch (ins.kind) {
+				case ArmWasm.KIND_BRANCH:
+					var target = (pc + 8 + ((ins.insword << 8) >> 6)) >>> 0;
+					if (ins.insword & 0x01000000) storeConst(d.ofsR + 4 * 14, next);
+					storeConst(d.ofsR + 4 * 15, target);
+					storeConst(d.ofsMaxpc, 0);
+					break;
+				case ArmWasm.KIND_DP:
+					ArmWasm.dp(c, d, ins, next, get, set, konst, load, store, storeConst, storeLocal, loadReg, settle);
+					break;
+				default:
+					callHandler(ins);
+					break;
+				}
+				if (conditional) {
+					c.push(0x05); // else
+					storeConst(d.ofsR + 4 * 15, next);
+					c.push(0x0B);
+				}
+				// cycles_remaining -= 2
+				get(0); get(0); load(d.ofsCycles); konst(2); c.push(0x6B); c.push(0x22); U(1); // i32.sub, local.tee
+				store(d.ofsCycles);
+				if (i + 1 < d.ins.length) {
+					get(1); konst(1); c.push(0x48); c.push(0x0D, 0x00);               // i32.lt_s, br_if $exit
+					get(0); load(d.ofsR + 4 * 15); konst(next); c.push(0x47); c.push(0x0D, 0x00); // i32.ne
+					get(0); load(d.ofsGen); konst(d.gen); c.push(0x47); c.push(0x0D, 0x00);
+				}
+			}
+			c.push(0x0B); // end $exit
+			c.push(0x0B); // end function
+			return c;
+		},
+
+		// data processing, imm8 or plain Rm operand, no r15 and no carry-in
+		// (arm.c only marks those); mirrors the armops.h handlers
+		dp: function(c, d, ins, next, get, set, konst, load, store, storeConst, storeLocal, loadReg, settle) {
+			var w = ins.insword;
+			var op = (w >>> 21) & 0xF;
+			var s = (w >>> 20) & 1;
+			var rn = (w >>> 16) & 0xF;
+			var rd = (w >>> 12) & 0xF;
+			var test = op >= 0x8 && op <= 0xB;
+			if (w & 0x02000000) { konst(w & 0xFF); } else { loadReg(w & 0xF); }
+			set(3);
+			if (op != 0xD && op != 0xF) { loadReg(rn); set(2); }
+			switch (op) {
+			case 0x0: case 0x8: get(2); get(3); c.push(0x71); break; // and
+			case 0x1: case 0x9: get(2); get(3); c.push(0x73); break; // xor
+			case 0x2: case 0xA: get(2); get(3); c.push(0x6B); break; // sub
+			case 0x3:           get(3); get(2); c.push(0x6B); break; // rsb
+			case 0x4: case 0xB: get(2); get(3); c.push(0x6A); break; // add
+			case 0xC: get(2); get(3); c.push(0x72); break;           // or
+			case 0xD: get(3); break;
+			case 0xE: get(2); get(3); konst(-1); c.push(0x73); c.push(0x71); break;
+			case 0xF: get(3); konst(-1); c.push(0x73); break;
+			}
+			set(4);
+			if (s) {
+				switch (op) {
+				case 0x4: case 0xB:
+					storeConst(d.ofsLazyKind, 2); storeLocal(d.ofsLazyOp1, 2); storeLocal(d.ofsLazyOp2, 3);
+					break;
+				case 0x2: case 0xA:
+					storeConst(d.ofsLazyKind, 3); storeLocal(d.ofsLazyOp1, 2); storeLocal(d.ofsLazyOp2, 3);
+					break;
+				case 0x3:
+					storeConst(d.ofsLazyKind, 3); storeLocal(d.ofsLazyOp1, 3); storeLocal(d.ofsLazyOp2, 2);
+					break;
+				default:
+					settle(2);
+					storeConst(d.ofsLazyKind, 1);
+					break;
+				}
+				storeLocal(d.ofsLazyRes, 4);
+			}
+			if (!test) storeLocal(d.ofsR + 4 * rd, 4);
+			storeConst(d.ofsR + 4 * 15, next);
+		},
+
+		module: function(d) {
+			var m = [0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00];
+			var b;
+			// types: 0 = (i32), 1 = (i32 i32)
+			ArmWasm.section(m, 1, [0x02, 0x60, 0x01, 0x7F, 0x00, 0x60, 0x02, 0x7F, 0x7F, 0x00]);
+			// imports: env.memory, env.table
+			b = [0x02];
+			ArmWasm.str(b, 'env'); ArmWasm.str(b, 'memory'); b.push(0x02, 0x00, 0x00);
+			ArmWasm.str(b, 'env'); ArmWasm.str(b, 'table'); b.push(0x01, 0x70, 0x00, 0x00);
+			ArmWasm.section(m, 2, b);
+			ArmWasm.section(m, 3, [0x01, 0x00]);
+			b = [0x01];
+			ArmWasm.str(b, 'f'); b.push(0x00, 0x00);
+			ArmWasm.section(m, 7, b);
+			var body = ArmWasm.body(d);
+			b = [0x01];
+			ArmWasm.uleb(b, body.length);
+			for (var i = 0; i < body.length; i++) b.push(body[i]);
+			ArmWasm.section(m, 10, b);
+			return new Uint8Array(m);
+		},
+
+		// returns the table index of the compiled block, or 0
+		compile: function(memory, table, heap32, descptr) {
+			try {
+				var d = ArmWasm.readDesc(heap32, descptr);
+				var mod = new WebAssembly.Module(ArmWasm.module(d));
+				var inst = new WebAssembly.Instance(mod, { 'env': { 'memory': memory, 'table': table } });
+				var index = ArmWasm.free.length ? ArmWasm.free.pop() : table.grow(1);
+				table.set(index, inst.exports['f']);
+				return index;
+			} catch (e) {
+				return 0;
+			}
+		},
+
+		release: function(table, index) {
+			if (!index) return;
+			table.set(index, null);
+			ArmWasm.free.push(index);
+		},
+
+		memory: function() {
+			if (typeof wasmMemory !== 'undefined') return wasmMemory;
+			return Module['wasmMemory'];
+		},
+		table: function() {
+			if (typeof wasmTable !== 'undefined') return wasmTable;
+			if (Module['wasmTable']) return Module['wasmTable'];
+			if (Module['asm'] && Module['asm']['__indirect_function_table']) return Module['asm']['__indirect_function_table'];
+			return null;
+		}
+	},
+
+	arm_wasm_compile__deps: ['$ArmWasm'],
+	arm_wasm_compile: function(descptr) {
+		if (typeof WebAssembly === 'undefined') return 0;
+		var memory = ArmWasm.memory();
+		var table = ArmWasm.table();
+		if (!memory || !table) return 0;
+		return ArmWasm.compile(memory, table, new Uint32Array(memory.buffer), descptr);
+	},
+
+	arm_wasm_release__deps: ['$ArmWasm'],
+	arm_wasm_release: function(index) {
+		var table = ArmWasm.table();
+		if (table) ArmWasm.release(table, index);
+	},
+});
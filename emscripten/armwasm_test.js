@@ -0,0 +1,249 @@
+// Headless check of the ARM to WebAssembly translator (armwasm.js).
+//
+//   node armwasm_test.js
+//
+// Loads $ArmWasm the way the Emscripten library would, lays out a fake ARM
+// state, condition table and block descriptor in a WebAssembly.Memory, and
+// runs translated blocks of each kind (inline data processing, inline
+// branches, calls to a handler through the table) against known results.
+// Exits nonzero on the first mismatch.
+var fs = require('fs');
+var path = require('path');
+
+var LibraryManager = { library: {} };
+function mergeInto(lib, obj) { for (var k in obj) lib[k] = obj[k]; }
+eval(fs.readFileSync(path.join(__dirname, 'armwasm.js'), 'utf8'));
+var ArmWasm = LibraryManager.library.$ArmWasm;
+global.ArmWasm = ArmWasm;
+
+var memory = new WebAssembly.Memory({ initial: 1 });
+var table = new WebAssembly.Table({ initial: 4, element: 'anyfunc' });
+var heap32 = new Uint32Array(memory.buffer);
+var heap8 = new Uint8Array(memory.buffer);
+
+// byte addresses in linear memory
+var CONDTABLE = 256;
+var STATE = 1024;
+var DESC = 4096;
+// state layout (byte offsets from STATE)
+var OFS = { r: 0, cpsr: 64, lazyKind: 68, lazyOp1: 72, lazyOp2: 76, lazyRes: 80, cycles: 84, maxpc: 88, gen: 92 };
+var GEN = 7;
+// table slots for the helpers the translated code calls
+var FN_MATERIALIZE = 1;
+var FN_HANDLER = 2;
+
+var failures = 0;
+var handlerCalls = [];
+var handlerBumpsGen = false;
+
+function word(ofs) { return heap32[(STATE + ofs) >> 2] >>> 0; }
+function setWord(ofs, v) { heap32[(STATE + ofs) >> 2] = v >>> 0; }
+function reg(n) { return word(OFS.r + 4 * n); }
+function setReg(n, v) { setWord(OFS.r + 4 * n, v); }
+
+// same layout as condtable in arm.c: [nzcv << 4 | cond]
+function buildCondTable() {
+	for (var nzcv = 0; nzcv < 16; nzcv++) {
+		var n = (nzcv >> 3) & 1, z = (nzcv >> 2) & 1, c = (nzcv >> 1) & 1, v = nzcv & 1;
+		for (var cond = 0; cond < 16; cond++) {
+			var t;
+			switch (cond >> 1) {
+			case 0: t = z; break;
+			case 1: t = c; break;
+			case 2: t = n; break;
+			case 3: t = v; break;
+			case 4: t = c && !z; break;
+			case 5: t = n == v; break;
+			case 6: t = !z && n == v; break;
+			default: t = 1; break;
+			}
+			if ((cond & 1) && cond != 0xF) t = !t;
+			heap8[CONDTABLE + (nzcv << 4) + cond] = t ? 1 : 0;
+		}
+	}
+}
+
+// flags_materialize for the logic case, which is all these tests leave pending
+function materialize(st) {
+	var cpsr = word(OFS.cpsr) & 0x3FFFFFFF;
+	var res = word(OFS.lazyRes);
+	cpsr |= (res & 0x80000000) >>> 0;
+	if (res == 0) cpsr |= 0x40000000;
+	setWord(OFS.cpsr, cpsr);
+	setWord(OFS.lazyKind, 0);
+}
+
+// a stand-in for an interpreter handler: r0 += 0x10, step the pc
+function handler(st, insword) {
+	handlerCalls.push(insword >>> 0);
+	setReg(0, reg(0) + 0x10);
+	setReg(15, reg(15) + 4);
+	if (handlerBumpsGen) setWord(OFS.gen, word(OFS.gen) + 1);
+}
+
+// JS functions only go into a table by way of a module that imports and
+// re-exports them
+function installHelpers() {
+	var m = [0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00];
+	var b;
+	ArmWasm.section(m, 1, [0x02, 0x60, 0x01, 0x7F, 0x00, 0x60, 0x02, 0x7F, 0x7F, 0x00]);
+	b = [0x02];
+	ArmWasm.str(b, 'h'); ArmWasm.str(b, 'm'); b.push(0x00, 0x00);
+	ArmWasm.str(b, 'h'); ArmWasm.str(b, 'h'); b.push(0x00, 0x01);
+	ArmWasm.section(m, 2, b);
+	b = [0x02];
+	ArmWasm.str(b, 'm'); b.push(0x00, 0x00);
+	ArmWasm.str(b, 'h'); b.push(0x00, 0x01);
+	ArmWasm.section(m, 7, b);
+	var inst = new WebAssembly.Instance(new WebAssembly.Module(new Uint8Array(m)), { 'h': { 'm': materialize, 'h': handler } });
+	table.set(FN_MATERIALIZE, inst.exports['m']);
+	table.set(FN_HANDLER, inst.exports['h']);
+}
+
+// same layout as struct ARM_WASM_DESC in arm.c
+function writeDesc(pc, ins) {
+	var h = DESC >> 2;
+	var header = [
+		ins.length, pc, OFS.r, OFS.cpsr, OFS.lazyKind, OFS.lazyOp1, OFS.lazyOp2,
+		OFS.lazyRes, OFS.cycles, OFS.maxpc, OFS.gen, GEN, CONDTABLE, FN_MATERIALIZE, 0
+	];
+	for (var i = 0; i < header.length; i++) heap32[h++] = header[i] >>> 0;
+	for (var i = 0; i < ins.length; i++) {
+		heap32[h++] = ins[i].insword >>> 0;
+		heap32[h++] = ins[i].insword >>> 28;
+		heap32[h++] = FN_HANDLER;
+		heap32[h++] = ins[i].kind;
+	}
+}
+
+function resetState(pc, cycles) {
+	for (var i = 0; i < 32; i++) heap32[(STATE >> 2) + i] = 0;
+	setReg(15, pc);
+	setWord(OFS.cycles, cycles);
+	setWord(OFS.maxpc, 0xDEAD);
+	setWord(OFS.gen, GEN);
+	handlerCalls = [];
+}
+
+// compile, run once from a fresh state, release; returns the table index
+function run(name, pc, cycles, ins, setup) {
+	resetState(pc, cycles);
+	if (setup) setup();
+	writeDesc(pc, ins);
+	var index = ArmWasm.compile(memory, table, heap32, DESC);
+	if (!index) {
+		console.log('FAIL ' + name + ': compile returned 0');
+		failures++;
+		return 0;
+	}
+	table.get(index)(STATE);
+	ArmWasm.release(table, index);
+	return index;
+}
+
+function expect(name, what, got, want) {
+	if ((got >>> 0) !== (want >>> 0)) {
+		console.log('FAIL ' + name + ': ' + what + ' = 0x' + (got >>> 0).toString(16) + ', expected 0x' + (want >>> 0).toString(16));
+		failures++;
+	}
+}
+
+var DP = ArmWasm.KIND_DP, BRANCH = ArmWasm.KIND_BRANCH, CALL = ArmWasm.KIND_CALL;
+
+buildCondTable();
+installHelpers();
+
+// data processing: mov r0,#5 / add r1,r0,#3 / subs r2,r1,#8
+run('dp', 0x100, 100, [
+	{ insword: 0xE3A00005, kind: DP },
+	{ insword: 0xE2801003, kind: DP },
+	{ insword: 0xE2512008, kind: DP }
+]);
+expect('dp', 'r0', reg(0), 5);
+expect('dp', 'r1', reg(1), 8);
+expect('dp', 'r2', reg(2), 0);
+expect('dp', 'r15', reg(15), 0x10C);
+expect('dp', 'cycles', word(OFS.cycles), 94);
+expect('dp', 'lazy kind', word(OFS.lazyKind), 3);
+expect('dp', 'lazy op1', word(OFS.lazyOp1), 8);
+expect('dp', 'lazy op2', word(OFS.lazyOp2), 8);
+expect('dp', 'lazy result', word(OFS.lazyRes), 0);
+
+// conditions, with Z set: movne r4,#9 is skipped, moveq r5,#1 runs;
+// ands leaves a logic result pending, so the following movmi settles it
+run('cond', 0x100, 100, [
+	{ insword: 0x13A04009, kind: DP },
+	{ insword: 0x03A05001, kind: DP },
+	{ insword: 0xE2156000, kind: DP },
+	{ insword: 0x43A07003, kind: DP }
+], function() { setWord(OFS.cpsr, 0x40000000); setReg(4, 0x44); });
+expect('cond', 'r4', reg(4), 0x44);
+expect('cond', 'r5', reg(5), 1);
+expect('cond', 'r6', reg(6), 0);
+expect('cond', 'r7', reg(7), 0);
+expect('cond', 'cpsr', word(OFS.cpsr), 0x40000000);
+expect('cond', 'r15', reg(15), 0x110);
+
+// running out of cycles stops after the first instruction
+run('cycles', 0x100, 2, [
+	{ insword: 0xE3A00005, kind: DP },
+	{ insword: 0xE3A01006, kind: DP }
+]);
+expect('cycles', 'r0', reg(0), 5);
+expect('cycles', 'r1', reg(1), 0);
+expect('cycles', 'r15', reg(15), 0x104);
+
+// branch with link: bl +8 from 0x200
+run('bl', 0x200, 100, [
+	{ insword: 0xEB000002, kind: BRANCH }
+]);
+expect('bl', 'r15', reg(15), 0x210);
+expect('bl', 'r14', reg(14), 0x204);
+expect('bl', 'maxpc', word(OFS.maxpc), 0);
+expect('bl', 'cycles', word(OFS.cycles), 98);
+
+// plain branch backwards: b -8 from 0x200 leaves r14 alone
+run('b', 0x200, 100, [
+	{ insword: 0xEAFFFFFC, kind: BRANCH }
+], function() { setReg(14, 0x1234); });
+expect('b', 'r15', reg(15), 0x1F8);
+expect('b', 'r14', reg(14), 0x1234);
+
+// handler call between inline instructions: mov r0,#1 / <handler> / add r0,r0,#1
+run('call', 0x300, 100, [
+	{ insword: 0xE3A00001, kind: DP },
+	{ insword: 0xE7F000F0, kind: CALL },
+	{ insword: 0xE2800001, kind: DP }
+]);
+expect('call', 'r0', reg(0), 0x12);
+expect('call', 'r15', reg(15), 0x30C);
+expect('call', 'handler calls', handlerCalls.length, 1);
+expect('call', 'handler insword', handlerCalls[0], 0xE7F000F0);
+
+// a handler that bumps the code page generation (self-modifying code)
+// ends the block
+run('gen', 0x300, 100, [
+	{ insword: 0xE7F000F0, kind: CALL },
+	{ insword: 0xE3A01001, kind: DP }
+], function() { handlerBumpsGen = true; });
+handlerBumpsGen = false;
+expect('gen', 'r1', reg(1), 0);
+expect('gen', 'r15', reg(15), 0x304);
+
+// released table slots are reused rather than growing the table
+(function() {
+	writeDesc(0x100, [{ insword: 0xE3A00005, kind: DP }]);
+	var a = ArmWasm.compile(memory, table, heap32, DESC);
+	var size = table.length;
+	ArmWasm.release(table, a);
+	var b = ArmWasm.compile(memory, table, heap32, DESC);
+	expect('release', 'reused index', b, a);
+	expect('release', 'table size', table.length, size);
+	ArmWasm.release(table, b);
+})();
+
+if (failures) {
+	console.log(failures + ' failure(s)');
+	process.exit(1);
+}
+console.log('armwasm: all tests passed');
@@ -169,6 +169,7 @@ static unsigned int cfg_endsilenceseconds= 5;
 static unsigned int cfg_dry= 1;
 static unsigned int cfg_dsp= 1;
 static unsigned int cfg_dsp_dynarec= 0;		// =1 NOT supported XXX?
+static unsigned int cfg_arm_dynarec= 0;		// experimental; only has an effect when built with -DARM_WASM_DYNAREC
 
 static const char field_length[]="xsf_length";
 static const char field_fade[]="xsf_fade";
@@ -616,6 +617,7 @@ public:
 				yam = satsound_get_yam_state( satsound );
 			}
 			if ( yam ) yam_unprepare_dynacode( yam );
+			sega_enable_arm_dynarec( sega_state.get_ptr(), 0 );
 		}
 	}
 
@@ -728,6 +730,7 @@ public:
 				yam = satsound_get_yam_state( satsound );			
 			}
 			if ( yam ) yam_unprepare_dynacode( yam );
+			sega_enable_arm_dynarec( sega_state.get_ptr(), 0 );
 		}
 
 		sega_state.set_size( sega_get_state_size( xsf_version - 0x10 ) );
@@ -741,6 +744,7 @@ public:
 
 		int dynarec = cfg_dsp_dynarec;
 		sega_enable_dsp_dynarec( pEmu, dynarec );
+		sega_enable_arm_dynarec( pEmu, cfg_arm_dynarec );
 
 		if ( dynarec )
 		{
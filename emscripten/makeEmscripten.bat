@@ -1,25 +1,39 @@
-::  POOR MAN'S DOS PROMPT BUILD SCRIPT.. make sure to delete the respective built/*.bc files before building!
-::  existing *.bc files will not be recompiled. 
+::  POOR MAN'S DOS PROMPT BUILD SCRIPT.. make sure to delete built/extra.bc before building if psflib or zlib changed!
+::  the existing extra.bc is not recompiled; the core is always rebuilt since it changes with the emulator sources.
+::
+::  usage: makeEmscripten.bat          asm.js build (the default)
+::         makeEmscripten.bat wasm     WebAssembly build with the ARM7 block translator compiled in; this also
+::                                     writes htdocs/sega.wasm, which has to be deployed next to backend_sega.js
 
 :: DO NOT -DUSE_STARSCREAM since EMSCRIPTEN does not handle the x86 assembly code ENABLE_DYNAREC must not be used for same reason
 :: (the Mabuse emu also present in the kode54's project does not seem to work here and it was therefore removed)
+:: the ARM7 (Dreamcast) can instead translate hot blocks to WebAssembly at runtime, which needs "-DARM_WASM_DYNAREC" in the
+:: core build and "-s WASM=1 -s ALLOW_TABLE_GROWTH=1" in the link; the wasm profile below sets both (armwasm.js is always
+:: linked; without the define it is never called)
 setlocal enabledelayedexpansion
 
 SET ERRORLEVEL
 VERIFY > NUL
 
-:: **** use the "-s WASM" switch to compile WebAssembly output. warning: the SINGLE_FILE approach does NOT currently work in Chrome 63.. ****
-set "OPT=   -s WASM=0 -s ASSERTIONS=1  -Wcast-align -fno-strict-aliasing  -s FORCE_FILESYSTEM=1 -s VERBOSE=0 -s SAFE_HEAP=0 -s DISABLE_EXCEPTION_CATCHING=0 -DEMU_COMPILE -DEMU_LITTLE_ENDIAN -DHAVE_STDINT_H -DNO_DEBUG_LOGS -Wno-pointer-sign -I. -I.. -I../Core -I../psflib -I../zlib  -Os -O3 "
+:: **** "makeEmscripten.bat wasm" switches to "-s WASM=1" for WebAssembly output. warning: the SINGLE_FILE approach does NOT currently work in Chrome 63.. ****
+set "WASMOPT=-s WASM=0"
+set "COREDEFS=-DUSE_M68K -DLSB_FIRST"
+set "COREBC=built/core.bc"
+if /I "%~1"=="wasm" (
+	set "WASMOPT=-s WASM=1 -s ALLOW_TABLE_GROWTH=1"
+	set "COREDEFS=-DUSE_M68K -DLSB_FIRST -DARM_WASM_DYNAREC"
+	set "COREBC=built/core_wasm.bc"
+)
+
+set "OPT=   !WASMOPT! -s ASSERTIONS=1  -Wcast-align -fno-strict-aliasing  -s FORCE_FILESYSTEM=1 -s VERBOSE=0 -s SAFE_HEAP=0 -s DISABLE_EXCEPTION_CATCHING=0 -DEMU_COMPILE -DEMU_LITTLE_ENDIAN -DHAVE_STDINT_H -DNO_DEBUG_LOGS -Wno-pointer-sign -I. -I.. -I../Core -I../psflib -I../zlib  -Os -O3 "
 
 if not exist "built/extra.bc" (
 	call emcc.bat %OPT% ../psflib/psflib.c ../psflib/psf2fs.c ../zlib/adler32.c ../zlib/compress.c ../zlib/crc32.c ../zlib/gzio.c ../zlib/uncompr.c ../zlib/deflate.c ../zlib/trees.c ../zlib/zutil.c ../zlib/inflate.c ../zlib/infback.c ../zlib/inftrees.c ../zlib/inffast.c -o built/extra.bc
 	IF !ERRORLEVEL! NEQ 0 goto :END
 )
 
-if not exist "built/core.bc" (
-	call emcc.bat -DUSE_M68K -DLSB_FIRST %OPT%   ../Core/sega.c ../Core/dcsound.c ../Core/satsound.c ../Core/yam.c ../Core/arm.c ../Core/m68k/m68kops.c ../Core/m68k/m68kcpu.c  -o built/core.bc
-	IF !ERRORLEVEL! NEQ 0 goto :END
-)
+call emcc.bat %COREDEFS% %OPT%   ../Core/sega.c ../Core/dcsound.c ../Core/satsound.c ../Core/yam.c ../Core/arm.c ../Core/m68k/m68kops.c ../Core/m68k/m68kcpu.c  -o %COREBC%
+IF !ERRORLEVEL! NEQ 0 goto :END
 
-call emcc.bat %OPT% -s TOTAL_MEMORY=134217728 --memory-init-file 0 --closure 1 --llvm-lto 1  built/extra.bc  built/core.bc  htplug.cpp  adapter.cpp --js-library callback.js  -s EXPORTED_FUNCTIONS="['_emu_setup', '_emu_init','_emu_teardown','_emu_get_current_position','_emu_seek_position','_emu_get_max_position','_emu_set_subsong','_emu_get_track_info','_emu_get_sample_rate','_emu_get_audio_buffer','_emu_get_audio_buffer_length','_emu_compute_audio_samples', '_malloc', '_free']"  -o htdocs/sega.js  -s SINGLE_FILE=0 -s EXTRA_EXPORTED_RUNTIME_METHODS="['ccall', 'Pointer_stringify']"  -s BINARYEN_ASYNC_COMPILATION=1 -s BINARYEN_TRAP_MODE='clamp' && copy /b shell-pre.js + htdocs\sega.js + shell-post.js htdocs\web_sega3.js && del htdocs\sega.js && copy /b htdocs\web_sega3.js + sega_adapter.js htdocs\backend_sega.js && del htdocs\web_sega3.js
+call emcc.bat %OPT% -s TOTAL_MEMORY=134217728 --memory-init-file 0 --closure 1 --llvm-lto 1  built/extra.bc  %COREBC%  htplug.cpp  adapter.cpp --js-library callback.js --js-library armwasm.js  -s EXPORTED_FUNCTIONS="['_emu_setup', '_emu_init','_emu_teardown','_emu_get_current_position','_emu_seek_position','_emu_get_max_position','_emu_set_subsong','_emu_get_track_info','_emu_get_sample_rate','_emu_get_audio_buffer','_emu_get_audio_buffer_length','_emu_compute_audio_samples', '_malloc', '_free']"  -o htdocs/sega.js  -s SINGLE_FILE=0 -s EXTRA_EXPORTED_RUNTIME_METHODS="['ccall', 'Pointer_stringify']"  -s BINARYEN_ASYNC_COMPILATION=1 -s BINARYEN_TRAP_MODE='clamp' && copy /b shell-pre.js + htdocs\sega.js + shell-post.js htdocs\web_sega3.js && del htdocs\sega.js && copy /b htdocs\web_sega3.js + sega_adapter.js htdocs\backend_sega.js && del htdocs\web_sega3.js
 :END